@@ -64,6 +64,7 @@ properties = {
 	"task.pycarl": {"env": ["TASK=pycarl"], "addons": addon_apt([],["python3"])},
 	"task.addons": {"env": ["TASK=addons"]},
 	"task.tidy": {"env": ["TASK=tidy"]},
+	"task.tsan": {"env": ["TASK=tsan"]},
 
 	"j1": {"script": ["MAKE_PARALLEL=-j1"]},
 	"build.sh": {"script": ["source .ci/build.sh"]},
@@ -36,6 +36,11 @@ else()
 	set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS}")
 endif()
 
+if (INTERVAL_EFT_ROUNDING AND NOT "${CMAKE_CXX_COMPILER_ID}" STREQUAL "MSVC")
+	# TwoProduct in rounded_arith_eft is not error-free if its products are contracted to fused multiply-adds.
+	set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -ffp-contract=off")
+endif()
+
 if(DEVELOPER)
 	if ("${CMAKE_CXX_COMPILER_ID}" STREQUAL "MSVC")
 		set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /Wall")
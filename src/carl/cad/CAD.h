@@ -32,7 +32,9 @@
 #include <atomic>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "../core/UnivariatePolynomial.h"
@@ -40,7 +42,10 @@
 #include "../core/Variable.h"
 #include "../formula/model/ran/RealAlgebraicNumber.h"
 #include "../formula/model/ran/RealAlgebraicPoint.h"
+#include "../config.h"
+#include "../util/carlCompactTree.h"
 #include "../util/carlTree.h"
+#include "../util/WorkStealingPool.h"
 
 #include "CADConstraints.h"
 #include "CADPolynomials.h"
@@ -56,8 +61,9 @@ namespace carl {
 
 /**
  * This class implements the core of the CAD algorithm.
+ * @tparam SampleTree Type of the sample tree, either carl::tree or the more compact carl::compact_tree.
  */
-template<typename Number>
+template<typename Number, typename SampleTree = tree<RealAlgebraicNumber<Number>>>
 class CAD {
 public:
 	/// Type of univariate polynomials.
@@ -65,10 +71,10 @@ public:
 	/// Type of multivariate polynomials.
 	typedef typename cad::CADPolynomials<Number>::MPolynomial MPolynomial;
 
-	typedef tree<RealAlgebraicNumber<Number>> Tree;
+	typedef SampleTree Tree;
 	/// Type of an iterator over the samples.
 	typedef typename Tree::iterator sampleIterator;
-	typedef typename Tree::template LeafIterator<false> LeafIterator;
+	typedef decltype(std::declval<const Tree&>().begin_leaf()) LeafIterator;
 	/// Type of a map of variable bounds.
 	typedef std::unordered_map<std::size_t, Interval<Number>> BoundMap;
 private:
@@ -78,7 +84,7 @@ private:
 	/**
 	 * Sample components built during the CAD lifting arranged in a tree.
 	 */
-	carl::tree<RealAlgebraicNumber<Number>> sampleTree;
+	Tree sampleTree;
 
 	/**
 	 * Lists of polynomials occurring in every elimination level (immutable; new polynomials are appended at the tail)
@@ -111,6 +117,44 @@ private:
 	cad::CADSettings setting;
 	
 	cad::CADConstraints<Number> mConstraints;
+
+	/**
+	 * A subtree of the sample tree that was erased while a checkpoint exists.
+	 */
+	struct DetachedSamples {
+		/// Samples on the path from the root to the parent of the subtree.
+		std::vector<RealAlgebraicNumber<Number>> path;
+		/// Samples of the subtree in preorder, each with its depth relative to the root of the subtree.
+		std::vector<std::pair<std::size_t, RealAlgebraicNumber<Number>>> samples;
+	};
+
+	/**
+	 * Undo information for a call of addPolynomial() or removePolynomial() while a checkpoint exists.
+	 */
+	struct TrailEntry {
+		/// The input polynomial.
+		MPolynomial polynomial;
+		/// Flag indicating that the polynomial was added (or removed otherwise).
+		bool added;
+		/// The internal polynomial that was removed.
+		const UPolynomial* removed = nullptr;
+		/// Flag indicating that the removed polynomial was still scheduled.
+		bool wasScheduled = false;
+		/// Number of recorded removals of every elimination set before the removal.
+		std::vector<std::size_t> removalCounts;
+		/// Variables that were introduced by the added polynomial.
+		std::vector<Variable> newVariables;
+		/// Subtrees of samples erased by the removal.
+		std::vector<DetachedSamples> detached;
+		/// Lifting positions of the elimination sets below the level whose samples were erased.
+		std::vector<typename cad::EliminationSet<Number>::LiftingPositions> liftingPositions;
+	};
+	/// Changes of the input polynomials since the first checkpoint.
+	std::vector<TrailEntry> mTrail;
+	/// Size of mTrail for every checkpoint.
+	std::vector<std::size_t> mCheckpoints;
+	/// The removal that is currently recorded, nullptr otherwise.
+	TrailEntry* mRecordedRemoval = nullptr;
 	
 	static unsigned checkCallCount;
 
@@ -245,8 +289,8 @@ public:
 	 */
 	void printConstraints(const std::string& filename = cad::DEFAULT_CAD_OUTPUTFILE) const;
 
-	template<typename Num>
-	friend std::ostream& operator<<(std::ostream& os, const CAD<Num>& cad);
+	template<typename Num, typename T>
+	friend std::ostream& operator<<(std::ostream& os, const CAD<Num,T>& cad);
 
 	
 	//////////////////////////////
@@ -360,6 +404,32 @@ public:
 	 * @param childrenOnly only remove the children of pPtr (recursively)
 	 */
 	void removePolynomial(const UPolynomial* p, unsigned level = 0, bool childrenOnly = false);
+
+	/**
+	 * Creates a checkpoint of the current set of input polynomials, like the push of an SMT solver.
+	 * All subsequent calls of addPolynomial() and removePolynomial(const MPolynomial&) are recorded, such that pop() can undo them.
+	 * Note that the bounds are not part of the CAD but are passed to every call of check().
+	 */
+	void push() {
+		mCheckpoints.push_back(mTrail.size());
+	}
+
+	/**
+	 * Restores the input polynomials of the last checkpoint and discards the checkpoint.
+	 * Added polynomials are removed together with their elimination polynomials, removed polynomials are restored with all elimination polynomials that were removed together with them.
+	 * Variables that were introduced since the checkpoint are removed together with their elimination levels and samples.
+	 * Elimination polynomials and samples that were computed since the checkpoint and are still valid are kept.
+	 * Samples erased by a removal are reattached to the sample tree, restored polynomials are scheduled for lifting again.
+	 * @complexity linear in the number of elimination polynomials changed and samples erased since the checkpoint, plus the size of the elimination levels below every level whose samples were erased
+	 */
+	void pop();
+
+	/**
+	 * @return Number of checkpoints created by push() that were not yet popped.
+	 */
+	std::size_t checkpoints() const {
+		return mCheckpoints.size();
+	}
 	
 	/**
 	 * Get the boundaries of the cad cell intervals in each level for the solution point r.
@@ -581,6 +651,94 @@ public:
 			cad::ConflictGraph<Number>& conflictGraph,
 			std::stack<std::size_t>& satPath
 	);
+
+	/**
+	 * State shared by the tasks of parallelCheck().
+	 * Every subtree knows its index among its siblings and the smallest index of a sibling that found a satisfying sample.
+	 */
+	struct ParallelLifting {
+		/// Lifting of the parent sample, nullptr for the root.
+		const ParallelLifting* parent;
+		/// Index of this sample among its siblings.
+		std::size_t index;
+		/// Smallest index of a sibling whose subtree contains a satisfying sample.
+		const std::atomic<std::size_t>* firstSatisfying;
+		/// Set once any satisfying sample was found.
+		std::atomic_bool* found;
+		/// Protects the conflict graph.
+		std::mutex* conflictGraphMutex;
+		/// Protects the sample tree.
+		std::mutex* treeMutex;
+		/// Whether new samples are constructed, or the existing sample tree is only traversed.
+		bool lift;
+		/// Maximal number of threads lifting the children of a sample.
+		std::size_t threads;
+	};
+
+	/**
+	 * Alternative to mainCheck() that performs the complete elimination and lifts independent subtrees of the sample tree concurrently on setting.liftingThreads threads.
+	 *
+	 * The samples are computed from all elimination polynomials of the respective level and are stored in the sample tree, hence later calls only construct the samples that are missing.
+	 * Every task claims the subtree of one sample, such that the tree is only locked while the children of a node are read or stored.
+	 * If the sample tree is complete and no bounds are given, the existing samples are only traversed.
+	 * Once a satisfying sample is found, the remaining tasks are cancelled.
+	 * If setting.deterministicLifting is set, only tasks that come after the satisfying sample with respect to setting.sampleOrdering are cancelled and r is the first satisfying sample of a depth-first search in this order.
+	 * The interruption flags are checked as in liftCheck().
+	 *
+	 * As polynomial arithmetic is not thread-safe otherwise, the lifting is only done concurrently if carl was built with THREAD_SAFE.
+	 * @param bounds bounds for the variables represented by their index.
+	 * @param r RealAlgebraicPoint which contains the satisfying sample point if the check results true
+	 * @param conflictGraph This is a conflict graph. See CAD::check for a full description.
+	 * @param boundsActive true if bounds are defined, false otherwise
+	 * @param checkBounds if true, all points are checked against the bounds
+	 * @return the same answer as mainCheck()
+	 */
+	cad::Answer parallelCheck(
+			const BoundMap& bounds,
+			RealAlgebraicPoint<Number>& r,
+			cad::ConflictGraph<Number>& conflictGraph,
+			bool boundsActive,
+			bool checkBounds
+	);
+
+	/**
+	 * Helper method for parallelCheck().
+	 * Lifts the given partial sample, whose components belong to the variables mVariables[openVariableCount], mVariables[openVariableCount+1], ..., and checks the constraints on the full samples.
+	 * The new samples are stored as children of the given node, which represents the partial sample in the sample tree.
+	 * The partial sample is owned by the calling task, as real algebraic numbers are refined in place.
+	 */
+	cad::Answer parallelLiftCheck(
+			sampleIterator node,
+			std::vector<RealAlgebraicNumber<Number>>& sample,
+			std::size_t openVariableCount,
+			const BoundMap& bounds,
+			bool boundsActive,
+			bool checkBounds,
+			RealAlgebraicPoint<Number>& r,
+			cad::ConflictGraph<Number>& conflictGraph,
+			const ParallelLifting& state
+	);
+
+	/**
+	 * Checks whether the task of parallelCheck() with the given state can be cancelled, as a satisfying sample was found elsewhere.
+	 */
+	bool parallelLiftingCancelled(const ParallelLifting& state) const {
+		if (this->anAnswerFound()) return true;
+		if (!this->setting.deterministicLifting) return state.found->load();
+		for (const ParallelLifting* s = &state; s != nullptr; s = s->parent) {
+			if (s->firstSatisfying != nullptr && s->firstSatisfying->load() < s->index) return true;
+		}
+		return false;
+	}
+
+	/**
+	 * Copies a sample such that the copy does not share its representation with the original.
+	 */
+	static RealAlgebraicNumber<Number> detachSample(const RealAlgebraicNumber<Number>& sample) {
+		if (sample.isNumeric()) return RealAlgebraicNumber<Number>(sample.value(), sample.isRoot());
+		if (sample.isInterval()) return RealAlgebraicNumber<Number>(sample.getIRPolynomial(), sample.getInterval(), sample.isRoot());
+		return sample;
+	}
 	
 	/**
 	 * If eliminationSets[level].emptyLiftingQueue() is true,
@@ -595,6 +753,19 @@ public:
 	 */
 	int eliminate(std::size_t level, const BoundMap& bounds, bool boundsActive);
 
+	/**
+	 * Removes a polynomial as removePolynomial(const MPolynomial&) does.
+	 * @param polynomial Polynomial to be removed
+	 * @param record If set to true, the removal is recorded for pop().
+	 */
+	void removePolynomial(const MPolynomial& polynomial, bool record);
+
+	/**
+	 * Removes a variable that was introduced by addPolynomial(), together with its elimination level and the samples of this level and below.
+	 * @param v Variable to be removed
+	 */
+	void removeVariable(Variable::Arg v);
+
 	/**
 	 * Get the boundaries of the cad cell interval defined by the children of the given sample tree node for the given sample.
 	 * @param parent
@@ -23,11 +23,11 @@
 
 namespace carl {
 
-template<typename Number>
-unsigned CAD<Number>::checkCallCount = 0;
+template<typename Number, typename SampleTree>
+unsigned CAD<Number, SampleTree>::checkCallCount = 0;
 
-template<typename Number>
-CAD<Number>::CAD():
+template<typename Number, typename SampleTree>
+CAD<Number, SampleTree>::CAD():
 		mVariables(),
 		sampleTree(),
 		eliminationSets(),
@@ -41,8 +41,8 @@ CAD<Number>::CAD():
 	this->sampleTree.setRoot(RealAlgebraicNumber<Number>(0, false));
 }
 
-template<typename Number>
-CAD<Number>::CAD(cad::PolynomialOwner<Number>* parent):
+template<typename Number, typename SampleTree>
+CAD<Number, SampleTree>::CAD(cad::PolynomialOwner<Number>* parent):
 		mVariables(),
 		sampleTree(),
 		eliminationSets(),
@@ -56,22 +56,22 @@ CAD<Number>::CAD(cad::PolynomialOwner<Number>* parent):
 	this->sampleTree.setRoot(RealAlgebraicNumber<Number>(0, false));
 }
 
-template<typename Number>
-CAD<Number>::CAD(const std::vector<std::atomic_bool*>& i):
+template<typename Number, typename SampleTree>
+CAD<Number, SampleTree>::CAD(const std::vector<std::atomic_bool*>& i):
 		CAD()
 {
 	this->interrupts = i;
 }
 
-template<typename Number>
-CAD<Number>::CAD(const cad::CADSettings& _setting):
+template<typename Number, typename SampleTree>
+CAD<Number, SampleTree>::CAD(const cad::CADSettings& _setting):
 		CAD()
 {
 	this->setting = _setting;
 }
 
-template<typename Number>
-CAD<Number>::CAD(const std::list<const UPolynomial*>& s, const std::vector<Variable>& v, const cad::CADSettings& _setting):
+template<typename Number, typename SampleTree>
+CAD<Number, SampleTree>::CAD(const std::list<const UPolynomial*>& s, const std::vector<Variable>& v, const cad::CADSettings& _setting):
 		CAD()
 {
 	this->scheduledPolynomials.assign(s.begin(), s.end());
@@ -80,34 +80,36 @@ CAD<Number>::CAD(const std::list<const UPolynomial*>& s, const std::vector<Varia
 	this->prepareElimination();
 }
 
-template<typename Number>
-CAD<Number>::CAD(const std::list<const UPolynomial*>& s, const std::vector<Variable>& v, const std::vector<std::atomic_bool*>& c, const cad::CADSettings& _setting):
+template<typename Number, typename SampleTree>
+CAD<Number, SampleTree>::CAD(const std::list<const UPolynomial*>& s, const std::vector<Variable>& v, const std::vector<std::atomic_bool*>& c, const cad::CADSettings& _setting):
 		CAD(s, v, _setting)
 {
 	this->interrupts = c;
 }
 
-template<typename Number>
-CAD<Number>::CAD(const CAD<Number>& cad):
+template<typename Number, typename SampleTree>
+CAD<Number, SampleTree>::CAD(const CAD<Number, SampleTree>& cad):
 		mVariables( cad.mVariables ),
 		sampleTree( cad.sampleTree ),
 		eliminationSets( cad.eliminationSets ),
 		polynomials( cad.polynomials ),
 		iscomplete( cad.iscomplete ),
 		interrupted( cad.interrupted ),
-		setting( cad.setting )
+		setting( cad.setting ),
+		mTrail( cad.mTrail ),
+		mCheckpoints( cad.mCheckpoints )
 {
 }
 
-template<typename Number>
-cad::SampleSet<Number> CAD<Number>::samplesAt(const sampleIterator& node) const {
+template<typename Number, typename SampleTree>
+cad::SampleSet<Number> CAD<Number, SampleTree>::samplesAt(const sampleIterator& node) const {
 	cad::SampleSet<Number> samples(setting.sampleOrdering);
 	samples.insert(this->sampleTree.begin(node), this->sampleTree.end(node));
 	return samples;
 }
 
-template<typename Number>
-std::vector<RealAlgebraicPoint<Number>> CAD<Number>::samples() const {
+template<typename Number, typename SampleTree>
+std::vector<RealAlgebraicPoint<Number>> CAD<Number, SampleTree>::samples() const {
 	size_t dim  = mVariables.size();
 	std::vector<RealAlgebraicPoint<Number>> s;
 	for (auto leaf = this->sampleTree.begin_leaf(); leaf != this->sampleTree.end_leaf(); leaf++) {
@@ -122,8 +124,8 @@ std::vector<RealAlgebraicPoint<Number>> CAD<Number>::samples() const {
 	return s;
 }
 
-template<typename Number>
-void CAD<Number>::printSampleTree(std::ostream& os) const {
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::printSampleTree(std::ostream& os) const {
 	for (auto i = this->sampleTree.begin(); i != this->sampleTree.end(); i++) {
 		for (unsigned d = 0; d != this->sampleTree.depth(i); d++) {
 			os << " [";
@@ -133,8 +135,8 @@ void CAD<Number>::printSampleTree(std::ostream& os) const {
 	}
 }
 
-template<typename Number>
-void CAD<Number>::printConstraints(const std::string& filename) const {
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::printConstraints(const std::string& filename) const {
 	if( !mConstraints.empty() ){
 		std::ofstream smtlibFile;
 		smtlibFile.open(filename);
@@ -184,8 +186,8 @@ void CAD<Number>::printConstraints(const std::string& filename) const {
  * @param cad CAD object.
  * @return os.
  */
-template<typename Number>
-std::ostream& operator<<(std::ostream& os, const CAD<Number>& cad) {
+template<typename Number, typename SampleTree>
+std::ostream& operator<<(std::ostream& os, const CAD<Number, SampleTree>& cad) {
 	//os << endl << cad.getSetting() << endl;
 	os << "Variables: " << cad.mVariables << std::endl;
 	os << "Elimination sets:" << std::endl;
@@ -200,8 +202,8 @@ std::ostream& operator<<(std::ostream& os, const CAD<Number>& cad) {
 	return os;
 }
 
-template<typename Number>
-bool CAD<Number>::prepareElimination() {
+template<typename Number, typename SampleTree>
+bool CAD<Number, SampleTree>::prepareElimination() {
 	CARL_LOG_TRACE("carl.cad", __func__ << "()");
 	if (mVariables.newEmpty() && (!polynomials.hasScheduled() || mVariables.empty())) {
 		return false;
@@ -266,8 +268,8 @@ bool CAD<Number>::prepareElimination() {
 	return newVariableCount != 0;
 }
 
-template<typename Number>
-void CAD<Number>::clearElimination() {
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::clearElimination() {
 	this->iscomplete = false;
 	this->eliminationSets.front().clear();
 
@@ -276,11 +278,11 @@ void CAD<Number>::clearElimination() {
 }
 
 #ifdef __VS
-template<typename Number>
-void CAD<Number>::completeElimination(const typename CAD<Number>::BoundMap& bounds) {
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::completeElimination(const typename CAD<Number, SampleTree>::BoundMap& bounds) {
 #else
-template<typename Number>
-void CAD<Number>::completeElimination(const CAD<Number>::BoundMap& bounds) {
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::completeElimination(const CAD<Number, SampleTree>::BoundMap& bounds) {
 #endif
 	this->prepareElimination();
 	bool useBounds = !bounds.empty();
@@ -349,8 +351,8 @@ void CAD<Number>::completeElimination(const CAD<Number>::BoundMap& bounds) {
 	}
 }
 
-template<typename Number>
-void CAD<Number>::clear() {
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::clear() {
 	mVariables.clear();
 	this->sampleTree.clear();
 	// Add empty root node
@@ -362,18 +364,20 @@ void CAD<Number>::clear() {
 	this->interrupted = false;
 	this->interrupts.clear();
 	this->checkCallCount = 0;
+	mTrail.clear();
+	mCheckpoints.clear();
 }
 
-template<typename Number>
-void CAD<Number>::complete() {
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::complete() {
 	RealAlgebraicPoint<Number> r;
 	assert(mVariables.size() > 0);
 	std::vector<cad::Constraint<Number>> c(1, cad::Constraint<Number>(UPolynomial(mVariables.front(), MPolynomial(1)), Sign::ZERO, mVariables));
 	this->check(c, r, true);
 }
 
-template<typename Number>
-void CAD<Number>::tryEquationSeparation(bool useBounds, bool onlyStrictBounds) {
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::tryEquationSeparation(bool useBounds, bool onlyStrictBounds) {
 	bool hasEquations = false;
 	bool hasStrict = false;
 	bool hasWeak = false;
@@ -398,8 +402,8 @@ void CAD<Number>::tryEquationSeparation(bool useBounds, bool onlyStrictBounds) {
 }
 
 
-template<typename Number>
-cad::Answer CAD<Number>::check(
+template<typename Number, typename SampleTree>
+cad::Answer CAD<Number, SampleTree>::check(
 	std::vector<cad::Constraint<Number>>& _constraints,
 	RealAlgebraicPoint<Number>& r,
 	cad::ConflictGraph<Number>& conflictGraph,
@@ -532,11 +536,19 @@ cad::Answer CAD<Number>::check(
 	}
 
 	// call the main check function according to the settings
-	CARL_LOG_DEBUG("carl.cad", "Calling mainCheck...");
 	assert(this->sampleTree.isConsistent());
-	cad::Answer satisfiable = this->mainCheck(bounds, r, conflictGraph, next, useBounds, checkBounds);
+	cad::Answer satisfiable;
+	if (this->setting.liftingThreads > 1 && this->setting.integerHandling != cad::IntegerHandling::BACKTRACK) {
+		// backtracking on integral samples depends on the sample tree, hence it is left to mainCheck
+		CARL_LOG_DEBUG("carl.cad", "Calling parallelCheck...");
+		satisfiable = this->parallelCheck(bounds, r, conflictGraph, useBounds, checkBounds);
+		CARL_LOG_DEBUG("carl.cad", "parallelCheck returned " << satisfiable);
+	} else {
+		CARL_LOG_DEBUG("carl.cad", "Calling mainCheck...");
+		satisfiable = this->mainCheck(bounds, r, conflictGraph, next, useBounds, checkBounds);
+		CARL_LOG_DEBUG("carl.cad", "mainCheck returned " << satisfiable);
+	}
 	assert(this->sampleTree.isConsistent());
-	CARL_LOG_DEBUG("carl.cad", "mainCheck returned " << satisfiable);
 
 	if (useBounds) {
 		CARL_LOG_DEBUG("carl.cad", "Postprocess bounds");
@@ -599,8 +611,8 @@ cad::Answer CAD<Number>::check(
 	return satisfiable;
 }
 
-template<typename Number>
-void CAD<Number>::addPolynomial(const MPolynomial& p, const std::vector<Variable>& v) {
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::addPolynomial(const MPolynomial& p, const std::vector<Variable>& v) {
 	CARL_LOG_TRACE("carl.cad", __func__ << "( " << p << ", " << v << " )");
 	Variable var = v.front();
 	if (!mVariables.empty()) var = mVariables.first();
@@ -623,31 +635,116 @@ void CAD<Number>::addPolynomial(const MPolynomial& p, const std::vector<Variable
 	this->polynomials.schedule(p, up);
 
 	// determine the variables differing from mVariables and add them to the front of the existing variables
+	std::size_t newVariableCount = mVariables.newSize();
 	mVariables.complete(v);
+	if (!mCheckpoints.empty()) {
+		mTrail.push_back(TrailEntry{p, true});
+		mTrail.back().newVariables.assign(mVariables.getNew().begin() + long(newVariableCount), mVariables.getNew().end());
+	}
 }
 
-template<typename Number>
-void CAD<Number>::removePolynomial(const MPolynomial& polynomial) {
-	CARL_LOG_TRACE("carl.cad", __func__ << "( " << polynomial << " )");
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::removePolynomial(const MPolynomial& polynomial) {
+	this->removePolynomial(polynomial, !mCheckpoints.empty());
+}
+
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::removePolynomial(const MPolynomial& polynomial, bool record) {
+	CARL_LOG_TRACE("carl.cad", __func__ << "( " << polynomial << ", " << record << " )");
 
+	TrailEntry entry{polynomial, false};
+	if (record) {
+		entry.removed = polynomials.find(polynomial);
+		if (entry.removed == nullptr) return;
+		entry.wasScheduled = polynomials.isScheduled(entry.removed);
+		for (auto& es: this->eliminationSets) {
+			entry.removalCounts.push_back(es.removalCount());
+			es.recordRemovals(true);
+		}
+		mRecordedRemoval = &entry;
+	}
 	auto up = polynomials.removePolynomial(polynomial);
-	if (up == nullptr) return;
-
-	// determine the level of the polynomial (first level from the top) and remove the respective pointer from it
-	for (unsigned level = 0; level < this->eliminationSets.size(); level++) {
-		// transform the polynomial according to possible optimizations in order to recognize its real shape in the elimination set
-		//auto tmp = new UPolynomial(polynomial.pseudoPrimpart());
-		CARL_LOG_TRACE("carl.core", "Removing " << *up << " from " << this->eliminationSets[level]);
-		auto p = this->eliminationSets[level].find(up);
-		if (p != nullptr) {
-			this->removePolynomial(p, level);
-			return;
+	if (up != nullptr) {
+		// determine the level of the polynomial (first level from the top) and remove the respective pointer from it
+		for (unsigned level = 0; level < this->eliminationSets.size(); level++) {
+			// transform the polynomial according to possible optimizations in order to recognize its real shape in the elimination set
+			//auto tmp = new UPolynomial(polynomial.pseudoPrimpart());
+			CARL_LOG_TRACE("carl.core", "Removing " << *up << " from " << this->eliminationSets[level]);
+			auto p = this->eliminationSets[level].find(up);
+			if (p != nullptr) {
+				this->removePolynomial(p, level);
+				break;
+			}
+		}
+	}
+
+	if (record) {
+		for (auto& es: this->eliminationSets) {
+			es.recordRemovals(false);
 		}
+		mRecordedRemoval = nullptr;
+		mTrail.push_back(std::move(entry));
 	}
 }
 
-template<typename Number>
-void CAD<Number>::removePolynomial(const UPolynomial* p, unsigned level, bool childrenOnly) {
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::pop() {
+	assert(!mCheckpoints.empty());
+	CARL_LOG_TRACE("carl.cad", __func__ << "() undoing " << (mTrail.size() - mCheckpoints.back()) << " changes");
+	while (mTrail.size() > mCheckpoints.back()) {
+		TrailEntry& entry = mTrail.back();
+		if (entry.added) {
+			this->removePolynomial(entry.polynomial, false);
+			// variables introduced later were already removed, hence the ones of this entry are the first ones
+			for (const auto& v: entry.newVariables) {
+				this->removeVariable(v);
+			}
+		} else {
+			this->polynomials.restorePolynomial(entry.polynomial, entry.removed, entry.wasScheduled);
+			// levels for new variables are added in front of the existing ones
+			assert(entry.removalCounts.size() <= this->eliminationSets.size());
+			std::size_t offset = this->eliminationSets.size() - entry.removalCounts.size();
+			for (std::size_t level = 0; level < entry.removalCounts.size(); level++) {
+				auto& es = this->eliminationSets[level + offset];
+				es.restoreRemovals(entry.removalCounts[level]);
+				if (level < entry.liftingPositions.size()) {
+					es.restoreLiftingPositions(entry.liftingPositions[level]);
+				}
+			}
+			if (!entry.detached.empty()) {
+				// the reattached samples were not lifted on levels introduced since the removal
+				for (std::size_t level = 0; level < offset; level++) {
+					this->eliminationSets[level].resetLiftingPositionsFully();
+					this->eliminationSets[level].setLiftingPositionsReset();
+				}
+				auto restoreSample = [this](const RealAlgebraicNumber<Number>& sample, sampleIterator node) -> sampleIterator {
+					auto child = std::lower_bound(this->sampleTree.begin_children(node), this->sampleTree.end_children(node), sample);
+					if (child != this->sampleTree.end_children(node) && *child == sample) return child;
+					return this->storeSampleInTree(sample, node);
+				};
+				for (const auto& subtree: entry.detached) {
+					sampleIterator parent = this->sampleTree.begin();
+					for (const auto& sample: subtree.path) {
+						parent = restoreSample(sample, parent);
+					}
+					// parents[d] is the parent of the next sample with relative depth d
+					std::vector<sampleIterator> parents({ parent });
+					for (const auto& sample: subtree.samples) {
+						parents.erase(parents.begin() + long(sample.first) + 1, parents.end());
+						parents.push_back(restoreSample(sample.second, parents[sample.first]));
+					}
+				}
+				assert(this->sampleTree.isConsistent());
+			}
+		}
+		this->iscomplete = false;
+		mTrail.pop_back();
+	}
+	mCheckpoints.pop_back();
+}
+
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::removePolynomial(const UPolynomial* p, unsigned level, bool childrenOnly) {
 	// no equivalent polynomial for p in any level
 	if (p == nullptr) return;
 	CARL_LOG_FUNC("carl.cad", *p << ", " << level << ", " << childrenOnly);
@@ -695,6 +792,31 @@ void CAD<Number>::removePolynomial(const UPolynomial* p, unsigned level, bool ch
 			unsigned depth = dim - (unsigned)l;
 			assert(maxDepth <= this->sampleTree.max_depth());
 			if (depth <= maxDepth) {
+				if (mRecordedRemoval != nullptr && mRecordedRemoval->detached.empty() && this->sampleTree.begin_depth(depth) != this->sampleTree.end_depth()) {
+					// save the erased subtrees and the lifting positions of the levels below, such that pop() can restore them
+					for (auto node = this->sampleTree.begin_depth(depth); node != this->sampleTree.end_depth(); node++) {
+						DetachedSamples subtree;
+						sampleIterator parent = node;
+						for (unsigned d = 1; d < depth; d++) {
+							parent = this->sampleTree.get_parent(parent);
+							subtree.path.push_back(*parent);
+						}
+						std::reverse(subtree.path.begin(), subtree.path.end());
+						std::vector<std::pair<std::size_t, sampleIterator>> stack({ std::make_pair(std::size_t(0), sampleIterator(node)) });
+						while (!stack.empty()) {
+							auto cur = stack.back();
+							stack.pop_back();
+							subtree.samples.emplace_back(cur.first, *cur.second);
+							for (auto child = this->sampleTree.begin_children(cur.second); child != this->sampleTree.end_children(cur.second); child++) {
+								stack.emplace_back(cur.first + 1, child);
+							}
+						}
+						mRecordedRemoval->detached.push_back(std::move(subtree));
+					}
+					for (int below = 0; below < l; below++) {
+						mRecordedRemoval->liftingPositions.push_back(this->eliminationSets[(std::size_t)below].liftingPositions());
+					}
+				}
 				// erase all samples on this level
 				for (auto node = this->sampleTree.begin_depth(depth); node != this->sampleTree.end_depth(); ) {
 					node = this->sampleTree.erase(node);
@@ -706,8 +828,27 @@ void CAD<Number>::removePolynomial(const UPolynomial* p, unsigned level, bool ch
 	assert(this->sampleTree.isConsistent());
 }
 
-template<typename Number>
-std::vector<Interval<Number>> CAD<Number>::getBounds(const RealAlgebraicPoint<Number>& r) const {
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::removeVariable(Variable::Arg v) {
+	CARL_LOG_TRACE("carl.cad", __func__ << "( " << v << " )");
+	if (mVariables.removeNew(v)) return;
+	// the elimination level only contains polynomials stemming from the removed input polynomials
+	std::size_t level = mVariables.indexOf(v);
+	std::vector<const UPolynomial*> remaining(this->eliminationSets[level].getPolynomials().begin(), this->eliminationSets[level].getPolynomials().end());
+	for (const auto& p: remaining) {
+		this->removePolynomial(p, (unsigned)level);
+	}
+	std::size_t depth = mVariables.size() - level;
+	for (auto node = this->sampleTree.begin_depth(depth); node != this->sampleTree.end_depth(); ) {
+		node = this->sampleTree.erase(node);
+	}
+	this->eliminationSets.erase(this->eliminationSets.begin() + long(level));
+	mVariables.removeCurrent(level);
+	assert(this->sampleTree.isConsistent());
+}
+
+template<typename Number, typename SampleTree>
+std::vector<Interval<Number>> CAD<Number, SampleTree>::getBounds(const RealAlgebraicPoint<Number>& r) const {
 	std::vector<Interval<Number>> bounds(mVariables.size());
 	// initially, parent is the root
 	auto parent = this->sampleTree.begin();
@@ -730,8 +871,8 @@ std::vector<Interval<Number>> CAD<Number>::getBounds(const RealAlgebraicPoint<Nu
 	return bounds;
 }
 
-template<typename Number>
-cad::SampleSet<Number> CAD<Number>::samples(
+template<typename Number, typename SampleTree>
+cad::SampleSet<Number> CAD<Number, SampleTree>::samples(
 		std::size_t openVariableCount,
 		const std::list<RealAlgebraicNumber<Number>>& roots,
 		cad::SampleSet<Number>& currentSamples,
@@ -824,8 +965,8 @@ cad::SampleSet<Number> CAD<Number>::samples(
 	return newSampleSet;
 }
 
-template<typename Number>
-cad::SampleSet<Number> CAD<Number>::samples(
+template<typename Number, typename SampleTree>
+cad::SampleSet<Number> CAD<Number, SampleTree>::samples(
 		std::size_t openVariableCount,
 		const UPolynomial* p,
 		sampleIterator node,
@@ -863,9 +1004,9 @@ cad::SampleSet<Number> CAD<Number>::samples(
 	}
 }
 
-template<typename Number>
+template<typename Number, typename SampleTree>
 template<class VariableIterator, class PolynomialIterator>
-std::vector<Variable> CAD<Number>::orderVariablesGreedily(
+std::vector<Variable> CAD<Number, SampleTree>::orderVariablesGreedily(
 		VariableIterator firstVariable,
 		VariableIterator lastVariable,
 		PolynomialIterator firstPolynomial,
@@ -907,8 +1048,8 @@ std::vector<Variable> CAD<Number>::orderVariablesGreedily(
 	return variableOrder;
 }
 
-template<typename Number>
-void CAD<Number>::alterSetting(const cad::CADSettings& _setting) {
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::alterSetting(const cad::CADSettings& _setting) {
 	// settings that require re-computation
 	if (_setting.order != this->setting.order) {
 		// switch the order relation in all elimination sets
@@ -930,8 +1071,8 @@ void CAD<Number>::alterSetting(const cad::CADSettings& _setting) {
 	this->setting = _setting;
 }
 
-template<typename Number>
-std::list<RealAlgebraicNumber<Number>> CAD<Number>::constructSampleAt(sampleIterator node, const sampleIterator& root) const {
+template<typename Number, typename SampleTree>
+std::list<RealAlgebraicNumber<Number>> CAD<Number, SampleTree>::constructSampleAt(sampleIterator node, const sampleIterator& root) const {
 	/* Main sample construction loop macro augmented by a conditional argument for termination with an empty sample.
 	 * @param _condition which has to be false for every node of the sample, otherwise an empty list is returned
 	 */
@@ -967,8 +1108,8 @@ std::list<RealAlgebraicNumber<Number>> CAD<Number>::constructSampleAt(sampleIter
 	return v;
 }
 
-template<typename Number>
-typename CAD<Number>::CheckNodeResult CAD<Number>::checkNode(
+template<typename Number, typename SampleTree>
+typename CAD<Number, SampleTree>::CheckNodeResult CAD<Number, SampleTree>::checkNode(
 		sampleIterator node,
 		bool fullRestart,
 		bool excludePrevious,
@@ -1049,8 +1190,8 @@ typename CAD<Number>::CheckNodeResult CAD<Number>::checkNode(
 	return CNR_FALSE;
 }
 
-template<typename Number>
-cad::Answer CAD<Number>::mainCheck(
+template<typename Number, typename SampleTree>
+cad::Answer CAD<Number, SampleTree>::mainCheck(
 		BoundMap& bounds,
 		RealAlgebraicPoint<Number>& r,
 		cad::ConflictGraph<Number>& conflictGraph,
@@ -1129,7 +1270,7 @@ cad::Answer CAD<Number>::mainCheck(
 		}
 	} else {
 		CARL_LOG_TRACE("carl.cad", "maxDepth != 0, maxDepth = " << maxDepth);
-		std::vector<typename Tree::template LeafIterator<false>> leafs;
+		std::vector<LeafIterator> leafs;
 		for (auto it = this->sampleTree.begin_leaf(); it != this->sampleTree.end_leaf(); it++) leafs.push_back(it);
 		typename cad::SampleSet<Number>::SampleComparator comp(setting.sampleOrdering);
 		//std::cout << "Before:";
@@ -1296,8 +1437,8 @@ cad::Answer CAD<Number>::mainCheck(
 }
 
 
-template<typename Number>
-typename CAD<Number>::sampleIterator CAD<Number>::storeSampleInTree(RealAlgebraicNumber<Number> newSample, sampleIterator node) {
+template<typename Number, typename SampleTree>
+typename CAD<Number, SampleTree>::sampleIterator CAD<Number, SampleTree>::storeSampleInTree(RealAlgebraicNumber<Number> newSample, sampleIterator node) {
 	CARL_LOG_FUNC("carl.cad", newSample << ", " << *node);
 	auto newNode = std::lower_bound(this->sampleTree.begin_children(node), this->sampleTree.end_children(node), newSample);
 	if (newNode == this->sampleTree.end_children(node)) {
@@ -1314,8 +1455,8 @@ typename CAD<Number>::sampleIterator CAD<Number>::storeSampleInTree(RealAlgebrai
 	return newNode;
 }
 
-template<typename Number>
-cad::Answer CAD<Number>::baseLiftCheck(
+template<typename Number, typename SampleTree>
+cad::Answer CAD<Number, SampleTree>::baseLiftCheck(
 		sampleIterator node,
 		RealAlgebraicPoint<Number>& r,
 		cad::ConflictGraph<Number>& conflictGraph
@@ -1341,8 +1482,8 @@ cad::Answer CAD<Number>::baseLiftCheck(
 	return cad::Answer::False;
 }
 
-template<typename Number>
-cad::Answer CAD<Number>::partialLiftCheck(
+template<typename Number, typename SampleTree>
+cad::Answer CAD<Number, SampleTree>::partialLiftCheck(
 		sampleIterator node,
 		cad::ConflictGraph<Number>& conflictGraph
 ) {
@@ -1360,8 +1501,8 @@ cad::Answer CAD<Number>::partialLiftCheck(
 	return cad::Answer::False;
 }
 
-template<typename Number>
-cad::Answer CAD<Number>::liftCheck(
+template<typename Number, typename SampleTree>
+cad::Answer CAD<Number, SampleTree>::liftCheck(
 		sampleIterator node,
 		std::size_t openVariableCount,
 		bool restartLifting,
@@ -1636,8 +1777,215 @@ cad::Answer CAD<Number>::liftCheck(
 	return cad::Answer::False;
 }
 
-template<typename Number>
-int CAD<Number>::eliminate(std::size_t level, const BoundMap& bounds, bool boundsActive) {
+template<typename Number, typename SampleTree>
+cad::Answer CAD<Number, SampleTree>::parallelCheck(
+		const BoundMap& bounds,
+		RealAlgebraicPoint<Number>& r,
+		cad::ConflictGraph<Number>& conflictGraph,
+		bool boundsActive,
+		bool checkBounds
+) {
+	CARL_LOG_TRACE("carl.cad", __func__ << "( " << mConstraints << ", " << bounds << " )");
+	assert(this->sampleTree.isConsistent());
+	if (mVariables.empty()) {
+		if (mConstraints.empty()) return cad::Answer::True;
+		else return cad::Answer::False;
+	}
+
+	// the samples are constructed from all elimination polynomials
+	for (std::size_t l = 1; l < this->eliminationSets.size(); l++) {
+		while (	!this->eliminationSets[l-1].emptySingleEliminationQueue() ||
+				!this->eliminationSets[l-1].emptyPairedEliminationQueue()) {
+			this->eliminationSets[l-1].eliminateNextInto(this->eliminationSets[l], mVariables[l], this->setting, false);
+			this->iscomplete = false;
+		}
+	}
+	// a complete sample tree is only traversed, new lifting positions or bounds require lifting
+	bool lift = !this->iscomplete || boundsActive;
+	for (const auto& es: this->eliminationSets) {
+		if (!es.emptyLiftingQueue()) lift = true;
+	}
+
+#ifdef THREAD_SAFE
+	std::size_t threads = this->setting.liftingThreads;
+#else
+	CARL_LOG_DEBUG("carl.cad", "Parallel lifting needs THREAD_SAFE, lifting sequentially.");
+	std::size_t threads = 1;
+#endif
+	std::atomic_bool found(false);
+	std::mutex conflictGraphMutex;
+	std::mutex treeMutex;
+	ParallelLifting state{nullptr, 0, nullptr, &found, &conflictGraphMutex, &treeMutex, lift, threads};
+	std::vector<RealAlgebraicNumber<Number>> sample;
+	cad::Answer answer = this->parallelLiftCheck(this->sampleTree.begin(), sample, mVariables.size(), bounds, boundsActive, checkBounds, r, conflictGraph, state);
+	assert(this->sampleTree.isConsistent());
+	if (answer != cad::Answer::True && this->anAnswerFound()) {
+		// as in liftCheck(), an interruption is reported as a satisfying answer
+		this->interrupted = true;
+		return cad::Answer::True;
+	}
+	if (answer == cad::Answer::False && !boundsActive) {
+		// every node was lifted with all elimination polynomials, as mainCheck() does when it completes the sample tree
+		this->iscomplete = true;
+		for (auto& es: this->eliminationSets) {
+			while (!es.emptyLiftingQueue()) es.popLiftingPosition();
+			es.setLiftingPositionsReset();
+		}
+	}
+	return answer;
+}
+
+template<typename Number, typename SampleTree>
+cad::Answer CAD<Number, SampleTree>::parallelLiftCheck(
+		sampleIterator node,
+		std::vector<RealAlgebraicNumber<Number>>& sample,
+		std::size_t openVariableCount,
+		const BoundMap& bounds,
+		bool boundsActive,
+		bool checkBounds,
+		RealAlgebraicPoint<Number>& r,
+		cad::ConflictGraph<Number>& conflictGraph,
+		const ParallelLifting& state
+) {
+	if (this->parallelLiftingCancelled(state)) return cad::Answer::False;
+
+	// base level: evaluate the constraints as in baseLiftCheck()
+	if (openVariableCount == 0) {
+		RealAlgebraicPoint<Number> t(sample);
+		if (this->setting.computeConflictGraph) {
+			std::vector<bool> satisfied;
+			for (const auto& c: mConstraints) {
+				satisfied.push_back(c.satisfiedBy(t, getVariables()));
+			}
+			std::lock_guard<std::mutex> guard(*state.conflictGraphMutex);
+			std::size_t sampleID = conflictGraph.newSample();
+			auto sit = satisfied.begin();
+			for (const auto& c: mConstraints) {
+				conflictGraph.set(conflictGraph.getConstraint(c), sampleID, !*sit);
+				sit++;
+			}
+			if (std::find(satisfied.begin(), satisfied.end(), false) != satisfied.end()) return cad::Answer::False;
+		} else if (!mConstraints.satisfiedBy(t, getVariables())) {
+			return cad::Answer::False;
+		}
+		r = t;
+		return cad::Answer::True;
+	}
+
+	openVariableCount--;
+	auto bound = boundsActive ? bounds.find(openVariableCount) : bounds.end();
+	bool boundActive = bounds.end() != bound;
+
+	if (state.lift) {
+		// construct the same initial samples as liftCheck(), merged with the samples already stored at this node
+		cad::SampleSet<Number> currentSamples(setting.sampleOrdering);
+		{
+			std::lock_guard<std::mutex> guard(*state.treeMutex);
+			for (auto it = this->sampleTree.begin_children(node); it != this->sampleTree.end_children(node); it++) {
+				currentSamples.insert(detachSample(*it));
+			}
+		}
+		cad::SampleSet<Number> newSamples(setting.sampleOrdering);
+		std::forward_list<RealAlgebraicNumber<Number>> replacedSamples;
+		std::forward_list<RealAlgebraicNumber<Number>> allReplacedSamples;
+		if (boundActive) {
+			std::list<RealAlgebraicNumber<Number>> boundRoots;
+			if (bound->second.lowerBoundType() != BoundType::INFTY) {
+				boundRoots.push_back(RealAlgebraicNumber<Number>(bound->second.lower(), true));
+			}
+			if (bound->second.upperBoundType() != BoundType::INFTY) {
+				boundRoots.push_back(RealAlgebraicNumber<Number>(bound->second.upper(), true));
+			}
+			if (boundRoots.empty()) {
+				boundRoots.push_back(RealAlgebraicNumber<Number>(carl::center(bound->second), true));
+			}
+			newSamples.insert(this->samples(openVariableCount, boundRoots, currentSamples, replacedSamples));
+		} else {
+			newSamples.insert(this->samples(openVariableCount, {RealAlgebraicNumber<Number>(0, true)}, currentSamples, replacedSamples));
+		}
+		allReplacedSamples.splice_after(allReplacedSamples.before_begin(), replacedSamples);
+
+		// add the samples for every elimination polynomial of this level
+		std::map<Variable, RealAlgebraicNumber<Number>> m;
+		for (std::size_t i = 0; i < sample.size(); i++) {
+			m[mVariables[openVariableCount + 1 + i]] = sample[i];
+		}
+		Interval<Number> rootBounds = Interval<Number>::unboundedInterval();
+		if (boundActive && this->setting.earlyLiftingPruningByBounds) {
+			rootBounds = bound->second;
+		}
+		for (const auto& p: this->eliminationSets[openVariableCount].getPolynomials()) {
+			if (this->parallelLiftingCancelled(state)) return cad::Answer::False;
+			auto roots = carl::rootfinder::realRoots(*p, m, rootBounds, this->setting.splittingStrategy);
+			if (roots.empty()) {
+				newSamples.insert(this->samples(openVariableCount, { RealAlgebraicNumber<Number>(0) }, currentSamples, replacedSamples, rootBounds));
+			} else {
+				newSamples.insert(this->samples(openVariableCount, std::list<RealAlgebraicNumber<Number>>(roots.begin(), roots.end()), currentSamples, replacedSamples, rootBounds));
+			}
+			allReplacedSamples.splice_after(allReplacedSamples.before_begin(), replacedSamples);
+		}
+
+		// store the new samples below this node, which no other task modifies
+		std::lock_guard<std::mutex> guard(*state.treeMutex);
+		for (const auto& replacedSample: allReplacedSamples) {
+			this->storeSampleInTree(replacedSample, node);
+		}
+		for (; !newSamples.empty(); newSamples.pop()) {
+			this->storeSampleInTree(newSamples.next(), node);
+		}
+	}
+
+	// every task claims the subtree of one child and gets its own copy of the sample
+	std::vector<std::pair<sampleIterator, std::vector<RealAlgebraicNumber<Number>>>> children;
+	{
+		std::lock_guard<std::mutex> guard(*state.treeMutex);
+		for (auto it = this->sampleTree.begin_children(node); it != this->sampleTree.end_children(node); it++) {
+			children.emplace_back(sampleIterator(it), std::vector<RealAlgebraicNumber<Number>>());
+			children.back().second.push_back(detachSample(*it));
+		}
+	}
+	for (auto it = children.begin(); it != children.end(); ) {
+		const auto& s = it->second.front();
+		if ((checkBounds && boundActive && !s.containedIn(bound->second)) || (this->setting.ignoreRoots && s.isRoot() && !s.isIntegral())) {
+			it = children.erase(it);
+			continue;
+		}
+		for (const auto& component: sample) {
+			it->second.push_back(detachSample(component));
+		}
+		it++;
+	}
+	// order the samples according to the sample ordering, as SampleSet::next() does
+	typename cad::SampleSet<Number>::SampleComparator comp(setting.sampleOrdering);
+	std::stable_sort(children.begin(), children.end(), [&comp](const auto& lhs, const auto& rhs){
+		return comp(rhs.second.front(), lhs.second.front());
+	});
+	CARL_LOG_DEBUG("carl.cad", "Lifting " << children.size() << " samples for " << mVariables[openVariableCount] << " in parallel");
+
+	// lift the samples concurrently
+	std::vector<cad::Answer> answers(children.size(), cad::Answer::False);
+	std::vector<RealAlgebraicPoint<Number>> points(children.size());
+	std::atomic<std::size_t> firstSatisfying(children.size());
+	WorkStealingPool::shared().parallelFor(children.size(), [&](std::size_t i){
+		ParallelLifting childState{&state, i, &firstSatisfying, state.found, state.conflictGraphMutex, state.treeMutex, state.lift, state.threads};
+		answers[i] = this->parallelLiftCheck(children[i].first, children[i].second, openVariableCount, bounds, boundsActive, checkBounds, points[i], conflictGraph, childState);
+		if (answers[i] == cad::Answer::True) {
+			*state.found = true;
+			std::size_t first = firstSatisfying.load();
+			while (i < first && !firstSatisfying.compare_exchange_weak(first, i));
+		}
+	}, state.threads);
+	for (std::size_t i = 0; i < children.size(); i++) {
+		if (answers[i] == cad::Answer::True) {
+			r = std::move(points[i]);
+			return cad::Answer::True;
+		}
+	}
+	return cad::Answer::False;
+}
+
+template<typename Number, typename SampleTree>
+int CAD<Number, SampleTree>::eliminate(std::size_t level, const BoundMap& bounds, bool boundsActive) {
 	CARL_LOG_FUNC("carl.cad.elimination", level << ", " << bounds);
 	while (true) {
 		if (!this->eliminationSets[level].emptyLiftingQueue()) return (int)level;
@@ -1716,8 +2064,8 @@ int CAD<Number>::eliminate(std::size_t level, const BoundMap& bounds, bool bound
 	}
 }
 
-template<typename Number>
-Interval<Number> CAD<Number>::getBounds(const typename CAD<Number>::sampleIterator& parent, const RealAlgebraicNumber<Number> sample) const {
+template<typename Number, typename SampleTree>
+Interval<Number> CAD<Number, SampleTree>::getBounds(const typename CAD<Number, SampleTree>::sampleIterator& parent, const RealAlgebraicNumber<Number> sample) const {
 	if (this->sampleTree.begin(parent) == this->sampleTree.end(parent)) {
 		// this tree level is empty
 		return Interval<Number>::unboundedExactInterval();
@@ -1781,12 +2129,12 @@ Interval<Number> CAD<Number>::getBounds(const typename CAD<Number>::sampleIterat
 	}
 }
 
-template<typename Number>
-void CAD<Number>::widenBounds(BoundMap&) {
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::widenBounds(BoundMap&) {
 }
 
-template<typename Number>
-void CAD<Number>::shrinkBounds(BoundMap& bounds, const RealAlgebraicPoint<Number>& r) {
+template<typename Number, typename SampleTree>
+void CAD<Number, SampleTree>::shrinkBounds(BoundMap& bounds, const RealAlgebraicPoint<Number>& r) {
 	// the size of variables should be compatible to the dimension of the given point
 	assert(this->anAnswerFound() || mVariables.size() == r.dim());
 
@@ -1822,8 +2170,8 @@ void CAD<Number>::shrinkBounds(BoundMap& bounds, const RealAlgebraicPoint<Number
 	}
 }
 
-template<typename Number>
-bool CAD<Number>::vanishesInBox(const UPolynomial* p, const BoundMap& box, std::size_t level, bool recuperate) {
+template<typename Number, typename SampleTree>
+bool CAD<Number, SampleTree>::vanishesInBox(const UPolynomial* p, const BoundMap& box, std::size_t level, bool recuperate) {
 	cad::CADSettings boxSetting = cad::CADSettings::getSettings();
 	boxSetting.simplifyEliminationByBounds = false; // would cause recursion in vanishesInBox
 	boxSetting.earlyLiftingPruningByBounds = true; // important for efficiency
@@ -1849,7 +2197,7 @@ bool CAD<Number>::vanishesInBox(const UPolynomial* p, const BoundMap& box, std::
 
 	// optimization for equations not valid in general
 	boxSetting.equationsOnly = vars.size() <= 1;
-	CAD<Number> cadbox(static_cast<cad::PolynomialOwner<Number>*>(&this->polynomials));
+	CAD<Number, SampleTree> cadbox(static_cast<cad::PolynomialOwner<Number>*>(&this->polynomials));
 	CARL_LOG_INFO("carl.core", "Now in nested CAD " << &cadbox);
 	cadbox.polynomials.schedule(p, false);
 	cadbox.mVariables.setNewVariables(vars);
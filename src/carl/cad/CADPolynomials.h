@@ -68,6 +68,27 @@ public:
 		return polynomials;
 	}
 	
+	/**
+	 * Returns the univariate polynomial that is used internally for the given input polynomial, or nullptr if there is none.
+	 */
+	const UPolynomial* find(const MPolynomial& p) const {
+		auto it = map.find(p);
+		if (it == map.end()) return nullptr;
+		return it->second;
+	}
+
+	/**
+	 * Undoes removePolynomial().
+	 * @param p Input polynomial.
+	 * @param up The polynomial that was returned by removePolynomial().
+	 * @param wasScheduled Flag indicating that up was scheduled when it was removed.
+	 */
+	void restorePolynomial(const MPolynomial& p, const UPolynomial* up, bool wasScheduled) {
+		map[p] = up;
+		if (wasScheduled) scheduled.push_back(up);
+		else polynomials.push_back(up);
+	}
+	
 	const UPolynomial* removePolynomial(const MPolynomial& p) {
 		auto it = map.find(p);
 		if (it == map.end()) return nullptr;
@@ -10,6 +10,7 @@
 
 #include "../core/logging.h"
 #include "../core/carlLogging.h"
+#include "../core/polynomialfunctions/Resultant.h"
 #include "../core/rootfinder/RootFinder.h"
 
 namespace carl {
@@ -150,6 +151,14 @@ public:
 	PolynomialComparisonOrder order;
 	/// standard strategy to be used for real root isolation
 	rootfinder::SplittingStrategy splittingStrategy;
+	/// strategy used for the resultants and discriminants of the projection
+	SubresultantStrategy subresultantStrategy;
+	/// number of threads computing the projections of a single elimination step concurrently (only effective if carl was built with THREAD_SAFE)
+	std::size_t eliminationThreads;
+	/// number of threads lifting independent subtrees of the sample tree concurrently (only effective if carl was built with THREAD_SAFE, see CAD::parallelCheck)
+	std::size_t liftingThreads;
+	/// flag indicating that the parallel lifting returns the first satisfying sample with respect to sampleOrdering instead of the first one found
+	bool deterministicLifting;
 
 	/**
 	 * Generate a CADSettings instance of the respective preset type.
@@ -250,6 +259,12 @@ public:
 			settingStrs.push_back( "Given bounds to the check method, these bounds are used to cancel out elimination polynomials." );
 		if (settings.improveBounds)
 			settingStrs.push_back( "Given bounds to the check method, the bounds are widened after determining unsatisfiability by check, or shrunk after determining satisfiability by check." );
+		if (settings.subresultantStrategy == SubresultantStrategy::Modular)
+			settingStrs.push_back( "Compute resultants and discriminants by modular arithmetic." );
+		if (settings.eliminationThreads > 1)
+			settingStrs.push_back( "Compute the projections of every elimination step with " + std::to_string(settings.eliminationThreads) + " threads." );
+		if (settings.liftingThreads > 1)
+			settingStrs.push_back( "Lift independent subtrees of the sample tree with " + std::to_string(settings.liftingThreads) + " threads" + (settings.deterministicLifting ? ", deterministically." : ".") );
 		std::string orderStr = "Polynomial order: ";
 
 		if (settings.order == PolynomialComparisonOrder::CauchyBound)
@@ -293,7 +308,11 @@ private:
 		ignoreRoots(false),
 		integerHandling(IntegerHandling::SPLIT_ASSIGNMENT),
 		order(PolynomialComparisonOrder::Default),
-		splittingStrategy(rootfinder::SplittingStrategy::DEFAULT)
+		splittingStrategy(rootfinder::SplittingStrategy::DEFAULT),
+		subresultantStrategy(SubresultantStrategy::Default),
+		eliminationThreads(1),
+		liftingThreads(1),
+		deterministicLifting(false)
 	{}
 
 public:
@@ -319,7 +338,11 @@ public:
 		ignoreRoots(s.ignoreRoots),
 		integerHandling(s.integerHandling),
 		order(PolynomialComparisonOrder::Default),
-		splittingStrategy(rootfinder::SplittingStrategy::DEFAULT)
+		splittingStrategy(rootfinder::SplittingStrategy::DEFAULT),
+		subresultantStrategy(s.subresultantStrategy),
+		eliminationThreads(s.eliminationThreads),
+		liftingThreads(s.liftingThreads),
+		deterministicLifting(s.deterministicLifting)
 	{}
 };
 
@@ -111,12 +111,12 @@ public:
 	bool satisfiedBy(const RealAlgebraicPoint<Number>& r, const std::vector<Variable>& _variables) const {
 		assert(_variables.size() == r.dim());
 		
-		auto res = RealAlgebraicNumberEvaluation::evaluate(this->polynomial, r, _variables);
-		CARL_LOG_DEBUG("carl.cad.constraint", *this << " evaluates to " << res << " on " << r);
+		Sign res = RealAlgebraicNumberEvaluation::sgn(this->polynomial, r, _variables);
+		CARL_LOG_DEBUG("carl.cad.constraint", *this << " has sign " << res << " on " << r);
 		if (this->negated) {
-			return res.sgn() != this->sign;
+			return res != this->sign;
 		} else {
-			return res.sgn() == this->sign;
+			return res == this->sign;
 		}
 	}
 
@@ -6,15 +6,19 @@
 
 #pragma once
 
+#include <array>
 #include <forward_list>
 #include <list>
 #include <memory>
 #include <set>
+#include <tuple>
 #include <utility>
 #include <unordered_map>
 #include <unordered_set>
 
+#include "../config.h"
 #include "../util/pointerOperations.h"
+#include "../util/WorkStealingPool.h"
 #include "../core/UnivariatePolynomial.h"
 #include "../core/logging.h"
 
@@ -140,12 +144,36 @@ private:
 	PolynomialComparator liftingOrder;
 
 	ProjectionType projectionType = ProjectionType::Brown;
-	ProjectionOperator<const UPolynomial*> projection;
+	/**
+	 * Computes a projection with the subresultant strategy given by setting.
+	 */
 	template<typename... Args>
-	void project(Args&&... args) const {
+	void project(const CADSettings& setting, Args&&... args) const {
+		ProjectionOperator<const UPolynomial*> projection;
+		projection.subresultantStrategy = setting.subresultantStrategy;
 		projection(projectionType, std::forward<Args>(args)...);
 	}
 
+	/**
+	 * Collects the results of a projection instead of inserting them, such that projections can be computed concurrently.
+	 */
+	struct ProjectionRecorder {
+		std::vector<std::tuple<UPolynomial, std::list<const UPolynomial*>, bool>> results;
+		void insert(const UPolynomial& r, const std::list<const UPolynomial*>& parents, bool avoidSingle) {
+			results.emplace_back(r, parents, avoidSingle);
+		}
+	};
+
+	/**
+	 * Computes the given projections and inserts the results into destination.
+	 * A pair whose second entry is nullptr denotes the projection of a single polynomial.
+	 *
+	 * If setting.eliminationThreads is larger than one, the projections are computed concurrently on a WorkStealingPool.
+	 * The results are inserted in the order of the projections afterwards, hence destination is the same as with a single thread.
+	 * As polynomial arithmetic is not thread-safe otherwise, the projections are only computed concurrently if carl was built with THREAD_SAFE.
+	 */
+	void projectAll(const std::vector<PolynomialPair>& projections, Variable::Arg variable, EliminationSet<Coefficient>& destination, const CADSettings& setting) const;
+
 	/**
 	 * Elimination queue containing all polynomials not yet considered for non-paired elimination.
 	 * Access permits reset of the queue, automatic update after insertion of new elements and a pop method.
@@ -172,6 +200,32 @@ private:
 	/// assigns to each elimination polynomial its parents
 	parentbucket_map parentsPerChild;
 
+	/**
+	 * Undo information for a modification made by erase() or removeByParent().
+	 */
+	struct Removal {
+		/// Polynomial that was erased or lost some of its parents or children.
+		const UPolynomial* polynomial;
+		/// Parents that were removed from polynomial.
+		parentbucket parents;
+		/// Children that were removed from polynomial.
+		PolynomialSet children;
+		/// Flag indicating that polynomial itself was removed.
+		bool erased = false;
+		/// Flags indicating the queues polynomial was removed from: lifting, lifting reset, single elimination, paired elimination.
+		std::array<bool,4> queues = {{ false, false, false, false }};
+	};
+	/// Modifications made by erase() and removeByParent() while mRecordRemovals is set.
+	std::vector<Removal> mRemovals;
+	/// Flag indicating that modifications are recorded in mRemovals.
+	bool mRecordRemovals = false;
+
+	/**
+	 * Removes p from all queues.
+	 * @return Flags indicating the queues p was contained in, in the order of Removal::queues.
+	 */
+	std::array<bool,4> eraseFromQueues(const UPolynomial* p);
+
 	/**
 	 * Ownership of all polynomials created within this object are delegated to the polynomialOwner.
 	 */
@@ -371,6 +425,39 @@ public:
 	 * Remove every data from this set.
 	 */
 	void clear();
+
+	/**
+	 * Starts or stops recording the modifications done by erase() and removeByParent(), such that they can be undone by restoreRemovals().
+	 * @param record
+	 */
+	void recordRemovals(bool record) {
+		mRecordRemovals = record;
+	}
+
+	/**
+	 * @return Number of recorded modifications.
+	 */
+	std::size_t removalCount() const {
+		return mRemovals.size();
+	}
+
+	/**
+	 * Undoes the recorded modifications in reverse order until only count of them are left.
+	 * Polynomials that are already present in this set are not inserted again, but only get their parents back.
+	 * Polynomials that are inserted again are put in both lifting queues, as samples computed since their removal were not lifted with them.
+	 * @param count
+	 * @complexity linear in the number of modifications undone and the sizes of the queues involved
+	 */
+	void restoreRemovals(std::size_t count);
+
+	/**
+	 * Takes the recorded modifications of s, which is about to be replaced by this set.
+	 * @param s
+	 */
+	void takeRemovals(EliminationSet<Coefficient>& s) {
+		std::swap(mRemovals, s.mRemovals);
+		mRecordRemovals = s.mRecordRemovals;
+	}
 	
 	/////////////////////////////////
 	// LIFTING POSITION MANAGEMENT //
@@ -440,6 +527,31 @@ public:
 	void setLiftingPositionsReset() {
 		this->mLiftingQueueReset = this->mLiftingQueue;
 	}
+
+	/**
+	 * Lifting positions of an elimination set together with its polynomials, as returned by liftingPositions().
+	 */
+	struct LiftingPositions {
+		PolynomialSet polynomials;
+		std::list<const UPolynomial*> queue;
+		std::list<const UPolynomial*> queueReset;
+	};
+
+	/**
+	 * @return the current lifting positions and polynomials, such that they can be restored by restoreLiftingPositions()
+	 * @complexity linear in the number of polynomials stored
+	 */
+	LiftingPositions liftingPositions() const {
+		return LiftingPositions{ this->polynomials, this->mLiftingQueue, this->mLiftingQueueReset };
+	}
+
+	/**
+	 * Merges the lifting positions returned by liftingPositions() into the current ones, such that samples of both times are lifted with all polynomials they were not lifted with.
+	 * A polynomial stays in a queue if it is contained in the current or the saved queue, or if it was not present back then.
+	 * @param positions Lifting positions to restore.
+	 * @complexity linear in the number of polynomials stored and the sizes of the queues involved
+	 */
+	void restoreLiftingPositions(const LiftingPositions& positions);
 	
 	/////////////////////////////////////
 	// ELIMINATION POSITION MANAGEMENT //
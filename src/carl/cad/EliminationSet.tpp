@@ -187,6 +187,15 @@ template<typename Coefficient>
 size_t EliminationSet<Coefficient>::erase(const UPolynomial* p) {
 	if (p == nullptr) return 0;
 
+	auto position = this->polynomials.find(p);
+	if (position == this->polynomials.end()) return 0;
+	if (mRecordRemovals) {
+		mRemovals.emplace_back();
+		mRemovals.back().polynomial = *position;
+		mRemovals.back().erased = true;
+		auto parents = this->parentsPerChild.find(p);
+		if (parents != this->parentsPerChild.end()) mRemovals.back().parents = parents->second;
+	}
 	// remove the child for each parent from the children mapping
 	for (auto i:  this->parentsPerChild[p]) {
 		if (i.first != nullptr) this->childrenPerParent[i.first].erase( p );
@@ -195,22 +204,70 @@ size_t EliminationSet<Coefficient>::erase(const UPolynomial* p) {
 	// remove the child from the parents mapping
 	this->parentsPerChild.erase(p);
 	// remove from lifting and elimination queues
-	auto queuePosition = std::lower_bound(this->mLiftingQueue.begin(), this->mLiftingQueue.end(), p, this->liftingOrder);
+	auto queues = eraseFromQueues(p);
+	if (mRecordRemovals) mRemovals.back().queues = queues;
+	// remove from main structure
+	return this->polynomials.erase(p);
+}
 
+template<typename Coefficient>
+std::array<bool,4> EliminationSet<Coefficient>::eraseFromQueues(const UPolynomial* p) {
+	std::array<bool,4> res = {{ false, false, false, false }};
+	auto queuePosition = std::lower_bound(this->mLiftingQueue.begin(), this->mLiftingQueue.end(), p, this->liftingOrder);
 	if (queuePosition != this->mLiftingQueue.end() && *queuePosition == p ) {
 		this->mLiftingQueue.erase(queuePosition);
+		res[0] = true;
 	}
 	queuePosition = std::lower_bound(mLiftingQueueReset.begin(), mLiftingQueueReset.end(), p, this->liftingOrder);
-	if( queuePosition != mLiftingQueueReset.end() && *queuePosition == p )
+	if( queuePosition != mLiftingQueueReset.end() && *queuePosition == p ) {
 		mLiftingQueueReset.erase( queuePosition );
+		res[1] = true;
+	}
 	queuePosition = std::lower_bound(mSingleEliminationQueue.begin(), mSingleEliminationQueue.end(), p, this->eliminationOrder);
-	if( queuePosition != mSingleEliminationQueue.end() && *queuePosition == p )
+	if( queuePosition != mSingleEliminationQueue.end() && *queuePosition == p ) {
 		mSingleEliminationQueue.erase(queuePosition);
+		res[2] = true;
+	}
 	queuePosition = std::lower_bound(mPairedEliminationQueue.begin(), mPairedEliminationQueue.end(), p, this->eliminationOrder);
-	if( queuePosition != mPairedEliminationQueue.end() && *queuePosition == p )
+	if( queuePosition != mPairedEliminationQueue.end() && *queuePosition == p ) {
 		mPairedEliminationQueue.erase(queuePosition);
-	// remove from main structure
-	return this->polynomials.erase(p);
+		res[3] = true;
+	}
+	return res;
+}
+
+template<typename Coefficient>
+void EliminationSet<Coefficient>::restoreRemovals(std::size_t count) {
+	assert(count <= mRemovals.size());
+	auto insertSorted = [](std::list<const UPolynomial*>& queue, const UPolynomial* p, const PolynomialComparator& order) {
+		queue.insert(std::lower_bound(queue.begin(), queue.end(), p, order), p);
+	};
+	while (mRemovals.size() > count) {
+		Removal& r = mRemovals.back();
+		const UPolynomial* p = r.polynomial;
+		if (r.erased) {
+			auto insertValue = this->polynomials.insert(p);
+			p = *insertValue.first;
+			if (insertValue.second) {
+				// samples computed since the removal were not lifted with p
+				insertSorted(mLiftingQueue, p, this->liftingOrder);
+				insertSorted(mLiftingQueueReset, p, this->liftingOrder);
+				if (r.queues[2]) insertSorted(mSingleEliminationQueue, p, this->eliminationOrder);
+				if (r.queues[3]) insertSorted(mPairedEliminationQueue, p, this->eliminationOrder);
+			}
+		}
+		if (!r.parents.empty()) {
+			this->parentsPerChild[p].insert(r.parents.begin(), r.parents.end());
+			for (const auto& parent: r.parents) {
+				if (parent.first != nullptr) this->childrenPerParent[parent.first].insert(p);
+				if (parent.second != nullptr) this->childrenPerParent[parent.second].insert(p);
+			}
+		}
+		if (!r.children.empty()) {
+			this->childrenPerParent[p].insert(r.children.begin(), r.children.end());
+		}
+		mRemovals.pop_back();
+	}
 }
 
 template<typename Coefficient>
@@ -227,9 +284,12 @@ std::forward_list<const typename EliminationSet<Coefficient>::UPolynomial*> Elim
 		auto parents = this->parentsPerChild.find(child);
 		if (parents == this->parentsPerChild.end() || parents->second.empty())
 			continue;    // nothing to be done for this child
+		Removal removal;
+		removal.polynomial = child;
 		typename parentbucket::const_iterator p = std::find_if( parents->second.begin(), parents->second.end(), PolynomialPairContains(parent));
 		while (p != parents->second.end()) {
 			// search matching parents
+			if (mRecordRemovals) removal.parents.insert(*p);
 			parents->second.erase(p); // remove either single matching parent or parents which got divorced by the removed parent
 			p = std::find_if( parents->second.begin(), parents->second.end(), PolynomialPairContains(parent));
 		}
@@ -237,23 +297,19 @@ std::forward_list<const typename EliminationSet<Coefficient>::UPolynomial*> Elim
 		if (parents->second.empty()) {
 			// no parent was left for the child, so delete it
 			this->parentsPerChild.erase( parents );
-			auto queuePosition = std::lower_bound( mLiftingQueue.begin(), mLiftingQueue.end(), child, this->liftingOrder );
-			if( queuePosition != mLiftingQueue.end() )
-				mLiftingQueue.erase( queuePosition );
-			queuePosition = std::lower_bound( mLiftingQueueReset.begin(), mLiftingQueueReset.end(), child, this->liftingOrder );
-			if( queuePosition != mLiftingQueueReset.end() )
-				mLiftingQueueReset.erase( queuePosition );
-			queuePosition = std::lower_bound( mSingleEliminationQueue.begin(), mSingleEliminationQueue.end(), child, this->eliminationOrder );
-			if( queuePosition != mSingleEliminationQueue.end() )
-				mSingleEliminationQueue.erase( queuePosition );
-			queuePosition = std::lower_bound( mPairedEliminationQueue.begin(), mPairedEliminationQueue.end(), child, this->eliminationOrder );
-			if( queuePosition != mPairedEliminationQueue.end() )
-				mPairedEliminationQueue.erase( queuePosition );
+			removal.erased = true;
+			removal.queues = eraseFromQueues(child);
 			deleted.push_front(child);
 			this->polynomials.erase(child);
 		}
+		if (mRecordRemovals) mRemovals.push_back(std::move(removal));
 	}
 	// remove the information of parent itself
+	if (mRecordRemovals) {
+		mRemovals.emplace_back();
+		mRemovals.back().polynomial = parent;
+		mRemovals.back().children = position->second;
+	}
 	this->childrenPerParent.erase(position);
 	return deleted;
 }
@@ -275,6 +331,24 @@ void EliminationSet<Coefficient>::clear() {
 	this->parentsPerChild.clear();
 }
 
+template<typename Coefficient>
+void EliminationSet<Coefficient>::restoreLiftingPositions(const LiftingPositions& positions) {
+	auto restore = [this,&positions](std::list<const UPolynomial*>& queue, const std::list<const UPolynomial*>& saved) {
+		PolynomialSet queued(queue.begin(), queue.end());
+		queued.insert(saved.begin(), saved.end());
+		std::list<const UPolynomial*> res;
+		for (const auto& p: this->polynomials) {
+			if (queued.count(p) > 0 || positions.polynomials.count(p) == 0) {
+				res.push_back(p);
+			}
+		}
+		res.sort(this->liftingOrder);
+		queue = std::move(res);
+	};
+	restore(this->mLiftingQueue, positions.queue);
+	restore(this->mLiftingQueueReset, positions.queueReset);
+}
+
 template<typename Coefficient>
 void EliminationSet<Coefficient>::resetLiftingPositionsFully() {
 	this->mLiftingQueue.assign( this->polynomials.begin(), this->polynomials.end() );
@@ -327,6 +401,7 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 	}
 
 	EliminationSet<Coefficient> newEliminationPolynomials(this->polynomialOwner, this->liftingOrder, this->eliminationOrder);
+	std::vector<PolynomialPair> projections;
 
 	// PAIRED elimination with the new polynomials: (1) together with the existing ones (2) among themselves
 
@@ -335,7 +410,7 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 		for (auto pol_it1: this->polynomials) {
 			assert(p->mainVar() == pol_it1->mainVar());
 			//eliminationEq( p, pol_it1, variable, newEliminationPolynomials, false );
-			project(p, pol_it1, variable, newEliminationPolynomials);
+			projections.emplace_back(p, pol_it1);
 		}
 		// (2) elimination with polynomial itself @todo: proof that we do not need that
 		// eliminationEq( p, p, variable, newEliminationPolynomials, setting );
@@ -344,7 +419,7 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 		for (auto pol_it1: this->polynomials) {
 			assert(p->mainVar() == pol_it1->mainVar());
 			//elimination( p, pol_it1, variable, newEliminationPolynomials, false );
-			project(p, pol_it1, variable, newEliminationPolynomials);
+			projections.emplace_back(p, pol_it1);
 		}
 		// (2) elimination with polynomial itself @todo: proof that we do not need that
 		// elimination( p, p, variable, newEliminationPolynomials, setting );
@@ -355,11 +430,12 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 
 	if( setting.equationsOnly ) {
 		//eliminationEq( p, variable, newEliminationPolynomials, false );
-		project(p, variable, newEliminationPolynomials);
+		projections.emplace_back(p, nullptr);
 	} else {
 		//elimination( p, variable, newEliminationPolynomials, false );
-		project(p, variable, newEliminationPolynomials);
+		projections.emplace_back(p, nullptr);
 	}
+	projectAll(projections, variable, newEliminationPolynomials, setting);
 
 
 	// optimizations
@@ -373,6 +449,39 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 	return destination.insert( newEliminationPolynomials );
 }
 
+template<typename Coefficient>
+void EliminationSet<Coefficient>::projectAll(
+		const std::vector<PolynomialPair>& projections,
+		Variable::Arg variable,
+		EliminationSet<Coefficient>& destination,
+		const CADSettings& setting
+		) const
+{
+	auto projectOne = [this,&variable,&setting](const PolynomialPair& pp, auto& inserter) {
+		if (pp.second == nullptr) project(setting, pp.first, variable, inserter);
+		else project(setting, pp.first, pp.second, variable, inserter);
+	};
+	if (setting.eliminationThreads < 2 || projections.size() < 2) {
+		for (const auto& pp: projections) projectOne(pp, destination);
+		return;
+	}
+#ifdef THREAD_SAFE
+	std::size_t threads = setting.eliminationThreads;
+#else
+	CARL_LOG_DEBUG("carl.cad.elimination", "Parallel elimination needs THREAD_SAFE, computing the projections sequentially.");
+	std::size_t threads = 1;
+#endif
+	std::vector<ProjectionRecorder> results(projections.size());
+	WorkStealingPool::shared().parallelFor(projections.size(), [&](std::size_t i){
+		projectOne(projections[i], results[i]);
+	}, threads);
+	for (const auto& r: results) {
+		for (const auto& e: r.results) {
+			destination.insert(std::get<0>(e), std::get<1>(e), std::get<2>(e));
+		}
+	}
+}
+
 template<typename Coefficient>
 std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationSet<Coefficient>::eliminateConstant(
 		const UPolynomial* p,
@@ -431,19 +540,20 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 	}
 
 	EliminationSet<Coefficient> newEliminationPolynomials(this->polynomialOwner, this->liftingOrder, this->eliminationOrder);
+	std::vector<PolynomialPair> projections;
 
 	// PAIRED elimination with the new polynomials: (1) together with the existing ones (2) among themselves
 	if (!mPairedEliminationQueue.empty()) {
 		if( setting.equationsOnly ) {
 			// (1) elimination with existing polynomials
 			for (auto pol_it1: this->polynomials)
-				project( p, pol_it1, variable, newEliminationPolynomials);
+				projections.emplace_back(p, pol_it1);
 			// (2) elimination with polynomial itself @todo: proof that we do not need that
 			// eliminationEq( p, p, variable, newEliminationPolynomials, setting );
 		} else {
 			// (1) elimination with existing polynomials
 			for (auto pol_it1: this->polynomials)
-				project( p, pol_it1, variable, newEliminationPolynomials);
+				projections.emplace_back(p, pol_it1);
 			// (2) elimination with polynomial itself @todo: proof that we do not need that
 			// elimination( p, p, variable, newEliminationPolynomials, setting );
 		}
@@ -456,12 +566,13 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 	{
 		p = mSingleEliminationQueue.front();
 		if (setting.equationsOnly) {
-			project( p, variable, newEliminationPolynomials );
+			projections.emplace_back(p, nullptr);
 		} else {
-			project( p, variable, newEliminationPolynomials );
+			projections.emplace_back(p, nullptr);
 		}
 		mSingleEliminationQueue.pop_front();
 	}
+	projectAll(projections, variable, newEliminationPolynomials, setting);
 
 	// optimizations
 	if( setting.simplifyByFactorization )
@@ -539,6 +650,7 @@ void EliminationSet<Coefficient>::makeSquarefree() {
 		DOT_EDGE("elimination", p, carl::squareFreePart(*p), "label=\"squarefree\"");
 		squarefreeSet.insert(carl::squareFreePart(*p), this->getParentsOf(p));
 	}
+	squarefreeSet.takeRemovals(*this);
 	std::swap(*this, squarefreeSet);
 }
 
@@ -554,6 +666,7 @@ void EliminationSet<Coefficient>::makePrimitive() {
 		DOT_EDGE("elimination", p, p->pseudoPrimpart(), "label=\"primitive\"");
 		primitiveSet.insert(p->pseudoPrimpart(), this->getParentsOf(p));
 	}
+	primitiveSet.takeRemovals(*this);
 	std::swap(*this, primitiveSet);
 }
 
@@ -569,6 +682,7 @@ void EliminationSet<Coefficient>::factorize() {
 		}*/
 		factorizedSet.insert(p, this->getParentsOf(p));
 	}
+	factorizedSet.takeRemovals(*this);
 	std::swap(*this, factorizedSet);
 }
 
@@ -603,6 +717,8 @@ void swap(carl::cad::EliminationSet<Coefficient>& lhs, carl::cad::EliminationSet
 	std::swap(lhs.liftingOrder, rhs.liftingOrder);
 	std::swap(lhs.eliminationOrder, rhs.eliminationOrder);
 	std::swap(lhs.polynomialOwner, rhs.polynomialOwner);
+	std::swap(lhs.mRemovals, rhs.mRemovals);
+	std::swap(lhs.mRecordRemovals, rhs.mRecordRemovals);
 }
 }
 #endif
@@ -66,6 +66,9 @@ public:
 	const std::vector<Variable>& getCurrent() const {
 		return mCurVars;
 	}
+	const std::vector<Variable>& getNew() const {
+		return mNewVars;
+	}
 	
 	void clear() {
 		mCurVars.clear();
@@ -110,6 +113,26 @@ public:
 		}
 	}
 	
+	/**
+	 * Removes a variable from the new variables.
+	 * @param v Variable.
+	 * @return true if v was a new variable.
+	 */
+	bool removeNew(Variable::Arg v) {
+		auto it = std::find(mNewVars.begin(), mNewVars.end(), v);
+		if (it == mNewVars.end()) return false;
+		mNewVars.erase(it);
+		return true;
+	}
+	/**
+	 * Removes the current variable at the given position.
+	 * @param i Index of the variable.
+	 */
+	void removeCurrent(std::size_t i) {
+		assert(i < mCurVars.size());
+		mCurVars.erase(mCurVars.begin() + long(i));
+	}
+	
 	Variable::Arg operator[](std::size_t i) const {
 		assert(i < mCurVars.size());
 		return mCurVars[i];
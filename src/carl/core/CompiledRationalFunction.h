@@ -0,0 +1,382 @@
+/**
+ * @file CompiledRationalFunction.h
+ * @ingroup multirp
+ */
+
+#pragma once
+
+#include "../interval/Interval.h"
+#include "../numbers/numbers.h"
+#include "MultivariateHorner.h"
+#include "RationalFunction.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <set>
+#include <tuple>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * A rational function compiled to a straight-line program for fast repeated evaluation.
+ *
+ * Nominator and denominator are transformed into multivariate Horner schemes, which are flattened into a single sequence of instructions.
+ * Every instruction is either a constant, a variable, a power of a previous result, or the sum or product of two previous results.
+ * Identical instructions are only emitted once, hence powers of variables and common subexpressions of the Horner schemes (also between nominator and denominator) are shared.
+ *
+ * Variables are identified by their position in a fixed variable order, such that a point is given as a dense vector instead of a map.
+ * The program can be evaluated over the coefficient type, over double and over Interval<double>.
+ * The interval evaluation is sound: constants are enclosed by intervals and all operations use outward rounding.
+ * evaluateBatch() evaluates many points given as one column per variable, running every instruction on a block of points at once.
+ */
+template<typename Pol, class Strategy = strategy>
+class CompiledRationalFunction
+{
+public:
+	using CoeffType = typename Pol::CoeffType;
+
+	enum class Opcode : std::uint8_t { CONSTANT, VARIABLE, POW, ADD, MUL };
+	/**
+	 * A single instruction of the program.
+	 * For CONSTANT and VARIABLE, lhs is the index of the constant or the variable.
+	 * For POW, lhs is the index of the base and rhs the exponent.
+	 * For ADD and MUL, lhs and rhs are the indices of the operands.
+	 */
+	struct Instruction
+	{
+		Opcode op;
+		std::size_t lhs;
+		std::size_t rhs;
+	};
+
+	/**
+	 * Compiles a rational function.
+	 * @param rf Rational function.
+	 * @param variables Variable order of the points. If empty, the variables of rf in ascending order are used.
+	 */
+	template<bool AutoSimplify>
+	explicit CompiledRationalFunction(const RationalFunction<Pol, AutoSimplify>& rf, const std::vector<Variable>& variables = {})
+	: mVariables(variables)
+	{
+		if (mVariables.empty())
+		{
+			std::set<Variable> vars;
+			rf.gatherVariables(vars);
+			mVariables.assign(vars.begin(), vars.end());
+		}
+		for (std::size_t i = 0; i < mVariables.size(); ++i)
+		{
+			mVariableIndex.emplace(mVariables[i], i);
+		}
+		if (rf.isConstant())
+		{
+			mNominator = constant(rf.constantPart());
+		}
+		else
+		{
+			mNominator = compile(rf.nominatorAsPolynomial());
+			if (!rf.denominatorAsPolynomial().isOne())
+			{
+				mDenominator = compile(rf.denominatorAsPolynomial());
+			}
+		}
+		mConstantIndex.clear();
+		mInstructionIndex.clear();
+		mVariableIndex.clear();
+		mDoubleConstants.reserve(mConstants.size());
+		mIntervalConstants.reserve(mConstants.size());
+		for (const auto& c: mConstants)
+		{
+			mDoubleConstants.push_back(carl::toDouble(c));
+			mIntervalConstants.emplace_back(c);
+		}
+	}
+
+	/**
+	 * @return Variable order of the points.
+	 */
+	const std::vector<Variable>& variables() const
+	{
+		return mVariables;
+	}
+
+	/**
+	 * @return The instructions of the program.
+	 */
+	const std::vector<Instruction>& program() const
+	{
+		return mProgram;
+	}
+
+	/**
+	 * @return The constants referred to by the program.
+	 */
+	const std::vector<CoeffType>& constants() const
+	{
+		return mConstants;
+	}
+
+	/**
+	 * @return Index of the instruction computing the nominator.
+	 */
+	std::size_t nominatorIndex() const
+	{
+		return mNominator;
+	}
+
+	/**
+	 * @return Index of the instruction computing the denominator.
+	 */
+	std::size_t denominatorIndex() const
+	{
+		assert(hasDenominator());
+		return mDenominator;
+	}
+
+	/**
+	 * @return If the denominator is not one.
+	 */
+	bool hasDenominator() const
+	{
+		return mDenominator != NO_INDEX;
+	}
+
+	/**
+	 * Evaluates the rational function at a single point.
+	 * For Interval<double>, the result is the unbounded interval if the denominator may become zero.
+	 * @param point Values of the variables, in the order of variables().
+	 * @return Value of the rational function.
+	 */
+	template<typename T>
+	T evaluate(const std::vector<T>& point) const
+	{
+		std::vector<T> registers;
+		return evaluate(point, registers);
+	}
+
+	/**
+	 * Evaluates the rational function at a single point.
+	 * The storage for intermediate results is passed such that it can be reused for many evaluations.
+	 * @param point Values of the variables, in the order of variables().
+	 * @param registers Storage for intermediate results.
+	 * @return Value of the rational function.
+	 */
+	template<typename T>
+	T evaluate(const std::vector<T>& point, std::vector<T>& registers) const
+	{
+		assert(point.size() == mVariables.size());
+		const std::vector<T>& constants = convertedConstants(static_cast<const T*>(nullptr));
+		registers.resize(mProgram.size());
+		for (std::size_t i = 0; i < mProgram.size(); ++i)
+		{
+			const Instruction& in = mProgram[i];
+			switch (in.op)
+			{
+				case Opcode::CONSTANT: registers[i] = constants[in.lhs]; break;
+				case Opcode::VARIABLE: registers[i] = point[in.lhs]; break;
+				case Opcode::POW: registers[i] = power(registers[in.lhs], in.rhs); break;
+				case Opcode::ADD: registers[i] = registers[in.lhs] + registers[in.rhs]; break;
+				case Opcode::MUL: registers[i] = registers[in.lhs] * registers[in.rhs]; break;
+			}
+		}
+		if (mDenominator == NO_INDEX) return registers[mNominator];
+		return divide(registers[mNominator], registers[mDenominator]);
+	}
+
+	/**
+	 * Evaluates the rational function at many points.
+	 * The points are given as one column per variable, i.e. columns[i][j] is the value of the i'th variable in the j'th point.
+	 * The points are processed in blocks, and every instruction is executed for the whole block in a single loop.
+	 * If there are no variables, the function is evaluated once.
+	 * @param columns Values of the variables, in the order of variables().
+	 * @return Values of the rational function at all points.
+	 */
+	template<typename T>
+	std::vector<T> evaluateBatch(const std::vector<std::vector<T>>& columns) const
+	{
+		assert(columns.size() == mVariables.size());
+		std::size_t count = columns.empty() ? 1 : columns.front().size();
+		assert(std::all_of(columns.begin(), columns.end(), [count](const auto& c){ return c.size() == count; }));
+		const std::vector<T>& constants = convertedConstants(static_cast<const T*>(nullptr));
+		std::vector<T> result(count);
+		std::vector<T> registers(mProgram.size() * BLOCK_SIZE);
+		for (std::size_t offset = 0; offset < count; offset += BLOCK_SIZE)
+		{
+			const std::size_t lanes = std::min(BLOCK_SIZE, count - offset);
+			for (std::size_t i = 0; i < mProgram.size(); ++i)
+			{
+				const Instruction& in = mProgram[i];
+				T* res = registers.data() + i * BLOCK_SIZE;
+				// Operands of POW, ADD and MUL.
+				const T* lhs = registers.data() + std::min(in.lhs, i) * BLOCK_SIZE;
+				const T* rhs = registers.data() + std::min(in.rhs, i) * BLOCK_SIZE;
+				switch (in.op)
+				{
+					case Opcode::CONSTANT:
+						std::fill(res, res + lanes, constants[in.lhs]);
+						break;
+					case Opcode::VARIABLE:
+						std::copy(columns[in.lhs].begin() + std::ptrdiff_t(offset), columns[in.lhs].begin() + std::ptrdiff_t(offset + lanes), res);
+						break;
+					case Opcode::POW:
+						for (std::size_t l = 0; l < lanes; ++l) res[l] = power(lhs[l], in.rhs);
+						break;
+					case Opcode::ADD:
+						for (std::size_t l = 0; l < lanes; ++l) res[l] = lhs[l] + rhs[l];
+						break;
+					case Opcode::MUL:
+						for (std::size_t l = 0; l < lanes; ++l) res[l] = lhs[l] * rhs[l];
+						break;
+				}
+			}
+			const T* nom = registers.data() + mNominator * BLOCK_SIZE;
+			if (mDenominator == NO_INDEX)
+			{
+				std::copy(nom, nom + lanes, result.begin() + std::ptrdiff_t(offset));
+				continue;
+			}
+			const T* denom = registers.data() + mDenominator * BLOCK_SIZE;
+			for (std::size_t l = 0; l < lanes; ++l) result[offset + l] = divide(nom[l], denom[l]);
+		}
+		return result;
+	}
+
+private:
+	/// Number of points evaluated at once by evaluateBatch().
+	static constexpr std::size_t BLOCK_SIZE = 64;
+	static constexpr std::size_t NO_INDEX = std::numeric_limits<std::size_t>::max();
+
+	/// Variable order of the points.
+	std::vector<Variable> mVariables;
+	/// Constants of the program.
+	std::vector<CoeffType> mConstants;
+	/// Constants of the program, converted to double.
+	std::vector<double> mDoubleConstants;
+	/// Constants of the program, enclosed by intervals.
+	std::vector<Interval<double>> mIntervalConstants;
+	/// The instructions of the program.
+	std::vector<Instruction> mProgram;
+	/// Index of the instruction computing the nominator.
+	std::size_t mNominator = NO_INDEX;
+	/// Index of the instruction computing the denominator, or NO_INDEX if the denominator is one.
+	std::size_t mDenominator = NO_INDEX;
+
+	/// Lookup tables used to share instructions, only used during compilation.
+	std::map<Variable, std::size_t> mVariableIndex;
+	std::map<CoeffType, std::size_t> mConstantIndex;
+	std::map<std::tuple<Opcode, std::size_t, std::size_t>, std::size_t> mInstructionIndex;
+
+	/**
+	 * Emits an instruction, unless an identical instruction exists.
+	 * @return Index of the instruction.
+	 */
+	std::size_t emit(Opcode op, std::size_t lhs, std::size_t rhs)
+	{
+		if ((op == Opcode::ADD || op == Opcode::MUL) && rhs < lhs) std::swap(lhs, rhs);
+		auto it = mInstructionIndex.emplace(std::make_tuple(op, lhs, rhs), mProgram.size());
+		if (it.second) mProgram.push_back(Instruction{op, lhs, rhs});
+		return it.first->second;
+	}
+
+	std::size_t constant(const CoeffType& c)
+	{
+		auto it = mConstantIndex.emplace(c, mConstants.size());
+		if (it.second) mConstants.push_back(c);
+		return emit(Opcode::CONSTANT, it.first->second, 0);
+	}
+
+	bool isConstant(std::size_t index, const CoeffType& c) const
+	{
+		return mProgram[index].op == Opcode::CONSTANT && mConstants[mProgram[index].lhs] == c;
+	}
+
+	std::size_t add(std::size_t lhs, std::size_t rhs)
+	{
+		if (isConstant(lhs, constant_zero<CoeffType>::get())) return rhs;
+		if (isConstant(rhs, constant_zero<CoeffType>::get())) return lhs;
+		return emit(Opcode::ADD, lhs, rhs);
+	}
+
+	std::size_t mul(std::size_t lhs, std::size_t rhs)
+	{
+		if (isConstant(lhs, constant_one<CoeffType>::get())) return rhs;
+		if (isConstant(rhs, constant_one<CoeffType>::get())) return lhs;
+		return emit(Opcode::MUL, lhs, rhs);
+	}
+
+	std::size_t compile(const Pol& p)
+	{
+		return compile(MultivariateHorner<Pol, Strategy>(p));
+	}
+
+	/**
+	 * Flattens a Horner scheme var^exp * dependent + independent.
+	 * @return Index of the instruction computing the value of the scheme.
+	 */
+	std::size_t compile(const MultivariateHorner<Pol, Strategy>& h)
+	{
+		if (h.getVariable() == Variable::NO_VARIABLE)
+		{
+			return constant(h.getIndepConstant());
+		}
+		auto var = mVariableIndex.find(h.getVariable());
+		assert(var != mVariableIndex.end());
+		// Chains x * (x * (...)) are merged to x^k * (...), which shares the power and is tight for intervals.
+		unsigned exponent = h.getExponent();
+		const MultivariateHorner<Pol, Strategy>* dependent = &h;
+		while (dependent->getDependent() && dependent->getDependent()->getVariable() == h.getVariable() && !dependent->getDependent()->getIndependent() && carl::isZero(dependent->getDependent()->getIndepConstant()))
+		{
+			dependent = dependent->getDependent().get();
+			exponent += dependent->getExponent();
+		}
+		std::size_t res = emit(Opcode::VARIABLE, var->second, 0);
+		if (exponent > 1) res = emit(Opcode::POW, res, exponent);
+		res = mul(res, dependent->getDependent() ? compile(*dependent->getDependent()) : constant(dependent->getDepConstant()));
+		return add(res, h.getIndependent() ? compile(*h.getIndependent()) : constant(h.getIndepConstant()));
+	}
+
+	const std::vector<CoeffType>& convertedConstants(const CoeffType*) const
+	{
+		return mConstants;
+	}
+	const std::vector<double>& convertedConstants(const double*) const
+	{
+		return mDoubleConstants;
+	}
+	const std::vector<Interval<double>>& convertedConstants(const Interval<double>*) const
+	{
+		return mIntervalConstants;
+	}
+
+	template<typename T>
+	static T power(const T& base, std::size_t exp)
+	{
+		T res = base;
+		for (std::size_t i = 1; i < exp; ++i) res *= base;
+		return res;
+	}
+	static Interval<double> power(const Interval<double>& base, std::size_t exp)
+	{
+		// Repeated multiplication is not tight for even exponents.
+		return carl::pow(base, exp);
+	}
+
+	template<typename T>
+	static T divide(const T& nom, const T& denom)
+	{
+		assert(!carl::isZero(denom));
+		return nom / denom;
+	}
+	static Interval<double> divide(const Interval<double>& nom, const Interval<double>& denom)
+	{
+		if (denom.contains(0.0)) return Interval<double>::unboundedInterval();
+		return nom.div(denom);
+	}
+};
+
+}
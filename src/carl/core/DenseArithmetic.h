@@ -0,0 +1,437 @@
+/**
+ * @file DenseArithmetic.h
+ * @ingroup unirp
+ *
+ * Asymptotically fast arithmetic on dense coefficient vectors as used by UnivariatePolynomial.
+ * All coefficient vectors start with the constant coefficient.
+ */
+
+#pragma once
+
+#include "../numbers/numbers.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace carl {
+
+/**
+ * Degree thresholds above which UnivariatePolynomial switches from the classical algorithms to the ones from dense_arithmetic.
+ * The thresholds refer to the number of coefficients and can be tuned at runtime.
+ */
+struct DenseArithmeticSettings {
+	/// Karatsuba multiplication is used if both factors have at least this many coefficients.
+	static inline std::size_t karatsubaThreshold = 48;
+	/// The divide-and-conquer Taylor shift is used for rational coefficients if the polynomial has at least this many coefficients.
+	static inline std::size_t taylorShiftThreshold = 64;
+	/// Division via Newton inversion is used if both the divisor and the quotient have at least this many coefficients.
+	static inline std::size_t newtonDivisionThreshold = 24;
+};
+
+namespace dense_arithmetic {
+
+/**
+ * States whether the fast algorithms are used for the given coefficient type.
+ * They are restricted to integers and rationals, as they depend on cheap exact arithmetic and on clearing denominators.
+ */
+template<typename C>
+struct is_applicable: std::integral_constant<bool, is_subset_of_integers<C>::value || is_rational<C>::value> {};
+
+/**
+ * Adds the product of a and b to res, using the schoolbook method.
+ * @param a First factor with na coefficients.
+ * @param b Second factor with nb coefficients.
+ * @param res Result with at least na + nb - 1 coefficients.
+ */
+template<typename C>
+void schoolbookAdd(const C* a, std::size_t na, const C* b, std::size_t nb, C* res) {
+	for (std::size_t i = 0; i < na; ++i) {
+		if (carl::isZero(a[i])) continue;
+		for (std::size_t j = 0; j < nb; ++j) {
+			res[i + j] += a[i] * b[j];
+		}
+	}
+}
+
+/**
+ * Adds the product of a and b, both with n coefficients, to res using Karatsuba's method.
+ * Below DenseArithmeticSettings::karatsubaThreshold, schoolbookAdd() is used.
+ */
+template<typename C>
+void karatsubaAdd(const C* a, const C* b, std::size_t n, C* res) {
+	if (n < DenseArithmeticSettings::karatsubaThreshold) {
+		schoolbookAdd(a, n, b, n, res);
+		return;
+	}
+	// a = a0 + x^m * a1, b = b0 + x^m * b1, where a1 and b1 have h >= m coefficients.
+	std::size_t m = n / 2;
+	std::size_t h = n - m;
+	std::vector<C> sa(a + m, a + n);
+	std::vector<C> sb(b + m, b + n);
+	for (std::size_t i = 0; i < m; ++i) {
+		sa[i] += a[i];
+		sb[i] += b[i];
+	}
+	std::vector<C> low(2 * m - 1, constant_zero<C>::get());
+	std::vector<C> high(2 * h - 1, constant_zero<C>::get());
+	std::vector<C> mid(2 * h - 1, constant_zero<C>::get());
+	karatsubaAdd(a, b, m, low.data());
+	karatsubaAdd(a + m, b + m, h, high.data());
+	karatsubaAdd(sa.data(), sb.data(), h, mid.data());
+	for (std::size_t i = 0; i < low.size(); ++i) {
+		res[i] += low[i];
+		mid[i] -= low[i];
+	}
+	for (std::size_t i = 0; i < high.size(); ++i) {
+		res[i + 2 * m] += high[i];
+		mid[i] -= high[i];
+	}
+	for (std::size_t i = 0; i < mid.size(); ++i) {
+		res[i + m] += mid[i];
+	}
+}
+
+/**
+ * Adds the product of a and b to res.
+ * Unbalanced factors are split into chunks of the size of the shorter factor, which are then multiplied by karatsubaAdd().
+ */
+template<typename C>
+void multiplyAdd(const C* a, std::size_t na, const C* b, std::size_t nb, C* res) {
+	if (na < nb) {
+		std::swap(a, b);
+		std::swap(na, nb);
+	}
+	if (nb < DenseArithmeticSettings::karatsubaThreshold) {
+		schoolbookAdd(a, na, b, nb, res);
+		return;
+	}
+	std::size_t offset = 0;
+	for (; offset + nb <= na; offset += nb) {
+		karatsubaAdd(a + offset, b, nb, res + offset);
+	}
+	if (offset < na) {
+		multiplyAdd(a + offset, na - offset, b, nb, res + offset);
+	}
+}
+
+/**
+ * Converts the given coefficients to integers by multiplying them with their common denominator.
+ * @return The common denominator.
+ */
+template<typename C>
+typename IntegralType<C>::type clearDenominators(const std::vector<C>& c, std::vector<typename IntegralType<C>::type>& res) {
+	using Integer = typename IntegralType<C>::type;
+	Integer denominator = constant_one<Integer>::get();
+	for (const auto& coeff: c) {
+		denominator = carl::lcm(denominator, carl::getDenom(coeff));
+	}
+	res.clear();
+	res.reserve(c.size());
+	for (const auto& coeff: c) {
+		res.emplace_back(carl::getNum(C(coeff * denominator)));
+	}
+	return denominator;
+}
+
+/**
+ * Multiplies two coefficient vectors.
+ * Rational coefficients are converted to integers first, such that the inner loops do not need to normalize fractions.
+ * @param a First factor.
+ * @param b Second factor.
+ * @return Product of a and b.
+ */
+template<typename C>
+std::vector<C> multiply(const std::vector<C>& a, const std::vector<C>& b) {
+	if (a.empty() || b.empty()) return {};
+	if constexpr (is_rational<C>::value) {
+		using Integer = typename IntegralType<C>::type;
+		std::vector<Integer> ia;
+		std::vector<Integer> ib;
+		Integer denominator = clearDenominators(a, ia) * clearDenominators(b, ib);
+		std::vector<Integer> ires = multiply(ia, ib);
+		std::vector<C> res;
+		res.reserve(ires.size());
+		for (const auto& i: ires) {
+			res.emplace_back(C(i) / C(denominator));
+		}
+		return res;
+	} else {
+		std::vector<C> res(a.size() + b.size() - 1, constant_zero<C>::get());
+		multiplyAdd(a.data(), a.size(), b.data(), b.size(), res.data());
+		return res;
+	}
+}
+
+/**
+ * Applies the Taylor shift \f$ p(x) \rightarrow p(x+a) \f$ in place with the classical quadratic algorithm.
+ */
+template<typename C>
+void classicalTaylorShift(std::vector<C>& c, const C& a) {
+	if (c.size() < 2) return;
+	std::size_t n = c.size() - 1;
+	for (std::size_t i = 0; i < n; ++i) {
+		for (std::size_t j = n; j > i; --j) {
+			c[j-1] += a * c[j];
+		}
+	}
+}
+
+namespace detail {
+	/**
+	 * Shifts the n coefficients starting at c, using powers[k] = \f$ (x+a)^{2^k} \f$.
+	 */
+	template<typename C>
+	std::vector<C> taylorShift(const C* c, std::size_t n, const C& a, const std::vector<std::vector<C>>& powers) {
+		if (n <= DenseArithmeticSettings::taylorShiftThreshold) {
+			std::vector<C> res(c, c + n);
+			classicalTaylorShift(res, a);
+			return res;
+		}
+		// Split p = low + x^m * high with m the largest power of two below n.
+		std::size_t k = 0;
+		while ((std::size_t(2) << k) < n) ++k;
+		std::size_t m = std::size_t(1) << k;
+		std::vector<C> res = multiply(taylorShift(c + m, n - m, a, powers), powers[k]);
+		std::vector<C> low = taylorShift(c, m, a, powers);
+		for (std::size_t i = 0; i < low.size(); ++i) {
+			res[i] += low[i];
+		}
+		return res;
+	}
+}
+
+/**
+ * Applies the Taylor shift \f$ p(x) \rightarrow p(x+a) \f$ with a divide-and-conquer approach.
+ * With \f$ p = p_0 + x^m p_1 \f$ we have \f$ p(x+a) = p_0(x+a) + (x+a)^m p_1(x+a) \f$, where m is a power of two and the powers of \f$ (x+a) \f$ are computed by repeated squaring.
+ * Hence, the shift mostly consists of multiplications that benefit from multiply().
+ * @param c Coefficients.
+ * @param a Shift.
+ * @return Coefficients of the shifted polynomial.
+ */
+template<typename C>
+std::vector<C> taylorShift(const std::vector<C>& c, const C& a) {
+	if (c.empty()) return c;
+	if constexpr (is_rational<C>::value) {
+		// With a = u/v and q(y) = v^n * p(y/v), we have p(x+a) = q(vx + u) / v^n and q has integral coefficients.
+		using Integer = typename IntegralType<C>::type;
+		std::vector<Integer> ic;
+		Integer denominator = clearDenominators(c, ic);
+		Integer vpow = constant_one<Integer>::get();
+		for (auto it = ic.rbegin(); it != ic.rend(); ++it) {
+			*it *= vpow;
+			vpow *= carl::getDenom(a);
+		}
+		ic = taylorShift(ic, Integer(carl::getNum(a)));
+		// vpow is v^(n+1) now.
+		denominator *= vpow / carl::getDenom(a);
+		std::vector<C> res;
+		res.reserve(ic.size());
+		vpow = constant_one<Integer>::get();
+		for (const auto& i: ic) {
+			res.emplace_back(C(i * vpow) / C(denominator));
+			vpow *= carl::getDenom(a);
+		}
+		return res;
+	}
+	std::vector<std::vector<C>> powers({ { a, constant_one<C>::get() } });
+	while ((std::size_t(1) << powers.size()) < c.size()) {
+		powers.emplace_back(multiply(powers.back(), powers.back()));
+	}
+	return detail::taylorShift(c.data(), c.size(), a, powers);
+}
+
+/**
+ * Computes the first n coefficients of the power series inverse of f using Newton iteration \f$ g \rightarrow g (2 - f g) \f$.
+ * @param f Coefficients, the constant coefficient must be invertible.
+ * @param n Precision.
+ * @return g such that \f$ f g = 1 \mod x^n \f$.
+ */
+template<typename C>
+std::vector<C> seriesInverse(const std::vector<C>& f, std::size_t n) {
+	static_assert(is_field<C>::value, "Series inversion needs field coefficients.");
+	assert(!f.empty() && !carl::isZero(f.front()));
+	std::vector<C> g({ C(constant_one<C>::get() / f.front()) });
+	for (std::size_t precision = 1; precision < n; ) {
+		precision = std::min(2 * precision, n);
+		std::vector<C> fg = multiply(std::vector<C>(f.begin(), f.begin() + long(std::min(precision, f.size()))), g);
+		fg.resize(precision, constant_zero<C>::get());
+		for (auto& coeff: fg) coeff = -coeff;
+		fg.front() += 2;
+		g = multiply(g, fg);
+		g.resize(precision, constant_zero<C>::get());
+	}
+	return g;
+}
+
+/**
+ * Computes quotient and remainder of the division of a by b via Newton inversion of the reversed divisor.
+ * With \f$ k = deg(a) - deg(b) + 1 \f$, the reversed quotient is \f$ rev(a) \cdot rev(b)^{-1} \mod x^k \f$.
+ * @param a Dividend.
+ * @param b Divisor, must not have leading zeros.
+ * @param quotient Quotient.
+ * @param remainder Remainder, without leading zeros.
+ */
+template<typename C>
+void divide(const std::vector<C>& a, const std::vector<C>& b, std::vector<C>& quotient, std::vector<C>& remainder) {
+	static_assert(is_field<C>::value, "Newton division needs field coefficients.");
+	assert(!b.empty() && !carl::isZero(b.back()));
+	if (a.size() < b.size()) {
+		quotient.clear();
+		remainder = a;
+		return;
+	}
+	std::size_t k = a.size() - b.size() + 1;
+	std::vector<C> revB(b.rbegin(), b.rbegin() + long(std::min(k, b.size())));
+	std::vector<C> revA(a.rbegin(), a.rbegin() + long(k));
+	quotient = multiply(revA, seriesInverse(revB, k));
+	quotient.resize(k, constant_zero<C>::get());
+	std::reverse(quotient.begin(), quotient.end());
+
+	std::vector<C> bq = multiply(b, quotient);
+	remainder.assign(a.begin(), a.begin() + long(b.size() - 1));
+	for (std::size_t i = 0; i < remainder.size(); ++i) {
+		remainder[i] -= bq[i];
+	}
+	while (!remainder.empty() && carl::isZero(remainder.back())) {
+		remainder.pop_back();
+	}
+}
+
+/**
+ * @name Word-size Galois fields
+ * Kernels for coefficients from a GaloisField<uint>, operating on vectors of the representing integers in [0, p^k).
+ * Dot products accumulate the double word products and only reduce the sum, hence every coefficient of a result costs a single reduction.
+ * There are no vector instructions for double word products of 64 bit integers, so the inner loops are scalar but branch-free.
+ * @{
+ */
+
+/**
+ * Adds the product of a and b to the double word accumulator hi * 2^64 + lo, keeping hi below the modulus.
+ */
+inline void accumulate(const GaloisField<uint>& F, uint a, uint b, uint& hi, uint& lo) {
+	uint phi;
+	uint plo;
+	carl::detail::umul128(a, b, phi, plo);
+	lo += plo;
+	hi += phi + (lo < plo ? 1 : 0);
+	hi = (hi >= F.size()) ? hi - F.size() : hi;
+}
+
+/**
+ * Multiplies two coefficient vectors over F.
+ */
+inline std::vector<uint> multiply(const GaloisField<uint>& F, const std::vector<uint>& a, const std::vector<uint>& b) {
+	if (a.empty() || b.empty()) return {};
+	std::vector<uint> res(a.size() + b.size() - 1);
+	for (std::size_t k = 0; k < res.size(); ++k) {
+		std::size_t first = (k >= b.size()) ? k - b.size() + 1 : 0;
+		std::size_t last = std::min(k, a.size() - 1);
+		uint hi = 0;
+		uint lo = 0;
+		for (std::size_t i = first; i <= last; ++i) {
+			accumulate(F, a[i], b[k - i], hi, lo);
+		}
+		res[k] = F.reduce(hi, lo);
+	}
+	while (!res.empty() && res.back() == 0) res.pop_back();
+	return res;
+}
+
+/**
+ * Computes quotient and remainder of the division of a by b over F.
+ * Every coefficient of the quotient is obtained from a dot product of the previous quotient coefficients with the divisor.
+ * @param a Dividend.
+ * @param b Divisor, must not have leading zeros and its leading coefficient must be invertible.
+ * @param quotient Quotient.
+ * @param remainder Remainder, without leading zeros.
+ */
+inline void divide(const GaloisField<uint>& F, const std::vector<uint>& a, const std::vector<uint>& b, std::vector<uint>& quotient, std::vector<uint>& remainder) {
+	assert(!b.empty() && b.back() != 0);
+	if (a.size() < b.size()) {
+		quotient.clear();
+		remainder = a;
+		return;
+	}
+	std::size_t m = b.size();
+	std::size_t k = a.size() - m + 1;
+	uint lcInverse = F.inverse(b.back());
+	uint lcShoup = F.shoup(lcInverse);
+	quotient.assign(k, 0);
+	for (std::size_t t = k; t-- > 0;) {
+		// Coefficient of x^(t+m-1) in a - b * (quotient[t+1] x^(t+1) + ...)
+		uint hi = 0;
+		uint lo = 0;
+		std::size_t last = std::min(k - 1, t + m - 1);
+		for (std::size_t i = t + 1; i <= last; ++i) {
+			accumulate(F, quotient[i], b[t + m - 1 - i], hi, lo);
+		}
+		uint c = F.sub(a[t + m - 1], F.reduce(hi, lo));
+		quotient[t] = F.mulShoup(c, lcInverse, lcShoup);
+	}
+	remainder.assign(m - 1, 0);
+	for (std::size_t j = 0; j + 1 < m; ++j) {
+		uint hi = 0;
+		uint lo = 0;
+		std::size_t last = std::min(j, k - 1);
+		for (std::size_t i = 0; i <= last; ++i) {
+			accumulate(F, quotient[i], b[j - i], hi, lo);
+		}
+		remainder[j] = F.sub(a[j], F.reduce(hi, lo));
+	}
+	while (!remainder.empty() && remainder.back() == 0) remainder.pop_back();
+}
+
+/**
+ * Computes the monic greatest common divisor of a and b over F, which must be a field.
+ * @return The gcd, or an empty vector if both a and b are zero.
+ */
+inline std::vector<uint> gcd(const GaloisField<uint>& F, std::vector<uint> a, std::vector<uint> b) {
+	std::vector<uint> quotient;
+	std::vector<uint> remainder;
+	while (!b.empty()) {
+		divide(F, a, b, quotient, remainder);
+		a.swap(b);
+		b.swap(remainder);
+	}
+	if (a.empty()) return a;
+	uint lcInverse = F.inverse(a.back());
+	uint lcShoup = F.shoup(lcInverse);
+	for (auto& c: a) c = F.mulShoup(c, lcInverse, lcShoup);
+	return a;
+}
+
+/**
+ * Returns the field of the given coefficients, or nullptr if no coefficient has a field.
+ */
+inline const GaloisField<uint>* field(const std::vector<GFNumber<uint>>& c) {
+	for (const auto& coeff: c) {
+		if (coeff.gf() != nullptr) return coeff.gf();
+	}
+	return nullptr;
+}
+
+/**
+ * Converts the given coefficients to their representing integers in F.
+ */
+inline std::vector<uint> toWords(const GaloisField<uint>& F, const std::vector<GFNumber<uint>>& c) {
+	std::vector<uint> res;
+	res.reserve(c.size());
+	for (const auto& coeff: c) res.emplace_back(F.modulo(coeff.representingInteger()));
+	return res;
+}
+
+/**
+ * Converts integers from F to coefficients.
+ */
+inline std::vector<GFNumber<uint>> fromWords(const GaloisField<uint>* F, const std::vector<uint>& c) {
+	std::vector<GFNumber<uint>> res;
+	res.reserve(c.size());
+	for (uint coeff: c) res.emplace_back(coeff, F);
+	return res;
+}
+
+/// @}
+
+}
+}
@@ -66,6 +66,12 @@ namespace carl
          * Co-prime coefficient of the factorization
          */
         mutable CoeffType mCoefficient;
+
+        /**
+         * The expanded polynomial of the cache entry, once it was obtained by polynomial().
+         * It stays valid if the cache releases the polynomial of the entry.
+         */
+        mutable std::shared_ptr<P> mpPolynomial;
         
         explicit FactorizedPolynomial( Factorization<P>&& _factorization, const CoeffType&, const std::shared_ptr<CACHE>& );
 
@@ -228,13 +234,23 @@ namespace carl
         const P& polynomial() const
         {
             assert( existsFactorization( *this ) );
-            if( content().mpPolynomial == nullptr )
+            if( mpPolynomial != nullptr )
+                return *mpPolynomial;
+            bool computed = false;
             {
-                content().mpPolynomial = new P( computePolynomial( content().factorization() ) );
-                rehash();
+                std::lock_guard<std::recursive_mutex> lock( content().mMutex );
+                if( content().mpPolynomial == nullptr )
+                {
+                    content().mpPolynomial = std::make_shared<P>( computePolynomial( content().factorization() ) );
+                    computed = true;
+                }
+                mpPolynomial = content().mpPolynomial;
             }
+            // Rehashing locks the cache, which in turn might lock this pair, hence the lock of the pair is released before.
+            if( computed )
+                rehash();
 
-            return *content().mpPolynomial;
+            return *mpPolynomial;
         }
 
         /**
@@ -57,11 +57,10 @@ namespace carl
             {
                 assert( mpCache != nullptr );
                 Factorization<P> factorization;
-                PolynomialFactorizationPair<P>* pfPair = new PolynomialFactorizationPair<P>( std::move( factorization), new P(poly) );
+                PolynomialFactorizationPair<P>* pfPair = new PolynomialFactorizationPair<P>( std::move( factorization), std::make_shared<P>(poly) );
                 //Factorization is not set yet
-                auto ret = mpCache->cache( pfPair );//, &carl::canBeUpdated, &carl::update );
+                auto ret = mpCache->cacheAndReg( pfPair );
                 mCacheRef = ret.first;
-                mpCache->reg( mCacheRef );
                 if( ret.second )
                 {
                     assert( content().mFactorization.empty() );
@@ -103,9 +102,8 @@ namespace carl
             for ( auto factor = _factorization.begin(); factor != _factorization.end(); factor++ )
                 assert( carl::isOne(factor->first.coefficient()) );
             PolynomialFactorizationPair<P>* pfPair = new PolynomialFactorizationPair<P>( std::move( _factorization ) );
-            auto ret = mpCache->cache( pfPair );//, &carl::canBeUpdated, &carl::update );
+            auto ret = mpCache->cacheAndReg( pfPair );
             mCacheRef = ret.first;
-            mpCache->reg( mCacheRef );
             if( !ret.second )
             {
                 delete pfPair;
@@ -118,7 +116,8 @@ namespace carl
     FactorizedPolynomial<P>::FactorizedPolynomial( const FactorizedPolynomial<P>& _toCopy ):
         mCacheRef( _toCopy.mCacheRef ),
         mpCache( _toCopy.mpCache ),
-        mCoefficient( _toCopy.mCoefficient )
+        mCoefficient( _toCopy.mCoefficient ),
+        mpPolynomial( _toCopy.mpPolynomial )
     {
         if ( mpCache != nullptr )
         {
@@ -131,7 +130,8 @@ namespace carl
     FactorizedPolynomial<P>::FactorizedPolynomial( FactorizedPolynomial<P>&& rhs ):
         mCacheRef( rhs.mCacheRef ),
         mpCache( rhs.mpCache ),
-        mCoefficient( rhs.mCoefficient )
+        mCoefficient( rhs.mCoefficient ),
+        mpPolynomial( std::move( rhs.mpPolynomial ) )
     {
         ASSERT_CACHE_REF_LEGAL( (*this) );
         rhs.mCacheRef = CACHE::NO_REF;
@@ -196,6 +196,7 @@ namespace carl
         CARL_LOG_DEBUG("carl.core.factorizedpolynomial", "Copying " << _fpoly);
         ASSERT_CACHE_EQUAL( mpCache, _fpoly.pCache() );
         mCoefficient = _fpoly.mCoefficient;
+        mpPolynomial = _fpoly.mpPolynomial;
         if( mCacheRef != _fpoly.cacheRef() )
         {
             if( mpCache != nullptr )
@@ -1123,6 +1124,7 @@ namespace carl
             mpCache->dereg( mCacheRef );
             mCacheRef = CACHE::NO_REF;
             mpCache = nullptr;
+            mpPolynomial = nullptr;
         }
         mCoefficient *= _coef;
         ASSERT_CACHE_REF_LEGAL( (*this) );
@@ -0,0 +1,114 @@
+/**
+ * @file HeapMultiplication.h
+ * @ingroup multirp
+ */
+
+#pragma once
+
+#include "CompareResult.h"
+#include "Monomial.h"
+#include "Term.h"
+#include "../numbers/numbers.h"
+#include "../util/Heap.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace carl {
+
+namespace heap_multiplication {
+	/**
+	 * A term product `lhs[row] * rhs[col]` that is currently stored in the heap.
+	 * Rows and columns are counted from the leading terms.
+	 */
+	struct Entry {
+		std::size_t row;
+		std::size_t col;
+		Monomial::Arg monomial;
+	};
+
+	/**
+	 * Configuration of carl::Heap for the multiplication: the heap yields the largest product monomial with respect to the ordering.
+	 */
+	template<typename Ordering>
+	struct Configuration {
+		using Entry = heap_multiplication::Entry*;
+		using CompareResult = carl::CompareResult;
+		static CompareResult compare(Entry e1, Entry e2) {
+			return Ordering::compare(e1->monomial, e2->monomial);
+		}
+		static bool cmpLessThan(CompareResult res) {
+			return res == CompareResult::LESS;
+		}
+		static const bool supportDeduplicationWhileOrdering = false;
+		static bool cmpEqual(CompareResult res) {
+			return res == CompareResult::EQUAL;
+		}
+		static const bool fastIndex = true;
+	};
+}
+
+/**
+ * Multiplies two polynomials given as fully ordered term vectors with a heap of term products (Johnson's algorithm, see @cite MonaganPearce).
+ *
+ * The ordering must be compatible with multiplication, which is the case for degree orderings like GrLexOrdering.
+ * Then, `lhs[i] * rhs[j]` is larger than `lhs[i] * rhs[j-1]` and `lhs[i-1] * rhs[j]`.
+ * Hence, it suffices to keep at most one term product per term of the shorter polynomial in the heap.
+ * The products are generated in descending order, equal monomials are combined immediately and no sorting of the result is necessary.
+ * Besides the result, only `O(min(|lhs|, |rhs|))` memory is used.
+ * @param lhs Terms of the first polynomial, ordered ascendingly.
+ * @param rhs Terms of the second polynomial, ordered ascendingly.
+ * @return Terms of `lhs * rhs`, ordered ascendingly and without zero terms.
+ */
+template<typename Ordering, typename Coeff>
+std::vector<Term<Coeff>> heapMultiplication(const std::vector<Term<Coeff>>& lhs, const std::vector<Term<Coeff>>& rhs) {
+	if (lhs.size() > rhs.size()) {
+		return heapMultiplication<Ordering>(rhs, lhs);
+	}
+	std::vector<Term<Coeff>> result;
+	if (lhs.empty()) return result;
+	result.reserve(lhs.size() + rhs.size());
+	auto row = [&lhs](std::size_t i) -> const Term<Coeff>& { return lhs[lhs.size() - 1 - i]; };
+	auto col = [&rhs](std::size_t j) -> const Term<Coeff>& { return rhs[rhs.size() - 1 - j]; };
+
+	// There is at most one entry for every row, the heap refers to them by pointers.
+	std::vector<heap_multiplication::Entry> entries(lhs.size());
+	Heap<heap_multiplication::Configuration<Ordering>> heap(heap_multiplication::Configuration<Ordering>{});
+	entries[0] = { 0, 0, row(0).monomial() * col(0).monomial() };
+	heap.push(&entries[0]);
+
+	Monomial::Arg monomial = entries[0].monomial;
+	Coeff coeff = constant_zero<Coeff>::get();
+	while (!heap.empty()) {
+		heap_multiplication::Entry* e = heap.top();
+		if (e->monomial != monomial) {
+			if (!carl::isZero(coeff)) {
+				result.emplace_back(std::move(coeff), std::move(monomial));
+			}
+			monomial = e->monomial;
+			coeff = constant_zero<Coeff>::get();
+		}
+		coeff += row(e->row).coeff() * col(e->col).coeff();
+
+		// The first product of a row is in the heap if and only if the previous row has advanced.
+		std::size_t nextRow = (e->col == 0) ? e->row + 1 : lhs.size();
+		if (e->col + 1 < rhs.size()) {
+			e->col++;
+			e->monomial = row(e->row).monomial() * col(e->col).monomial();
+			heap.decreaseTop(e);
+		} else {
+			heap.pop();
+		}
+		if (nextRow < lhs.size()) {
+			entries[nextRow] = { nextRow, 0, row(nextRow).monomial() * col(0).monomial() };
+			heap.push(&entries[nextRow]);
+		}
+	}
+	if (!carl::isZero(coeff)) {
+		result.emplace_back(std::move(coeff), std::move(monomial));
+	}
+	std::reverse(result.begin(), result.end());
+	return result;
+}
+
+}
@@ -503,6 +503,10 @@ namespace carl
 		// Orderings
 		///////////////////////////
 
+		/**
+		 * Pure lexicographic ordering, where larger variables take precedence as in compareGradedLexical().
+		 * lexicalCompare() can not be used here, as it is only compatible with multiplication for monomials of the same degree.
+		 */
 		static CompareResult compareLexical(const Monomial::Arg& lhs, const Monomial::Arg& rhs)
 		{
 			if( !lhs && !rhs )
@@ -511,15 +515,30 @@ namespace carl
 				return CompareResult::LESS;
 			if( !rhs )
 				return CompareResult::GREATER;
-			return lexicalCompare(*lhs, *rhs);
+			if (lhs->id() == rhs->id() && lhs->id() != 0)
+				return CompareResult::EQUAL;
+			auto lhsit = lhs->mExponents.rbegin();
+			auto rhsit = rhs->mExponents.rbegin();
+			for (; lhsit != lhs->mExponents.rend() && rhsit != rhs->mExponents.rend(); ++lhsit, ++rhsit) {
+				// The monomial with the larger variable has a positive exponent where the other one has none.
+				if (lhsit->first != rhsit->first)
+					return (lhsit->first > rhsit->first) ? CompareResult::GREATER : CompareResult::LESS;
+				if (lhsit->second != rhsit->second)
+					return (lhsit->second > rhsit->second) ? CompareResult::GREATER : CompareResult::LESS;
+			}
+			if (lhsit != lhs->mExponents.rend())
+				return CompareResult::GREATER;
+			if (rhsit != rhs->mExponents.rend())
+				return CompareResult::LESS;
+			return CompareResult::EQUAL;
 		}
 		
 		static CompareResult compareLexical(const Monomial::Arg& lhs, Variable rhs)
 		{
 			if(!lhs) return CompareResult::LESS;
-			if(lhs->mExponents.front().first < rhs) return CompareResult::GREATER;
-			if(lhs->mExponents.front().first > rhs) return CompareResult::LESS;
-			if(lhs->mExponents.front().second > 1) return CompareResult::GREATER;
+			if(lhs->mExponents.back().first > rhs) return CompareResult::GREATER;
+			if(lhs->mExponents.back().first < rhs) return CompareResult::LESS;
+			if(lhs->mExponents.back().second > 1 || lhs->mExponents.size() > 1) return CompareResult::GREATER;
 			return CompareResult::EQUAL;
 		}
 
@@ -11,26 +11,22 @@ namespace carl
 {
 	Monomial::Arg MonomialPool::add( MonomialPool::PoolEntry&& pe, exponent totalDegree) {
 		CARL_LOG_TRACE("carl.core.monomial", pe.content << " / " << pe.hash << ", " << totalDegree);
-		for (const auto& pe: mPool) {
-			CARL_LOG_TRACE("carl.core.monomial", "\t" << pe.content << " / " << pe.hash << " / " << pe.monomial.lock().get());
+		std::size_t hash = pe.hash;
+		Shard& s = shard(hash);
+		MONOMIAL_POOL_LOCK_GUARD(s);
+		for (const auto& entry: s.mPool) {
+			CARL_LOG_TRACE("carl.core.monomial", "\t" << entry.content << " / " << entry.hash << " / " << entry.monomial.lock().get());
 		}
-		MONOMIAL_POOL_LOCK_GUARD
-		auto iter = mPool.insert(std::move(pe));
-		Monomial::Arg res;
-		if (iter.second) {
+		auto iter = s.mPool.insert(std::move(pe));
+		Monomial::Arg res = iter.first->monomial.lock();
+		if (iter.second || !res) {
+			// Either newly added or the monomial is currently being destructed by another thread.
 			CARL_LOG_TRACE("carl.core.monomial", "Was newly added");
-			if (iter.first->monomial.expired()) {
-				CARL_LOG_TRACE("carl.core.monomial", "Weakptr is expired");
-				res = Monomial::Arg(new Monomial(Monomial::is_sorted{}, iter.first->content, totalDegree, iter.first->hash));
-				iter.first->monomial = res;
-			} else {
-				res = iter.first->monomial.lock();
-				CARL_LOG_TRACE("carl.core.monomial", "Got existing weakptr as " << res);
-			}
-			res->mId = mIDs.get();
+			res = Monomial::Arg(new Monomial(Monomial::is_sorted{}, iter.first->content, totalDegree, iter.first->hash));
+			iter.first->monomial = res;
+			res->mId = getID(hash);
 			CARL_LOG_TRACE("carl.core.monomial", "ID = " << res->mId);
 		} else {
-			res = iter.first->monomial.lock();
 			CARL_LOG_TRACE("carl.core.monomial", "Was already there as " << res);
 		}
 		return res;
@@ -39,15 +35,21 @@ namespace carl
 	Monomial::Arg MonomialPool::add( const Monomial::Arg& _monomial ) {
 		assert(_monomial->id() == 0);
 		PoolEntry pe(_monomial->hash(), _monomial->exponents(), _monomial);
-		MONOMIAL_POOL_LOCK_GUARD
-		auto iter = mPool.insert(pe);
+		Shard& s = shard(pe.hash);
+		MONOMIAL_POOL_LOCK_GUARD(s);
+		auto iter = s.mPool.insert(pe);
 		if (iter.second) {
-			_monomial->mId = mIDs.get();
+			_monomial->mId = getID(pe.hash);
 			return _monomial;
-		} else {
-			assert(_monomial == iter.first->monomial.lock());
-			return iter.first->monomial.lock();
 		}
+		Monomial::Arg res = iter.first->monomial.lock();
+		if (!res) {
+			// The monomial is currently being destructed by another thread.
+			iter.first->monomial = _monomial;
+			_monomial->mId = getID(pe.hash);
+			return _monomial;
+		}
+		return res;
 	}
 	
 	Monomial::Arg MonomialPool::add( Monomial::Content&& c, exponent totalDegree) {
@@ -12,7 +12,10 @@
 #include "Monomial.h"
 #include "config.h"
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <unordered_set>
 
 namespace carl{
@@ -56,25 +59,62 @@ namespace carl{
 				}
 			};
 		private:
+			using PoolSet = std::unordered_set<PoolEntry, MonomialPool::hash, MonomialPool::equal>;
+			
+			/**
+			 * Number of shards the pool is split into.
+			 * Every shard is locked independently, hence monomials with different hashes can be created concurrently.
+			 * Without THREAD_SAFE there is no lock to contend for and we use a single shard to keep the IDs dense.
+			 */
+#if defined(THREAD_SAFE) && defined(SHARDED_MONOMIAL_POOL)
+			static constexpr std::size_t NUM_SHARDS = 16;
+#else
+			static constexpr std::size_t NUM_SHARDS = 1;
+#endif
+			/**
+			 * A part of the pool.
+			 * A shard owns all IDs `id` with `id % NUM_SHARDS` being its index, its local id allocator hands out `id / NUM_SHARDS`.
+			 */
+			struct alignas(64) Shard {
+				/// local id allocator
+				IDPool mIDs;
+				/// The monomials of this shard.
+				PoolSet mPool;
+				/// Mutex to avoid multiple access to this shard
+				mutable std::recursive_mutex mMutex;
+			};
+			
 			// Members:
-			/// id allocator
-			IDPool mIDs;
-			//size_t mIdAllocator;
-			/// The pool.
-			std::unordered_set<PoolEntry, MonomialPool::hash, MonomialPool::equal> mPool;
-			/// Mutex to avoid multiple access to the pool
-			mutable std::recursive_mutex mMutex;
+			/// The shards.
+			std::array<Shard, NUM_SHARDS> mShards;
+			/// Largest ID ever handed out by any of the shards.
+			std::atomic<std::size_t> mLargestID;
 			
             #ifdef THREAD_SAFE
-			#define MONOMIAL_POOL_LOCK_GUARD std::lock_guard<std::recursive_mutex> lock( mMutex );
-			#define MONOMIAL_POOL_LOCK mMutex.lock();
-			#define MONOMIAL_POOL_UNLOCK mMutex.unlock();
+			#define MONOMIAL_POOL_LOCK_GUARD(shard) std::lock_guard<std::recursive_mutex> lock( (shard).mMutex );
             #else
-			#define MONOMIAL_POOL_LOCK_GUARD
-			#define MONOMIAL_POOL_LOCK
-			#define MONOMIAL_POOL_UNLOCK
+			#define MONOMIAL_POOL_LOCK_GUARD(shard)
             #endif
-
+			
+			static std::size_t shardIndex(std::size_t hash) {
+				return hash % NUM_SHARDS;
+			}
+			Shard& shard(std::size_t hash) {
+				return mShards[shardIndex(hash)];
+			}
+			/**
+			 * Obtains a fresh global ID from the given shard.
+			 * Must be called while holding the lock of this shard.
+			 */
+			std::size_t getID(std::size_t hash) {
+				std::size_t id = shard(hash).mIDs.get() * NUM_SHARDS + shardIndex(hash);
+				std::size_t largest = mLargestID.load(std::memory_order_relaxed);
+				while (largest < id && !mLargestID.compare_exchange_weak(largest, id, std::memory_order_relaxed));
+				return id;
+			}
+			void freeID(std::size_t id) {
+				mShards[id % NUM_SHARDS].mIDs.free(id / NUM_SHARDS);
+			}
 			
 		protected:
 			
@@ -83,10 +123,12 @@ namespace carl{
 			 * @param _capacity Expected necessary capacity of the pool.
 			 */
 			explicit MonomialPool( std::size_t _capacity = 10000 ):
-				mPool(_capacity)
+				mLargestID(0)
 			{
-				mIDs.get();
-				assert(mIDs.largestID() == 0);
+				for (auto& s: mShards) s.mPool.reserve(_capacity / NUM_SHARDS);
+				// Reserve ID 0 for the constant monomial.
+				mShards[0].mIDs.get();
+				assert(largestID() == 0);
 				VariablePool::getInstance();
 				CARL_LOG_DEBUG("carl.pool", "Monomialpool constructed");
 			}
@@ -123,13 +165,17 @@ namespace carl{
 				CARL_LOG_TRACE("carl.core.monomial", "Freeing " << m);
 				if (m == nullptr) return;
 				if (m->id() == 0) return;
-				MONOMIAL_POOL_LOCK_GUARD;
+				Shard& s = shard(m->mHash);
+				MONOMIAL_POOL_LOCK_GUARD(s);
 				PoolEntry pe(m->mHash, m->mExponents);
-				auto it = mPool.find(pe);
-				if (it != mPool.end()) {
+				auto it = s.mPool.find(pe);
+				if (it != s.mPool.end()) {
 					CARL_LOG_TRACE("carl.core.monomial", "Found " << it->content << " / " << it->hash);
-					mIDs.free(m->id());
-					mPool.erase(it);
+					freeID(m->id());
+					// Another thread may have revived this entry with a new monomial in the meantime.
+					if (it->monomial.expired()) {
+						s.mPool.erase(it);
+					}
 				} else {
 					CARL_LOG_TRACE("carl.core.monomial", "Not found in pool.");
 				}
@@ -139,22 +185,39 @@ namespace carl{
 			 * Clears everything already created in this pool.
 			 */
 			void clear() {
-				mPool.clear();
-				mIDs.clear();
+				for (auto& s: mShards) {
+					MONOMIAL_POOL_LOCK_GUARD(s);
+					s.mPool.clear();
+					s.mIDs.clear();
+				}
+				// ID 0 stays reserved for the constant monomial.
+				mShards[0].mIDs.get();
 			}
 
 			std::size_t size() const {
-				return mPool.size();
+				std::size_t res = 0;
+				for (const auto& s: mShards) {
+					MONOMIAL_POOL_LOCK_GUARD(s);
+					res += s.mPool.size();
+				}
+				return res;
 			}
+			/**
+			 * Returns the largest ID that was handed out so far.
+			 * IDs are spread over the shards, hence this may be slightly larger than size().
+			 * Does not lock and is thus cheap to call.
+			 */
 			std::size_t largestID() const {
-				return mIDs.largestID();
+				return mLargestID.load(std::memory_order_relaxed);
 			}
 	};
 	
 	inline std::ostream& operator<<(std::ostream& os, const MonomialPool& mp) {
 		os << "MonomialPool of size " << mp.size() << std::endl;
-		for (const auto& entry: mp.mPool) {
-			os << "\t" << entry.content << " / " << entry.hash << std::endl;
+		for (const auto& s: mp.mShards) {
+			for (const auto& entry: s.mPool) {
+				os << "\t" << entry.content << " / " << entry.hash << std::endl;
+			}
 		}
 		return os;
 	}
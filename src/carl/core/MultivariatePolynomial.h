@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "DivisionResult.h"
+#include "HeapMultiplication.h"
 #include "MultivariatePolynomialPolicy.h"
 #include "Polynomial.h"
 #include "Term.h"
@@ -1708,6 +1708,15 @@ MultivariatePolynomial<Coeff,Ordering,Policies>& MultivariatePolynomial<Coeff,Or
 		*this = rhs;
 		return *this *= c;
 	}
+	// The heap requires an ordering that is compatible with multiplication, which is only guaranteed for degree orderings.
+	if (Ordering::degreeOrder && (Policies::multiplication == MultiplicationStrategy::Heap || (Policies::multiplication == MultiplicationStrategy::Auto && mTerms.size() * rhs.mTerms.size() >= Policies::heapMultiplicationThreshold))) {
+		makeOrdered();
+		rhs.makeOrdered();
+		mTerms = heapMultiplication<Ordering>(mTerms, rhs.mTerms);
+		mOrdered = true;
+		assert(this->isConsistent());
+		return *this;
+	}
 	auto id = mTermAdditionManager.getId(mTerms.size() * rhs.mTerms.size());
 	TermType newlterm;
 	bool first = true;
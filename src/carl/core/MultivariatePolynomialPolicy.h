@@ -12,6 +12,20 @@
 
 namespace carl
 {
+    /**
+     * Strategies to compute the product of two polynomials.
+	 * @ingroup multirp
+     */
+    enum class MultiplicationStrategy {
+        /// Collect all term products by monomial id in the TermAdditionManager. The result is only minimally ordered.
+        TermAddition,
+        /// Merge the term products with a heap, see heapMultiplication(). The result is fully ordered.
+        /// Only used for degree orderings, otherwise TermAddition is used.
+        Heap,
+        /// Use the heap if the number of term products is at least the policy's heapMultiplicationThreshold.
+        Auto
+    };
+
     /**
      * The default policy for polynomials. 
 	 * @ingroup multirp
@@ -26,6 +40,15 @@ namespace carl
          * Although the worst-case complexity is worse, for polynomials with a small nr of terms, this should be better.
          */
         static const bool searchLinear = true;
+
+        /**
+         * Strategy used to multiply two polynomials.
+         */
+        static const MultiplicationStrategy multiplication = MultiplicationStrategy::Auto;
+        /**
+         * Number of term products from which on MultiplicationStrategy::Auto uses the heap.
+         */
+        static const std::size_t heapMultiplicationThreshold = 4096;
 		
 		// Easy access.
 		static const bool has_reasons = ReasonsAdaptor::has_reasons;
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <mutex>
 
 #include "Monomial.h"
@@ -115,9 +116,10 @@ namespace carl
         mutable Factorization<P> mFactorization;
         
         /**
-         * A pointer to a polynomial. This pointer might be set to nullptr, if the factorization has not yet been expanded.
+         * A pointer to a polynomial. This pointer might be set to nullptr, if the factorization has not yet been expanded or the polynomial has been released.
+         * The polynomial is shared with the factorized polynomials which obtained it by FactorizedPolynomial::polynomial(), such that it stays valid for them after a release.
          */
-        mutable P* mpPolynomial;
+        mutable std::shared_ptr<P> mpPolynomial;
 
         /**
          * Indicates, if the polynomial is irreducible
@@ -192,9 +194,9 @@ namespace carl
          * @param _factorization The factorization. Every factor must be not constant.
          * @param _polynomial Polynomial with Polynomial = Factorization * Coefficient
          */
-        explicit PolynomialFactorizationPair( Factorization<P>&& _factorization, P* _polynomial = nullptr );
+        explicit PolynomialFactorizationPair( Factorization<P>&& _factorization, std::shared_ptr<P> _polynomial = nullptr );
         PolynomialFactorizationPair( const PolynomialFactorizationPair& ) = delete; // no implementation
-        ~PolynomialFactorizationPair();
+        ~PolynomialFactorizationPair() = default;
 		
 		PolynomialFactorizationPair& operator=(const PolynomialFactorizationPair& pfp) = default;
         
@@ -210,6 +212,41 @@ namespace carl
 			return *mpPolynomial;
 		}
         
+        /**
+         * @return An estimate of the memory in bytes used by this pair, excluding the memory of its factors.
+         */
+        std::size_t memoryUsage() const;
+        
+        /**
+         * Releases the expanded polynomial, if it is a proper product of the factors, i.e., if it can be recomputed from the factorization.
+         * The hash is not changed, such that this pair can stay in a cache. The polynomial is recomputed lazily by FactorizedPolynomial::polynomial().
+         * Factorized polynomials which already obtained the polynomial keep their copy of the pointer.
+         * @return The estimated number of bytes released.
+         */
+        std::size_t releaseMemory() const;
+        
+        /**
+         * @return true, if this pair is factorized trivially. Then its only factor is a factorized polynomial of itself, which uses its entry in the cache.
+         */
+        bool referencesItself() const
+        {
+            return !mFactorization.empty() && factorizedTrivially();
+        }
+        
+        /**
+         * Removes the trivial factorization and hence the usage of the own entry in the cache.
+         * Afterwards, this pair must be removed from the cache.
+         */
+        void releaseSelfReference() const
+        {
+            assert( referencesItself() );
+            Factorization<P> factorization;
+            {
+                std::lock_guard<std::recursive_mutex> lock( mMutex );
+                std::swap( factorization, mFactorization );
+            }
+        }
+        
         /**
          * @param _polyFactA The first polynomial factorization pair to compare.
          * @param _polyFactB The second polynomial factorization pair to compare.
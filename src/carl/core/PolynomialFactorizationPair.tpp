@@ -83,11 +83,11 @@ namespace carl
     }
     
     template<typename P>
-    PolynomialFactorizationPair<P>::PolynomialFactorizationPair( Factorization<P>&& _factorization, P* _polynomial ):
+    PolynomialFactorizationPair<P>::PolynomialFactorizationPair( Factorization<P>&& _factorization, std::shared_ptr<P> _polynomial ):
         mHash( 0 ),
 		mMutex(),
         mFactorization( std::move( _factorization ) ),
-        mpPolynomial( _polynomial ),
+        mpPolynomial( std::move( _polynomial ) ),
         mIrreducible( -1 )
     {
         if ( mpPolynomial == nullptr )
@@ -96,7 +96,9 @@ namespace carl
             {
                 // No factorization -> set polynomial
                 assert( existsFactorization( mFactorization.begin()->first ) );
-                mpPolynomial = new P( mFactorization.begin()->first.content().mpPolynomial->pow( mFactorization.begin()->second ) );
+                const auto& factor = mFactorization.begin()->first.content();
+                // The polynomial of the factor might have been released by the cache.
+                mpPolynomial = std::make_shared<P>( computePolynomial( factor ).pow( mFactorization.begin()->second ) );
                 assert( mpPolynomial != nullptr );
             }
         }
@@ -116,19 +118,13 @@ namespace carl
         rehash();
     }
     
-    template<typename P>
-    PolynomialFactorizationPair<P>::~PolynomialFactorizationPair()
-    {
-        delete mpPolynomial;
-    }
-
     template<typename P>
     void PolynomialFactorizationPair<P>::rehash() const
     {
         std::lock_guard<std::recursive_mutex> lock( mMutex );
         if( mpPolynomial == nullptr )
         {
-            assert( mFactorization.empty() || mFactorization.size() > 1 );
+            assert( mFactorization.size() != 1 || mFactorization.begin()->second > 1 );
             mHash = 0;
             for( auto polyExpPair = mFactorization.begin(); polyExpPair != mFactorization.end(); ++polyExpPair )
             {
@@ -144,6 +140,30 @@ namespace carl
         }
     }
 
+    template<typename P>
+    std::size_t PolynomialFactorizationPair<P>::memoryUsage() const
+    {
+        std::lock_guard<std::recursive_mutex> lock( mMutex );
+        // Nodes of the factorization consist of the value and about four pointers.
+        std::size_t result = sizeof( *this ) + mFactorization.size() * (sizeof( typename Factorization<P>::value_type ) + 4 * sizeof( void* ));
+        if( mpPolynomial != nullptr )
+            result += sizeof( P ) + mpPolynomial->nrTerms() * sizeof( typename P::TermType );
+        return result;
+    }
+    
+    template<typename P>
+    std::size_t PolynomialFactorizationPair<P>::releaseMemory() const
+    {
+        std::lock_guard<std::recursive_mutex> lock( mMutex );
+        if( mpPolynomial == nullptr || mFactorization.empty() )
+            return 0;
+        if( mFactorization.size() == 1 && mFactorization.begin()->second == 1 )
+            return 0;
+        std::size_t result = sizeof( P ) + mpPolynomial->nrTerms() * sizeof( typename P::TermType );
+        mpPolynomial.reset();
+        return result;
+    }
+    
     template<typename P>
     bool operator==( const PolynomialFactorizationPair<P>& _polyFactA, const PolynomialFactorizationPair<P>& _polyFactB )
     {
@@ -166,9 +186,9 @@ namespace carl
             {
                 // There is no way around this );
                 if( _polyFactA.mpPolynomial == nullptr )
-                    _polyFactA.mpPolynomial = new P( computePolynomial( _polyFactA.factorization() ) );
+                    _polyFactA.mpPolynomial = std::make_shared<P>( computePolynomial( _polyFactA.factorization() ) );
                 if( _polyFactB.mpPolynomial == nullptr )
-                    _polyFactB.mpPolynomial = new P( computePolynomial( _polyFactB.factorization() ) );
+                    _polyFactB.mpPolynomial = std::make_shared<P>( computePolynomial( _polyFactB.factorization() ) );
                 return *_polyFactA.mpPolynomial == *_polyFactB.mpPolynomial;
             }
         }
@@ -271,8 +291,13 @@ namespace carl
     template<typename P>
     P computePolynomial( const PolynomialFactorizationPair<P>& _pfPair )
     {
-        if( _pfPair.mpPolynomial != nullptr )
-            return *_pfPair.mpPolynomial;
+        std::shared_ptr<P> polynomial;
+        {
+            std::lock_guard<std::recursive_mutex> lock( _pfPair.mMutex );
+            polynomial = _pfPair.mpPolynomial;
+        }
+        if( polynomial != nullptr )
+            return *polynomial;
         return computePolynomial( _pfPair.factorization() );
     }
 
@@ -328,7 +353,13 @@ namespace carl
         if ( mIrreducible != -1 )
             return mIrreducible == 1;
 
-        assert( mpPolynomial != nullptr );
+        if ( mpPolynomial == nullptr )
+        {
+            // The polynomial is a proper product of its factors.
+            assert( mFactorization.size() > 1 || mFactorization.begin()->second > 1 );
+            mIrreducible = 0;
+            return false;
+        }
         if ( mpPolynomial->isLinear() )
         {
             mIrreducible = 1;
@@ -484,10 +515,8 @@ namespace carl
                     else
                     {
                         //Compute GCD of factors
-                        assert( factorA.content().mpPolynomial != nullptr );
-                        assert( factorB.content().mpPolynomial != nullptr );
-                        polA = *factorA.content().mpPolynomial;
-                        polB = *factorB.content().mpPolynomial;
+                        polA = computePolynomial( factorA.content() );
+                        polB = computePolynomial( factorB.content() );
                         polGCD = carl::gcd( polA, polB );
                         if (carl::isNegative(polGCD.lcoeff())) {
                             polGCD = -polGCD;
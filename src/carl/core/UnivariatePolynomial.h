@@ -530,6 +530,8 @@ public:
 	/**
 	 * Divides the polynomial by another polynomial.
 	 * Applies if the polynomial both have coefficients over a field.
+	 * For rational coefficients, dense_arithmetic::divide() is used if divisor and quotient exceed DenseArithmeticSettings::newtonDivisionThreshold.
+	 * For coefficients from a GaloisField<uint>, the division is done on machine words by the corresponding dense_arithmetic::divide().
 	 * @param divisor Divisor.
 	 * @return this / divisor.
 	 */
@@ -653,6 +655,12 @@ public:
 	UnivariatePolynomial<typename IntegralType<Coefficient>::type> toIntegerDomain() const;
 	
 	UnivariatePolynomial<GFNumber<typename IntegralType<Coefficient>::type>> toFiniteDomain(const GaloisField<typename IntegralType<Coefficient>::type>* galoisField) const;
+	/**
+	 * Maps the coefficients, which must be integers, to a field with p^k < 2^63.
+	 * Arithmetic on the resulting polynomial runs on machine words.
+	 */
+	template<typename C=Coefficient, DisableIf<std::is_same<typename IntegralType<C>::type, uint>> = dummy>
+	UnivariatePolynomial<GFNumber<uint>> toFiniteDomain(const GaloisField<uint>* galoisField) const;
 
 	template<typename C=Coefficient, DisableIf<is_number<C>> = dummy>
 	UnivariatePolynomial<NumberType> toNumberCoefficients(bool check = true) const;
@@ -872,6 +880,8 @@ public:
 	/// @{
 	/**
 	 * Multiply this polynomial with something and return the changed polynomial.
+	 * Products of polynomials with integral or rational coefficients use Karatsuba multiplication above DenseArithmeticSettings::karatsubaThreshold.
+	 * Products of polynomials with coefficients from a GaloisField<uint> are computed on machine words.
 	 * @param rhs Right hand side.
 	 * @return Changed polynomial.
 	 */
@@ -987,7 +997,7 @@ public:
 	 * Shift the variable by a, i.e. apply \f$ x \rightarrow x + a \f$
 	 * This method is meant to be called by signVariations only.
 	 * @param a Offset to shift x.
-	 * @complexity O(n^2)
+	 * @complexity O(n^2), for rational coefficients above DenseArithmeticSettings::taylorShiftThreshold the divide-and-conquer dense_arithmetic::taylorShift() is used.
 	 */
 	void shift(const Coefficient& a);	
 	
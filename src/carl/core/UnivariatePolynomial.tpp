@@ -10,6 +10,7 @@
 #include "../util/debug.h"
 #include "../util/platform.h"
 #include "../util/SFINAE.h"
+#include "DenseArithmetic.h"
 #include "logging.h"
 #include "MultivariatePolynomial.h"
 #include "Sign.h"
@@ -326,6 +327,13 @@ template<typename Coeff>
 UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::remainder(const UnivariatePolynomial<Coeff>& divisor) const
 {
 	static_assert(is_field<Coeff>::value, "Reduce must be called with a prefactor if the Coefficients are not from a field.");
+	if constexpr (dense_arithmetic::is_applicable<Coeff>::value) {
+		if (!carl::isZero(*this) && degree() >= divisor.degree() && std::min(divisor.mCoefficients.size(), degree() - divisor.degree() + 1) >= DenseArithmeticSettings::newtonDivisionThreshold) {
+			return this->divideBy(divisor).remainder;
+		}
+	} else if constexpr (std::is_same<Coeff, GFNumber<uint>>::value) {
+		return this->divideBy(divisor).remainder;
+	}
 	return this->remainder_helper(divisor);
 }
 
@@ -680,6 +688,25 @@ DivisionResult<UnivariatePolynomial<Coeff>> UnivariatePolynomial<Coeff>::divideB
 	{
 		return result;
 	}
+	if constexpr (dense_arithmetic::is_applicable<Coeff>::value) {
+		if (std::min(divisor.mCoefficients.size(), degree() - divisor.degree() + 1) >= DenseArithmeticSettings::newtonDivisionThreshold) {
+			dense_arithmetic::divide(mCoefficients, divisor.mCoefficients, result.quotient.mCoefficients, result.remainder.mCoefficients);
+			assert(*this == divisor * result.quotient + result.remainder);
+			return result;
+		}
+	} else if constexpr (std::is_same<Coeff, GFNumber<uint>>::value) {
+		const auto* gf = divisor.lcoeff().gf();
+		if (gf == nullptr) gf = dense_arithmetic::field(mCoefficients);
+		if (gf != nullptr) {
+			std::vector<uint> quotient;
+			std::vector<uint> remainder;
+			dense_arithmetic::divide(*gf, dense_arithmetic::toWords(*gf, mCoefficients), dense_arithmetic::toWords(*gf, divisor.mCoefficients), quotient, remainder);
+			result.quotient.mCoefficients = dense_arithmetic::fromWords(gf, quotient);
+			result.remainder.mCoefficients = dense_arithmetic::fromWords(gf, remainder);
+			assert(*this == divisor * result.quotient + result.remainder);
+			return result;
+		}
+	}
 	result.quotient.mCoefficients.resize(1+mCoefficients.size()-divisor.mCoefficients.size(), Coeff(0));
 	
 	do
@@ -813,6 +840,21 @@ UnivariatePolynomial<GFNumber<typename IntegralType<Coeff>::type>> UnivariatePol
 	
 }
 
+template<typename Coeff>
+template<typename C, DisableIf<std::is_same<typename IntegralType<C>::type, uint>>>
+UnivariatePolynomial<GFNumber<uint>> UnivariatePolynomial<Coeff>::toFiniteDomain(const GaloisField<uint>* galoisField) const
+{
+	UnivariatePolynomial<GFNumber<uint>> res(mMainVar);
+	res.mCoefficients.reserve(mCoefficients.size());
+	for(const Coeff& c : mCoefficients)
+	{
+		assert(carl::isInteger(c));
+		res.mCoefficients.emplace_back(getNum(c), galoisField);
+	}
+	res.stripLeadingZeroes();
+	return res;
+}
+
 template<typename Coeff>
 template<typename N, EnableIf<is_subset_of_rationals<N>>>
 typename UnivariatePolynomial<Coeff>::NumberType UnivariatePolynomial<Coeff>::numericContent() const
@@ -1171,6 +1213,13 @@ void UnivariatePolynomial<Coeff>::scale(const Coeff& factor) {
 
 template<typename Coeff>
 void UnivariatePolynomial<Coeff>::shift(const Coeff& a) {
+	// With Karatsuba multiplication, the divide-and-conquer shift does not pay off for integral coefficients.
+	if constexpr (is_rational<Coeff>::value) {
+		if (mCoefficients.size() >= DenseArithmeticSettings::taylorShiftThreshold) {
+			mCoefficients = dense_arithmetic::taylorShift(mCoefficients, a);
+			return;
+		}
+	}
 	std::vector<Coeff> next;
 	next.reserve(this->mCoefficients.size());
 	next.push_back(this->mCoefficients.back());
@@ -1377,6 +1426,20 @@ UnivariatePolynomial<Coeff>& UnivariatePolynomial<Coeff>::operator*=(const Univa
 		mCoefficients.clear();
 		return *this;
 	}
+	if constexpr (dense_arithmetic::is_applicable<Coeff>::value) {
+		if (std::min(mCoefficients.size(), rhs.mCoefficients.size()) >= DenseArithmeticSettings::karatsubaThreshold) {
+			mCoefficients = dense_arithmetic::multiply(mCoefficients, rhs.mCoefficients);
+			stripLeadingZeroes();
+			return *this;
+		}
+	} else if constexpr (std::is_same<Coeff, GFNumber<uint>>::value) {
+		const auto* gf = dense_arithmetic::field(mCoefficients);
+		if (gf == nullptr) gf = dense_arithmetic::field(rhs.mCoefficients);
+		if (gf != nullptr) {
+			mCoefficients = dense_arithmetic::fromWords(gf, dense_arithmetic::multiply(*gf, dense_arithmetic::toWords(*gf, mCoefficients), dense_arithmetic::toWords(*gf, rhs.mCoefficients)));
+			return *this;
+		}
+	}
 	
 	std::vector<Coeff> newCoeffs; 
 	newCoeffs.reserve(mCoefficients.size() + rhs.mCoefficients.size());
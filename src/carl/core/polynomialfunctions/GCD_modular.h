@@ -0,0 +1,654 @@
+/**
+ * @file GCD_modular.h
+ * @ingroup gcd
+ *
+ * Modular computation of multivariate gcds over the integers and the rationals.
+ * The gcd is computed modulo word-sized primes, either with Brown's dense algorithm @cite Brown71 or, once the support of the gcd is known, with Zippel's sparse interpolation @cite Zippel79.
+ * The images are combined by chinese remaindering until they stabilize and the result is verified by trial division.
+ * See also @cite GCL92, chapter 7.
+ */
+
+#pragma once
+
+#include "../MultivariatePolynomial.h"
+#include "../../numbers/numbers.h"
+#include "../../numbers/ChineseRemainder.h"
+#include "../../numbers/GaloisField.h"
+#include "../../numbers/PrimeFactory.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace carl {
+
+namespace gcd_detail {
+namespace modular {
+	using Residue = std::uint64_t;
+	using Exponents = std::vector<exponent>;
+	/// Dense univariate polynomial over Z_p. Coefficients are ordered by increasing degree, there are no leading zeros.
+	using UPoly = std::vector<Residue>;
+	/**
+	 * Polynomial in x_1, ..., x_k over Z_p in recursive representation.
+	 * Maps the exponents of x_1, ..., x_{k-1} to the coefficient, which is a univariate polynomial in x_k.
+	 * The entries are ordered lexicographically descending, hence the first entry contains the leading term.
+	 */
+	using RPoly = std::map<Exponents, UPoly, std::greater<Exponents>>;
+	/// Polynomial in x_1, ..., x_n over Z_p as list of terms, ordered lexicographically descending.
+	using FlatPoly = std::vector<std::pair<Exponents, Residue>>;
+	/// Polynomial in x_1, ..., x_n over the integers, ordered lexicographically descending.
+	using IntPoly = std::map<Exponents, mpz_class, std::greater<Exponents>>;
+
+	/// Arithmetic in Z_p for a prime p < 2^32.
+	using Field = GaloisField<uint>;
+
+	/// @name Univariate polynomials over Z_p
+	/// @{
+	inline void trim(UPoly& u) {
+		while (!u.empty() && u.back() == 0) u.pop_back();
+	}
+	/// Degree of a nonzero polynomial.
+	inline std::size_t degree(const UPoly& u) {
+		assert(!u.empty());
+		return u.size() - 1;
+	}
+	inline Residue evaluate(const Field& F, const UPoly& u, Residue v) {
+		Residue res = 0;
+		for (auto it = u.rbegin(); it != u.rend(); ++it) {
+			res = F.add(F.mul(res, v), *it);
+		}
+		return res;
+	}
+	inline UPoly add(const Field& F, const UPoly& a, const UPoly& b) {
+		UPoly res(std::max(a.size(), b.size()), 0);
+		for (std::size_t i = 0; i < a.size(); ++i) res[i] = a[i];
+		for (std::size_t i = 0; i < b.size(); ++i) res[i] = F.add(res[i], b[i]);
+		trim(res);
+		return res;
+	}
+	inline UPoly scale(const Field& F, const UPoly& a, Residue c) {
+		if (c == 0) return UPoly();
+		UPoly res(a);
+		for (auto& r: res) r = F.mul(r, c);
+		return res;
+	}
+	inline UPoly multiply(const Field& F, const UPoly& a, const UPoly& b) {
+		if (a.empty() || b.empty()) return UPoly();
+		UPoly res(a.size() + b.size() - 1, 0);
+		for (std::size_t i = 0; i < a.size(); ++i) {
+			if (a[i] == 0) continue;
+			for (std::size_t j = 0; j < b.size(); ++j) {
+				res[i+j] = F.add(res[i+j], F.mul(a[i], b[j]));
+			}
+		}
+		return res;
+	}
+	/// Divides a by b, a is replaced by the remainder and the quotient is returned.
+	inline UPoly divide(const Field& F, UPoly& a, const UPoly& b) {
+		assert(!b.empty());
+		if (a.size() < b.size()) return UPoly();
+		UPoly q(a.size() - b.size() + 1, 0);
+		Residue lcinv = F.inverse(b.back());
+		for (std::size_t i = q.size(); i-- > 0;) {
+			Residue c = F.mul(a[i + b.size() - 1], lcinv);
+			q[i] = c;
+			if (c == 0) continue;
+			for (std::size_t j = 0; j < b.size(); ++j) {
+				a[i+j] = F.sub(a[i+j], F.mul(c, b[j]));
+			}
+		}
+		trim(a);
+		return q;
+	}
+	/// Quotient of an exact division.
+	inline UPoly quotient(const Field& F, const UPoly& a, const UPoly& b) {
+		UPoly r(a);
+		UPoly q = divide(F, r, b);
+		assert(r.empty());
+		return q;
+	}
+	inline UPoly monic(const Field& F, const UPoly& a) {
+		if (a.empty() || a.back() == 1) return a;
+		return scale(F, a, F.inverse(a.back()));
+	}
+	/// Monic gcd of two polynomials.
+	inline UPoly gcd(const Field& F, UPoly a, UPoly b) {
+		while (!b.empty()) {
+			divide(F, a, b);
+			std::swap(a, b);
+		}
+		return monic(F, a);
+	}
+	/// @}
+
+	/// @name Recursive polynomials over Z_p
+	/// @{
+	/// Adds c to the coefficient of key, removes the entry if it vanishes.
+	inline void addTo(const Field& F, RPoly& r, const Exponents& key, const UPoly& c) {
+		auto it = r.find(key);
+		if (it == r.end()) {
+			if (!c.empty()) r.emplace(key, c);
+			return;
+		}
+		it->second = add(F, it->second, c);
+		if (it->second.empty()) r.erase(it);
+	}
+	/// Degree in the last variable.
+	inline std::size_t degree(const RPoly& r) {
+		std::size_t res = 0;
+		for (const auto& c: r) res = std::max(res, degree(c.second));
+		return res;
+	}
+	/// Exponents of the leading term.
+	inline Exponents leading(const RPoly& r) {
+		assert(!r.empty());
+		Exponents res(r.begin()->first);
+		res.push_back(exponent(degree(r.begin()->second)));
+		return res;
+	}
+	/// Checks whether the polynomial only depends on the last variable.
+	inline bool isUnivariate(const RPoly& r) {
+		return r.size() == 1 && std::all_of(r.begin()->first.begin(), r.begin()->first.end(), [](exponent e){ return e == 0; });
+	}
+	/// Monic gcd of all coefficients.
+	inline UPoly content(const Field& F, const RPoly& r) {
+		UPoly res;
+		for (const auto& c: r) {
+			res = gcd(F, res, c.second);
+			if (res.size() == 1) break;
+		}
+		return res;
+	}
+	inline RPoly scale(const Field& F, const RPoly& r, Residue c) {
+		RPoly res;
+		for (const auto& t: r) res.emplace_hint(res.end(), t.first, scale(F, t.second, c));
+		return res;
+	}
+	inline RPoly multiply(const Field& F, const RPoly& r, const UPoly& u) {
+		RPoly res;
+		for (const auto& t: r) res.emplace_hint(res.end(), t.first, multiply(F, t.second, u));
+		return res;
+	}
+	/// Divides all coefficients by u, assuming that the divisions are exact.
+	inline RPoly divide(const Field& F, const RPoly& r, const UPoly& u) {
+		if (u.size() == 1 && u[0] == 1) return r;
+		RPoly res;
+		for (const auto& t: r) res.emplace_hint(res.end(), t.first, quotient(F, t.second, u));
+		return res;
+	}
+	inline RPoly multiply(const Field& F, const RPoly& a, const RPoly& b) {
+		RPoly res;
+		Exponents key;
+		for (const auto& ta: a) {
+			for (const auto& tb: b) {
+				key = ta.first;
+				for (std::size_t i = 0; i < key.size(); ++i) key[i] += tb.first[i];
+				addTo(F, res, key, multiply(F, ta.second, tb.second));
+			}
+		}
+		return res;
+	}
+	/// Substitutes v for the last variable, the result is a polynomial in one variable less.
+	inline RPoly evaluate(const Field& F, const RPoly& r, Residue v) {
+		RPoly res;
+		for (const auto& t: r) {
+			Residue c = evaluate(F, t.second, v);
+			if (c == 0) continue;
+			Exponents key(t.first.begin(), t.first.end() - 1);
+			exponent d = t.first.back();
+			UPoly& u = res[key];
+			if (u.size() <= d) u.resize(d + 1, 0);
+			u[d] = c;
+		}
+		return res;
+	}
+	/**
+	 * Newton interpolation in the last variable.
+	 * Given h with h(v_i) = image_i for the previous points v_i and q = prod (x_k - v_i), updates h such that additionally h(v) = image.
+	 */
+	inline void interpolate(const Field& F, RPoly& h, const RPoly& image, const UPoly& q, Residue v) {
+		RPoly diff(image);
+		for (const auto& t: evaluate(F, h, v)) {
+			addTo(F, diff, t.first, scale(F, t.second, F.neg(1)));
+		}
+		UPoly base = scale(F, q, F.inverse(evaluate(F, q, v)));
+		Exponents key;
+		for (const auto& t: diff) {
+			key = t.first;
+			key.push_back(0);
+			for (std::size_t d = 0; d < t.second.size(); ++d) {
+				if (t.second[d] == 0) continue;
+				key.back() = exponent(d);
+				addTo(F, h, key, scale(F, base, t.second[d]));
+			}
+		}
+	}
+	inline RPoly fromFlat(const FlatPoly& f) {
+		RPoly res;
+		for (const auto& t: f) {
+			Exponents key(t.first.begin(), t.first.end() - 1);
+			exponent d = t.first.back();
+			UPoly& u = res[key];
+			if (u.size() <= d) u.resize(d + 1, 0);
+			u[d] = t.second;
+		}
+		return res;
+	}
+	inline FlatPoly toFlat(const RPoly& r) {
+		FlatPoly res;
+		for (const auto& t: r) {
+			Exponents e(t.first);
+			e.push_back(0);
+			for (std::size_t d = t.second.size(); d-- > 0;) {
+				if (t.second[d] == 0) continue;
+				e.back() = exponent(d);
+				res.emplace_back(e, t.second[d]);
+			}
+		}
+		return res;
+	}
+	inline FlatPoly reduce(const Field& F, const IntPoly& p) {
+		FlatPoly res;
+		for (const auto& t: p) {
+			Residue c = F.fromInteger(t.second);
+			if (c != 0) res.emplace_back(t.first, c);
+		}
+		return res;
+	}
+	/// @}
+
+	/// Image of the gcd modulo p together with the cofactors.
+	struct GCDImage {
+		/// The gcd, monic with respect to the lexicographic ordering.
+		RPoly gcd;
+		RPoly cofactorA;
+		RPoly cofactorB;
+	};
+
+	inline void normalize(const Field& F, GCDImage& image) {
+		Residue lc = image.gcd.begin()->second.back();
+		if (lc == 1) return;
+		image.gcd = scale(F, image.gcd, F.inverse(lc));
+		image.cofactorA = scale(F, image.cofactorA, lc);
+		image.cofactorB = scale(F, image.cofactorB, lc);
+	}
+
+	/**
+	 * Computes the gcd of two nonzero polynomials over Z_p with Brown's dense algorithm, see @cite GCL92, Algorithm 7.2.
+	 * The last variable is eliminated by evaluation, the gcds of the images are computed recursively and then interpolated.
+	 * Evaluation points where the degree of the gcd increases are discarded.
+	 * The interpolation terminates once the cofactors are determined and the products with the gcd match the inputs.
+	 */
+	inline GCDImage brown(const Field& F, const RPoly& a, const RPoly& b) {
+		assert(!a.empty() && !b.empty());
+		if (a.begin()->first.empty()) {
+			const UPoly& ua = a.begin()->second;
+			const UPoly& ub = b.begin()->second;
+			UPoly g = gcd(F, ua, ub);
+			return {
+				RPoly({{Exponents(), g}}),
+				RPoly({{Exponents(), quotient(F, ua, g)}}),
+				RPoly({{Exponents(), quotient(F, ub, g)}})
+			};
+		}
+		UPoly ca = content(F, a);
+		UPoly cb = content(F, b);
+		UPoly c = gcd(F, ca, cb);
+		RPoly ap = divide(F, a, ca);
+		RPoly bp = divide(F, b, cb);
+		auto contentOnly = [&]() {
+			GCDImage res{
+				RPoly({{Exponents(a.begin()->first.size(), 0), c}}),
+				multiply(F, ap, quotient(F, ca, c)),
+				multiply(F, bp, quotient(F, cb, c))
+			};
+			normalize(F, res);
+			return res;
+		};
+		if (isUnivariate(ap) || isUnivariate(bp)) return contentOnly();
+
+		const UPoly& la = ap.begin()->second;
+		const UPoly& lb = bp.begin()->second;
+		UPoly gamma = gcd(F, la, lb);
+		std::size_t bound = degree(gamma) + std::max(degree(ap), degree(bp));
+		RPoly h;
+		RPoly ha;
+		RPoly hb;
+		UPoly q = {1};
+		Exponents lm;
+		std::size_t points = 0;
+		for (Residue v = 0; v < F.p(); ++v) {
+			if (evaluate(F, la, v) == 0 || evaluate(F, lb, v) == 0) continue;
+			GCDImage image = brown(F, evaluate(F, ap, v), evaluate(F, bp, v));
+			Exponents lmv = leading(image.gcd);
+			if (std::all_of(lmv.begin(), lmv.end(), [](exponent e){ return e == 0; })) {
+				return contentOnly();
+			}
+			if (points > 0) {
+				if (lmv > lm) continue;
+				if (lmv < lm) {
+					h.clear();
+					ha.clear();
+					hb.clear();
+					q = {1};
+					points = 0;
+				}
+			}
+			lm = lmv;
+			interpolate(F, h, scale(F, image.gcd, evaluate(F, gamma, v)), q, v);
+			interpolate(F, ha, image.cofactorA, q, v);
+			interpolate(F, hb, image.cofactorB, q, v);
+			q = multiply(F, q, UPoly({F.neg(v), 1}));
+			++points;
+			if (points <= bound) continue;
+			if (multiply(F, h, ha) != multiply(F, ap, gamma)) continue;
+			if (multiply(F, h, hb) != multiply(F, bp, gamma)) continue;
+			// h = gamma / lc(g) * g, hence the cofactors carry an additional factor of lc(g) = gamma / content(h).
+			UPoly ch = content(F, h);
+			UPoly u = quotient(F, gamma, ch);
+			GCDImage res{
+				multiply(F, divide(F, h, ch), c),
+				multiply(F, divide(F, ha, u), quotient(F, ca, c)),
+				multiply(F, divide(F, hb, u), quotient(F, cb, c))
+			};
+			normalize(F, res);
+			return res;
+		}
+		assert(false);
+		return GCDImage();
+	}
+
+	/**
+	 * Solves the transposed Vandermonde system sum_i c_i k_i^j = v_j for j = 1, ..., t.
+	 * The k_i must be distinct and nonzero.
+	 */
+	inline std::vector<Residue> solveVandermonde(const Field& F, const std::vector<Residue>& k, const std::vector<Residue>& v) {
+		std::size_t t = k.size();
+		UPoly master = {1};
+		for (Residue ki: k) master = multiply(F, master, UPoly({F.neg(ki), 1}));
+		std::vector<Residue> res(t);
+		UPoly qi(t);
+		for (std::size_t i = 0; i < t; ++i) {
+			// qi = master / (x - k_i)
+			Residue acc = master[t];
+			for (std::size_t r = t; r-- > 0;) {
+				qi[r] = acc;
+				acc = F.add(master[r], F.mul(k[i], acc));
+			}
+			Residue num = 0;
+			for (std::size_t r = 0; r < t; ++r) num = F.add(num, F.mul(qi[r], v[r]));
+			Residue den = F.mul(evaluate(F, qi, k[i]), k[i]);
+			res[i] = F.mul(num, F.inverse(den));
+		}
+		return res;
+	}
+
+	/**
+	 * Computes the monic gcd of a and b over Z_p by sparse interpolation @cite Zippel79, assuming that its support is given by skeleton.
+	 * All variables except for the first one are evaluated at powers of a random point.
+	 * The coefficients of every power of x_1 are then obtained from transposed Vandermonde systems and checked against one additional image.
+	 * We require the leading coefficient of the gcd with respect to x_1 to be a monomial, as it allows to scale the univariate images consistently.
+	 * @return false if the images are inconsistent with the skeleton, the result is not valid in this case.
+	 */
+	inline bool zippel(const Field& F, const FlatPoly& a, const FlatPoly& b, const std::vector<Exponents>& skeleton, RPoly& result, std::mt19937& rng) {
+		std::map<exponent, std::vector<Exponents>, std::greater<exponent>> groups;
+		for (const auto& e: skeleton) groups[e.front()].push_back(e);
+		if (groups.begin()->second.size() != 1) return false;
+		std::size_t n = skeleton.front().size();
+		std::size_t degA = a.front().first.front();
+		std::size_t degB = b.front().first.front();
+		std::size_t terms = 0;
+		for (const auto& g: groups) terms = std::max(terms, g.second.size());
+		std::uniform_int_distribution<Residue> dist(1, F.p() - 1);
+
+		auto monomialValue = [&F](const Exponents& e, const std::vector<Residue>& point) {
+			Residue res = 1;
+			for (std::size_t i = 1; i < e.size(); ++i) res = F.mul(res, F.pow(point[i], e[i]));
+			return res;
+		};
+		auto evaluateAt = [&](const FlatPoly& p, const std::vector<Residue>& point) {
+			UPoly res(p.front().first.front() + 1, 0);
+			for (const auto& t: p) {
+				res[t.first.front()] = F.add(res[t.first.front()], F.mul(t.second, monomialValue(t.first, point)));
+			}
+			trim(res);
+			return res;
+		};
+
+		for (std::size_t attempt = 0; attempt < 3; ++attempt) {
+			std::vector<Residue> alpha(n);
+			for (std::size_t i = 1; i < n; ++i) alpha[i] = dist(rng);
+			// The monomials of every group must evaluate to distinct values.
+			std::map<exponent, std::vector<Residue>> values;
+			bool distinct = true;
+			for (const auto& g: groups) {
+				auto& vals = values[g.first];
+				for (const auto& e: g.second) vals.push_back(monomialValue(e, alpha));
+				std::vector<Residue> sorted(vals);
+				std::sort(sorted.begin(), sorted.end());
+				if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) distinct = false;
+			}
+			if (!distinct) continue;
+
+			std::vector<UPoly> images;
+			std::vector<Residue> point(alpha);
+			Residue lead = values[groups.begin()->first].front();
+			Residue leadPower = lead;
+			bool degreesKept = true;
+			for (std::size_t j = 1; j <= terms + 1; ++j) {
+				UPoly ua = evaluateAt(a, point);
+				UPoly ub = evaluateAt(b, point);
+				if (ua.size() != degA + 1 || ub.size() != degB + 1) {
+					degreesKept = false;
+					break;
+				}
+				UPoly g = gcd(F, ua, ub);
+				if (degree(g) != groups.begin()->first) return false;
+				images.push_back(scale(F, g, leadPower));
+				for (std::size_t i = 1; i < n; ++i) point[i] = F.mul(point[i], alpha[i]);
+				leadPower = F.mul(leadPower, lead);
+			}
+			if (!degreesKept) continue;
+
+			for (const auto& img: images) {
+				for (std::size_t d = 0; d < img.size(); ++d) {
+					if (img[d] != 0 && groups.find(exponent(d)) == groups.end()) return false;
+				}
+			}
+			FlatPoly res;
+			for (const auto& g: groups) {
+				const auto& k = values[g.first];
+				std::vector<Residue> v;
+				for (std::size_t j = 0; j <= k.size(); ++j) {
+					v.push_back(g.first < images[j].size() ? images[j][g.first] : 0);
+				}
+				Residue check = v.back();
+				v.pop_back();
+				std::vector<Residue> coeffs = solveVandermonde(F, k, v);
+				Residue sum = 0;
+				for (std::size_t i = 0; i < k.size(); ++i) {
+					sum = F.add(sum, F.mul(coeffs[i], F.pow(k[i], k.size() + 1)));
+				}
+				if (sum != check) return false;
+				for (std::size_t i = 0; i < k.size(); ++i) {
+					if (coeffs[i] != 0) res.emplace_back(g.second[i], coeffs[i]);
+				}
+			}
+			std::sort(res.begin(), res.end(), [](const auto& l, const auto& r){ return l.first > r.first; });
+			result = fromFlat(res);
+			return true;
+		}
+		return false;
+	}
+
+	/**
+	 * Combines h modulo m with the image modulo p using the chinese remainder theorem.
+	 * Coefficients are kept in the symmetric representation.
+	 * @return true if h changed.
+	 */
+	inline bool combine(const Field& F, IntPoly& h, mpz_class& m, const FlatPoly& image, Residue factor) {
+		bool changed = false;
+		ChineseRemainder crt(F, m, true);
+		auto update = [&](mpz_class& c, Residue r) {
+			if (crt.lift(c, r)) changed = true;
+		};
+		for (const auto& t: image) {
+			update(h[t.first], F.mul(t.second, factor));
+		}
+		std::set<Exponents> inImage;
+		for (const auto& t: image) inImage.insert(t.first);
+		for (auto it = h.begin(); it != h.end();) {
+			if (inImage.find(it->first) == inImage.end()) update(it->second, 0);
+			if (carl::isZero(it->second)) it = h.erase(it);
+			else ++it;
+		}
+		m = crt.modulus();
+		return changed;
+	}
+
+	/**
+	 * Converts a polynomial to a primitive integer polynomial in the given variables.
+	 * @param p Polynomial.
+	 * @param vars Ordered variables.
+	 * @param content Positive rational content such that p = content * result.
+	 */
+	template<typename C, typename O, typename P>
+	IntPoly toIntPoly(const MultivariatePolynomial<C,O,P>& p, const std::vector<Variable>& vars, C& content) {
+		auto denominator = [](const C& c) {
+			if constexpr (is_field<C>::value) return mpz_class(carl::getDenom(c));
+			else return mpz_class(1);
+		};
+		mpz_class num = 0;
+		mpz_class den = 1;
+		for (const auto& t: p) {
+			num = carl::gcd(num, mpz_class(carl::getNum(t.coeff())));
+			den = carl::lcm(den, denominator(t.coeff()));
+		}
+		content = C(num) / C(den);
+		IntPoly res;
+		for (const auto& t: p) {
+			Exponents e(vars.size(), 0);
+			if (t.monomial()) {
+				for (const auto& ve: *t.monomial()) {
+					e[std::size_t(std::lower_bound(vars.begin(), vars.end(), ve.first) - vars.begin())] = ve.second;
+				}
+			}
+			res.emplace(std::move(e), mpz_class(carl::getNum(t.coeff()) * (den / denominator(t.coeff()))) / num);
+		}
+		return res;
+	}
+
+	template<typename Poly>
+	Poly toPolynomial(const IntPoly& p, const std::vector<Variable>& vars) {
+		using C = typename Poly::CoeffType;
+		std::vector<Term<C>> terms;
+		for (const auto& t: p) {
+			std::vector<std::pair<Variable, exponent>> content;
+			for (std::size_t i = 0; i < vars.size(); ++i) {
+				if (t.first[i] > 0) content.emplace_back(vars[i], t.first[i]);
+			}
+			if (content.empty()) terms.emplace_back(C(t.second));
+			else terms.emplace_back(C(t.second), createMonomial(std::move(content)));
+		}
+		return Poly(std::move(terms), false, false);
+	}
+}
+}
+
+/**
+ * Computes the gcd of two multivariate polynomials with integer or rational coefficients using modular methods.
+ * Let a = c_a * A and b = c_b * B where c_a and c_b are the contents and A and B are primitive integer polynomials.
+ * The result is G, the primitive gcd of A and B with positive leading coefficient (with respect to O), for rational coefficients and gcd(c_a, c_b) * G for integer coefficients.
+ * Hence the leading coefficient of the result is always positive, independent of the signs of a and b.
+ *
+ * Prime images of G are computed with brown() or, once the support of G is known, with zippel().
+ * Primes that divide the leading coefficients are skipped, and so are primes whose image has a larger leading monomial.
+ * The images are combined until the result stabilizes and is confirmed by trial division.
+ */
+template<typename C, typename O, typename P>
+MultivariatePolynomial<C,O,P> modular_gcd(const MultivariatePolynomial<C,O,P>& a, const MultivariatePolynomial<C,O,P>& b) {
+	static_assert(is_subset_of_rationals<C>::value || is_subset_of_integers<C>::value, "Modular gcd is only implemented for integer or rational coefficients.");
+	using namespace gcd_detail::modular;
+	using Poly = MultivariatePolynomial<C,O,P>;
+	assert(!isZero(a));
+	assert(!isZero(b));
+
+	std::set<Variable> varset = a.gatherVariables();
+	b.gatherVariables(varset);
+	std::vector<Variable> vars(varset.begin(), varset.end());
+	C contentA;
+	C contentB;
+	IntPoly A = toIntPoly(a, vars, contentA);
+	IntPoly B = toIntPoly(b, vars, contentB);
+	// Over a field, the content is a unit.
+	C content = is_field<C>::value ? C(1) : carl::gcd(contentA, contentB);
+
+	auto finalize = [&](Poly&& res) {
+		res *= content;
+		if (carl::isNegative(res.lcoeff())) res = -res;
+		return res;
+	};
+	if (vars.empty()) return finalize(Poly(1));
+
+	using QPoly = MultivariatePolynomial<mpq_class>;
+	QPoly Aq = toPolynomial<QPoly>(A, vars);
+	QPoly Bq = toPolynomial<QPoly>(B, vars);
+	mpz_class gamma = carl::gcd(A.begin()->second, B.begin()->second);
+
+	std::mt19937 rng;
+	bool useZippel = vars.size() > 1;
+	IntPoly h;
+	mpz_class modulus;
+	Exponents lm;
+	WordPrimeFactory<32> primes;
+	while (true) {
+		Field F{primes.nextPrime()};
+		if (F.fromInteger(A.begin()->second) == 0 || F.fromInteger(B.begin()->second) == 0) continue;
+		FlatPoly Ap = reduce(F, A);
+		FlatPoly Bp = reduce(F, B);
+		RPoly image;
+		bool haveImage = false;
+		if (useZippel && !h.empty()) {
+			std::vector<Exponents> skeleton;
+			for (const auto& t: h) skeleton.push_back(t.first);
+			haveImage = zippel(F, Ap, Bp, skeleton, image, rng);
+			CARL_LOG_TRACE("carl.core.gcd", "Sparse interpolation modulo " << F.p() << (haveImage ? " succeeded" : " failed"));
+		}
+		if (!haveImage) {
+			image = brown(F, fromFlat(Ap), fromFlat(Bp)).gcd;
+		}
+		FlatPoly g = toFlat(image);
+		const Exponents& lmp = g.front().first;
+		if (std::all_of(lmp.begin(), lmp.end(), [](exponent e){ return e == 0; })) {
+			return finalize(Poly(1));
+		}
+		if (!h.empty()) {
+			if (lmp > lm) continue;
+			if (lmp < lm) h.clear();
+		}
+		if (h.empty()) {
+			lm = lmp;
+			modulus = 1;
+		}
+		if (combine(F, h, modulus, g, F.fromInteger(gamma))) continue;
+
+		mpz_class cont = 0;
+		for (const auto& t: h) cont = carl::gcd(cont, t.second);
+		IntPoly candidate;
+		for (const auto& t: h) candidate.emplace(t.first, mpz_class(t.second / cont));
+		QPoly G = toPolynomial<QPoly>(candidate, vars);
+		QPoly quotient;
+		if (Aq.divideBy(G, quotient) && Bq.divideBy(G, quotient)) {
+			return finalize(toPolynomial<Poly>(candidate, vars));
+		}
+		CARL_LOG_DEBUG("carl.core.gcd", "Trial division of " << G << " failed, continuing without sparse interpolation");
+		useZippel = false;
+		h.clear();
+	}
+}
+
+}
@@ -93,6 +93,7 @@ UnivariatePolynomial<Coeff> extended_gcd(const UnivariatePolynomial<Coeff>& a, c
 
 /**
  * Calculates the greatest common divisor of two polynomials.
+ * For coefficients from a GaloisField<uint>, the euclidean algorithm runs on machine words by dense_arithmetic::gcd().
  * @param a First polynomial.
  * @param b Second polynomial.
  * @return `gcd(a,b)`
@@ -103,6 +104,14 @@ UnivariatePolynomial<Coeff> gcd(const UnivariatePolynomial<Coeff>& a, const Univ
 	assert(!carl::isZero(a));
 	assert(!carl::isZero(b));
 	assert(a.mainVar() == b.mainVar());
+	if constexpr (std::is_same<Coeff, GFNumber<uint>>::value) {
+		const auto* gf = a.lcoeff().gf();
+		if (gf == nullptr) gf = b.lcoeff().gf();
+		if (gf != nullptr) {
+			auto res = dense_arithmetic::gcd(*gf, dense_arithmetic::toWords(*gf, a.coefficients()), dense_arithmetic::toWords(*gf, b.coefficients()));
+			return UnivariatePolynomial<Coeff>(a.mainVar(), dense_arithmetic::fromWords(gf, res));
+		}
+	}
 	if(a.degree() < b.degree()) {
 		return gcd_recursive(b.normalized(),a.normalized()).normalized();
 	} else {
@@ -8,8 +8,12 @@
 #include <vector>
 
 namespace carl {
+/**
+ * Strategies for the computation of subresultants.
+ * SubresultantStrategy::Modular only affects resultant(), discriminant() and principalSubresultantsCoefficients() for coefficients that are multivariate polynomials over the integers or the rationals, otherwise it behaves like SubresultantStrategy::Lazard.
+ */
 enum class SubresultantStrategy {
-	Generic, Lazard, Ducos, Default = Lazard
+	Generic, Lazard, Ducos, Modular, Default = Lazard
 };
 
 template<typename Coeff>
@@ -26,6 +30,7 @@ UnivariatePolynomial<Coeff> discriminant(const UnivariatePolynomial<Coeff>&, Sub
 }
 
 #include "../UnivariatePolynomial.h"
+#include "Resultant_modular.h"
 
 namespace carl {
 
@@ -147,7 +152,8 @@ std::list<UnivariatePolynomial<Coeff>> subresultants(
 					break;
 				}
 				case SubresultantStrategy::Ducos:
-				case SubresultantStrategy::Lazard: {
+				case SubresultantStrategy::Lazard:
+				case SubresultantStrategy::Modular: {
 					CARL_LOG_TRACE("carl.core.resultant", "Part 2: Ducos/Lazard strategy");
 					// "dichotomous Lazard": efficient exponentiation
 					uint deltaReduced = delta-1;
@@ -204,7 +210,8 @@ std::list<UnivariatePolynomial<Coeff>> subresultants(
 		switch (strategy) {
 			// Compared to [Duc98], here S_{d-1} is b and S_d is a, S_e is c, and s_d is subresLcoeff.
 			case SubresultantStrategy::Generic:
-			case SubresultantStrategy::Lazard: {
+			case SubresultantStrategy::Lazard:
+			case SubresultantStrategy::Modular: {
 				CARL_LOG_TRACE("carl.core.resultant", "Part 3: Generic/Lazard strategy");
 				if (carl::isZero(p)) return subresultants;
 				
@@ -268,6 +275,11 @@ std::vector<UnivariatePolynomial<Coeff>> principalSubresultantsCoefficients(
 		const UnivariatePolynomial<Coeff>& q,
 		SubresultantStrategy strategy
 ) {
+	if constexpr (resultant_detail::modular::is_applicable<Coeff>::value) {
+		if (strategy == SubresultantStrategy::Modular) {
+			return modular_principalSubresultantsCoefficients(p, q);
+		}
+	}
 	// Attention: Mathematica / Wolframalpha has one entry less (the last one) which is identical to p!
 	std::list<UnivariatePolynomial<Coeff>> subres = subresultants(p, q, strategy);
 	CARL_LOG_DEBUG("carl.upoly", "PSC of " << p << " and " << q << " on " << p.mainVar() << ": " << subres);
@@ -287,6 +299,11 @@ UnivariatePolynomial<Coeff> resultant(
 ) {
 	assert(p.mainVar() == q.mainVar());
 	if (carl::isZero(p) || carl::isZero(q)) return UnivariatePolynomial<Coeff>(p.mainVar());
+	if constexpr (resultant_detail::modular::is_applicable<Coeff>::value) {
+		if (strategy == SubresultantStrategy::Modular) {
+			return modular_resultant(p.normalized(), q.normalized());
+		}
+	}
 	UnivariatePolynomial<Coeff> resultant = subresultants(p.normalized(), q.normalized(), strategy).front();
 	CARL_LOG_TRACE("carl.core.resultant", "resultant(" << p << ", " << q << ") = " << resultant);
 	if (resultant.isConstant()) {
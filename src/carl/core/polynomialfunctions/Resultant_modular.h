@@ -0,0 +1,478 @@
+/**
+ * @file Resultant_modular.h
+ *
+ * Modular computation of resultants and principal subresultant coefficients of polynomials with multivariate integral or rational coefficients, following @cite Collins71.
+ * The subresultant chain is computed modulo word-sized primes and, for multivariate coefficients, at evaluation points for all but the main variable.
+ * The images are combined by dense interpolation and chinese remaindering, where the number of primes is given by a bound on the coefficients.
+ *
+ * Primes and evaluation points that lower the degree of the input polynomials are skipped.
+ * Unlucky primes and points, whose subresultant chain has a different shape than the generic one, are detected by comparing the shapes of the images.
+ * Once enough images are combined, one more prime or point checks the result, and the reconstruction starts again if the check reveals that all images were unlucky.
+ */
+
+#pragma once
+
+#include "GCD_modular.h"
+#include "../MultivariatePolynomial.h"
+#include "../UnivariatePolynomial.h"
+#include "../logging.h"
+#include "../../numbers/numbers.h"
+#include "../../numbers/ChineseRemainder.h"
+#include "../../numbers/PrimeFactory.h"
+
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+namespace resultant_detail {
+namespace modular {
+	using gcd_detail::modular::Residue;
+	using gcd_detail::modular::Exponents;
+	using gcd_detail::modular::UPoly;
+	using gcd_detail::modular::FlatPoly;
+	using gcd_detail::modular::IntPoly;
+	using gcd_detail::modular::Field;
+
+	/**
+	 * States whether the modular algorithm is available for the given coefficient type.
+	 * This is the case for multivariate polynomials over the integers or the rationals.
+	 */
+	template<typename Coeff>
+	struct is_applicable: std::false_type {};
+	template<typename C, typename O, typename P>
+	struct is_applicable<MultivariatePolynomial<C,O,P>>: std::integral_constant<bool, is_subset_of_rationals<C>::value || is_subset_of_integers<C>::value> {};
+
+	/**
+	 * Describes the nonzero entries of a subresultant chain by pairs of index and degree.
+	 * The chain of a generic image dominates all other images pointwise, hence it is the maximum with respect to the order given by compare().
+	 */
+	using Signature = std::vector<std::pair<std::size_t, std::size_t>>;
+
+	/// Returns a negative value if a is less likely to be the generic signature than b, a positive value if it is more likely and zero if they are equal.
+	inline int compare(const Signature& a, const Signature& b) {
+		std::size_t scoreA = 0;
+		std::size_t scoreB = 0;
+		for (const auto& e: a) scoreA += e.second + 1;
+		for (const auto& e: b) scoreB += e.second + 1;
+		if (scoreA != scoreB) return scoreA < scoreB ? -1 : 1;
+		if (a == b) return 0;
+		return a < b ? -1 : 1;
+	}
+
+	/**
+	 * Image of the leading coefficients of a subresultant chain.
+	 * Every leading coefficient is a dense polynomial in the evaluated variables y_1, ..., y_l, where y_1 is the least significant index.
+	 */
+	struct ChainImage {
+		Signature signature;
+		std::vector<std::vector<Residue>> lcoeffs;
+	};
+
+	inline Residue lcoeff(const UPoly& u) {
+		return u.back();
+	}
+	inline UPoly negate(const Field& F, const UPoly& u) {
+		UPoly res(u);
+		for (auto& r: res) r = F.neg(r);
+		return res;
+	}
+	/// Pseudo remainder of a and b as implemented by UnivariatePolynomial::prem().
+	inline UPoly prem(const Field& F, const UPoly& a, const UPoly& b) {
+		assert(!b.empty());
+		if (b.size() == 1) return UPoly();
+		if (b.size() > a.size()) return a;
+		UPoly r(a);
+		gcd_detail::modular::divide(F, r, b);
+		return gcd_detail::modular::scale(F, r, F.pow(lcoeff(b), a.size() - b.size() + 1));
+	}
+
+	/**
+	 * Computes the subresultant chain of p and q like subresultants() with SubresultantStrategy::Lazard.
+	 * The entries are given in the order in which they are computed, hence reversed with respect to subresultants().
+	 * @param p Polynomial with deg(p) >= deg(q).
+	 * @param q Nonzero polynomial.
+	 * @param signature Index and degree of the entries.
+	 * @param lcoeffs Leading coefficients of the entries.
+	 */
+	inline void chain(const Field& F, UPoly p, UPoly q, Signature& signature, std::vector<Residue>& lcoeffs) {
+		assert(p.size() >= q.size() && !q.empty());
+		auto add = [&](std::size_t index, const UPoly& u) {
+			signature.emplace_back(index, u.size() - 1);
+			lcoeffs.emplace_back(lcoeff(u));
+		};
+		add(p.size() - 1, p);
+		add(q.size() - 1, q);
+		if (q.size() == 1) return;
+		Residue subresLcoeff = F.pow(lcoeff(q), p.size() - q.size());
+		UPoly tmp = q;
+		q = prem(F, p, negate(F, q));
+		p = std::move(tmp);
+		while (true) {
+			if (q.empty()) return;
+			std::size_t pDeg = p.size() - 1;
+			std::size_t qDeg = q.size() - 1;
+			add(pDeg - 1, q);
+			std::size_t delta = pDeg - qDeg;
+			UPoly c = q;
+			if (delta > 1) {
+				Residue factor = F.mul(F.pow(lcoeff(q), delta - 1), F.inverse(F.pow(subresLcoeff, delta - 1)));
+				c = gcd_detail::modular::scale(F, q, factor);
+				add(qDeg, c);
+			}
+			if (qDeg == 0) return;
+			UPoly reduced = prem(F, p, negate(F, q));
+			q = gcd_detail::modular::scale(F, reduced, F.inverse(F.mul(F.pow(subresLcoeff, delta), lcoeff(p))));
+			p = std::move(c);
+			subresLcoeff = lcoeff(p);
+		}
+	}
+
+	/**
+	 * Computes the coefficients of the polynomial of degree at most points.size() - 1 that interpolates the given values.
+	 * Uses Newton interpolation for all value vectors at once.
+	 * @param points Pairwise distinct evaluation points.
+	 * @param values Value vectors, one for every point.
+	 * @return Coefficient vectors, ordered by increasing degree.
+	 */
+	inline std::vector<std::vector<Residue>> interpolate(const Field& F, const std::vector<Residue>& points, std::vector<std::vector<Residue>> values) {
+		std::size_t n = points.size();
+		for (std::size_t k = 1; k < n; ++k) {
+			for (std::size_t t = n - 1; t >= k; --t) {
+				Residue inv = F.inverse(F.sub(points[t], points[t - k]));
+				for (std::size_t i = 0; i < values[t].size(); ++i) {
+					values[t][i] = F.mul(F.sub(values[t][i], values[t-1][i]), inv);
+				}
+			}
+		}
+		// Expand the Newton form by Horner's scheme.
+		std::vector<std::vector<Residue>> res(n, std::vector<Residue>(values.front().size(), 0));
+		res[0] = values[n - 1];
+		for (std::size_t t = n - 1; t-- > 0;) {
+			// res = res * (y - points[t]) + values[t]
+			for (std::size_t d = n - 1; d > 0; --d) {
+				for (std::size_t i = 0; i < res[d].size(); ++i) {
+					res[d][i] = F.sub(res[d-1][i], F.mul(res[d][i], points[t]));
+				}
+			}
+			for (std::size_t i = 0; i < res[0].size(); ++i) {
+				res[0][i] = F.add(F.neg(F.mul(res[0][i], points[t])), values[t][i]);
+			}
+		}
+		return res;
+	}
+
+	/**
+	 * Evaluates a dense polynomial at value for its most significant variable.
+	 * @param f Dense polynomial whose degree in the most significant variable is less than n.
+	 */
+	inline std::vector<Residue> evaluateLast(const Field& F, const std::vector<Residue>& f, std::size_t n, Residue value) {
+		std::size_t size = f.size() / n;
+		std::vector<Residue> res(size, 0);
+		for (std::size_t d = n; d-- > 0;) {
+			for (std::size_t i = 0; i < size; ++i) {
+				res[i] = F.add(F.mul(res[i], value), f[d * size + i]);
+			}
+		}
+		return res;
+	}
+
+	/// Substitutes value for the variable with the given index.
+	inline FlatPoly substitute(const Field& F, const FlatPoly& f, std::size_t variable, Residue value) {
+		std::map<Exponents, Residue> res;
+		for (const auto& t: f) {
+			Exponents e(t.first);
+			Residue c = F.mul(t.second, F.pow(value, e[variable]));
+			e[variable] = 0;
+			Residue& r = res[e];
+			r = F.add(r, c);
+		}
+		FlatPoly flat;
+		for (const auto& t: res) {
+			if (t.second != 0) flat.emplace_back(t.first, t.second);
+		}
+		return flat;
+	}
+
+	/**
+	 * Computes the image of the chain for polynomials whose coefficients are polynomials in the first `level` variables.
+	 * The last variable is evaluated at random points until degree[level-1] + 1 images with the maximal signature are found, which are then interpolated.
+	 * The interpolation is accepted if it matches the image at one more point with the same signature.
+	 * @param p Coefficients of the first polynomial, its leading coefficient is nonzero.
+	 * @param q Coefficients of the second polynomial, its leading coefficient is nonzero.
+	 * @param degree Degree bounds for the variables.
+	 * @param level Number of remaining variables.
+	 * @param onlyFirst Flag if only the leading coefficient of the last entry is needed.
+	 */
+	inline ChainImage image(const Field& F, const std::vector<FlatPoly>& p, const std::vector<FlatPoly>& q, const std::vector<std::size_t>& degree, std::size_t level, bool onlyFirst, std::mt19937& rng) {
+		ChainImage res;
+		if (level == 0) {
+			auto toUPoly = [](const std::vector<FlatPoly>& f) {
+				UPoly u;
+				for (const auto& c: f) u.emplace_back(c.empty() ? 0 : c.front().second);
+				gcd_detail::modular::trim(u);
+				return u;
+			};
+			std::vector<Residue> lcoeffs;
+			chain(F, toUPoly(p), toUPoly(q), res.signature, lcoeffs);
+			if (onlyFirst) lcoeffs.erase(lcoeffs.begin(), lcoeffs.end() - 1);
+			for (const auto& lc: lcoeffs) res.lcoeffs.emplace_back(1, lc);
+			return res;
+		}
+		std::size_t variable = level - 1;
+		std::size_t n = degree[variable] + 1;
+		std::uniform_int_distribution<Residue> dist(0, F.p() - 1);
+		std::set<Residue> used;
+		std::vector<Residue> points;
+		std::vector<ChainImage> images;
+		while (true) {
+			Residue value = dist(rng);
+			if (!used.insert(value).second) continue;
+			std::vector<FlatPoly> pv;
+			std::vector<FlatPoly> qv;
+			for (const auto& c: p) pv.emplace_back(substitute(F, c, variable, value));
+			for (const auto& c: q) qv.emplace_back(substitute(F, c, variable, value));
+			// The degree in the main variable must be preserved.
+			if (pv.back().empty() || qv.back().empty()) continue;
+			ChainImage img = image(F, pv, qv, degree, level - 1, onlyFirst, rng);
+			if (!images.empty()) {
+				int cmp = compare(img.signature, images.front().signature);
+				// The point is unlucky.
+				if (cmp < 0) continue;
+				if (cmp == 0 && points.size() == n) {
+					bool matches = true;
+					for (std::size_t entry = 0; matches && entry < res.lcoeffs.size(); ++entry) {
+						matches = evaluateLast(F, res.lcoeffs[entry], n, value) == img.lcoeffs[entry];
+					}
+					if (matches) return res;
+					CARL_LOG_DEBUG("carl.core.resultant", "Interpolation modulo " << F.p() << " does not match the image at " << value << ", restarting");
+					cmp = 1;
+				}
+				if (cmp > 0) {
+					// All previous points were unlucky.
+					images.clear();
+					points.clear();
+				}
+			}
+			points.emplace_back(value);
+			images.emplace_back(std::move(img));
+			if (points.size() < n) continue;
+			res.signature = images.front().signature;
+			res.lcoeffs.clear();
+			for (std::size_t entry = 0; entry < images.front().lcoeffs.size(); ++entry) {
+				std::vector<std::vector<Residue>> values;
+				for (const auto& i: images) values.emplace_back(i.lcoeffs[entry]);
+				std::vector<Residue> dense;
+				for (auto& coeff: interpolate(F, points, std::move(values))) {
+					dense.insert(dense.end(), coeff.begin(), coeff.end());
+				}
+				res.lcoeffs.emplace_back(std::move(dense));
+			}
+		}
+	}
+
+	/**
+	 * Combines h modulo m with the image modulo F.p() using the chinese remainder theorem.
+	 * Coefficients are kept in the symmetric representation.
+	 */
+	inline void combine(const Field& F, std::vector<mpz_class>& h, const mpz_class& m, const std::vector<Residue>& image) {
+		ChineseRemainder crt(F, m, true);
+		for (std::size_t i = 0; i < h.size(); ++i) {
+			crt.lift(h[i], image[i]);
+		}
+	}
+
+	/// Provides the terms of a polynomial as exponent vectors with respect to the given variables.
+	template<typename Poly, typename Callback>
+	void forEachTerm(const Poly& p, const std::vector<Variable>& vars, Callback&& callback) {
+		for (const auto& t: p) {
+			Exponents e(vars.size(), 0);
+			if (t.monomial()) {
+				for (const auto& ve: *t.monomial()) {
+					e[std::size_t(std::lower_bound(vars.begin(), vars.end(), ve.first) - vars.begin())] = ve.second;
+				}
+			}
+			callback(e, t.coeff());
+		}
+	}
+
+	/// Converts a dense image to a polynomial and divides it by the given factor.
+	template<typename Poly>
+	Poly toPolynomial(const std::vector<mpz_class>& dense, const std::vector<Variable>& vars, const std::vector<std::size_t>& degree, const typename Poly::CoeffType& factor) {
+		IntPoly p;
+		for (std::size_t i = 0; i < dense.size(); ++i) {
+			if (carl::isZero(dense[i])) continue;
+			Exponents e(vars.size(), 0);
+			std::size_t index = i;
+			for (std::size_t v = 0; v < vars.size(); ++v) {
+				e[v] = exponent(index % (degree[v] + 1));
+				index /= degree[v] + 1;
+			}
+			p.emplace(std::move(e), dense[i]);
+		}
+		Poly res = gcd_detail::modular::toPolynomial<Poly>(p, vars);
+		if constexpr (is_field<typename Poly::CoeffType>::value) {
+			if (!carl::isOne(factor)) res /= factor;
+		}
+		return res;
+	}
+
+	/**
+	 * Computes the leading coefficients of the subresultant chain of p and q, in the order of subresultants().
+	 * @param onlyFirst Flag if only the first entry is needed.
+	 * @param firstIsConstant Set to whether the first entry has degree zero.
+	 */
+	template<typename Coeff>
+	std::vector<Coeff> leadingCoefficients(const UnivariatePolynomial<Coeff>& pol1, const UnivariatePolynomial<Coeff>& pol2, bool onlyFirst, bool& firstIsConstant) {
+		using Number = typename Coeff::CoeffType;
+		assert(!carl::isZero(pol1) && !carl::isZero(pol2));
+		const UnivariatePolynomial<Coeff>& p = pol1.degree() < pol2.degree() ? pol2 : pol1;
+		const UnivariatePolynomial<Coeff>& q = pol1.degree() < pol2.degree() ? pol1 : pol2;
+
+		std::set<Variable> varset;
+		for (const auto& c: p.coefficients()) c.gatherVariables(varset);
+		for (const auto& c: q.coefficients()) c.gatherVariables(varset);
+		std::vector<Variable> vars(varset.begin(), varset.end());
+
+		// Clear the denominators, such that p = P / pFactor and q = Q / qFactor for integral P and Q.
+		auto toInteger = [&vars](const UnivariatePolynomial<Coeff>& f, Number& factor, mpz_class& norm, std::vector<std::size_t>& degree) {
+			mpz_class den = 1;
+			for (const auto& c: f.coefficients()) {
+				forEachTerm(c, vars, [&den](const Exponents&, const Number& n) {
+					if constexpr (is_field<Number>::value) den = carl::lcm(den, mpz_class(carl::getDenom(n)));
+				});
+			}
+			factor = Number(den);
+			norm = 0;
+			degree.assign(vars.size(), 0);
+			std::vector<IntPoly> res;
+			for (const auto& c: f.coefficients()) {
+				res.emplace_back();
+				forEachTerm(c, vars, [&](const Exponents& e, const Number& n) {
+					mpz_class i = carl::getNum(n);
+					if constexpr (is_field<Number>::value) i *= den / mpz_class(carl::getDenom(n));
+					norm += carl::abs(i);
+					for (std::size_t v = 0; v < e.size(); ++v) degree[v] = std::max(degree[v], std::size_t(e[v]));
+					res.back().emplace(e, std::move(i));
+				});
+			}
+			return res;
+		};
+		Number pFactor;
+		Number qFactor;
+		mpz_class pNorm;
+		mpz_class qNorm;
+		std::vector<std::size_t> pDegree;
+		std::vector<std::size_t> qDegree;
+		std::vector<IntPoly> P = toInteger(p, pFactor, pNorm, pDegree);
+		std::vector<IntPoly> Q = toInteger(q, qFactor, qNorm, qDegree);
+
+		// Every entry is a determinant with at most deg(q) rows of P and deg(p) rows of Q, or P or Q itself.
+		std::size_t pRows = std::max<std::size_t>(q.degree(), 1);
+		std::size_t qRows = std::max<std::size_t>(p.degree(), 1);
+		std::vector<std::size_t> degree;
+		for (std::size_t v = 0; v < vars.size(); ++v) {
+			degree.emplace_back(pRows * pDegree[v] + qRows * qDegree[v]);
+		}
+		mpz_class pBound;
+		mpz_class qBound;
+		mpz_pow_ui(pBound.get_mpz_t(), pNorm.get_mpz_t(), pRows);
+		mpz_pow_ui(qBound.get_mpz_t(), qNorm.get_mpz_t(), qRows);
+		mpz_class bound = 2 * pBound * qBound;
+
+		std::mt19937 rng;
+		Signature signature;
+		std::vector<std::vector<mpz_class>> result;
+		mpz_class modulus;
+		WordPrimeFactory<32> primes;
+		while (true) {
+			Field F{primes.nextPrime()};
+			auto reduce = [&F](const std::vector<IntPoly>& f) {
+				std::vector<FlatPoly> res;
+				for (const auto& c: f) res.emplace_back(gcd_detail::modular::reduce(F, c));
+				return res;
+			};
+			std::vector<FlatPoly> Pp = reduce(P);
+			std::vector<FlatPoly> Qp = reduce(Q);
+			if (Pp.back().empty() || Qp.back().empty()) continue;
+			ChainImage img = image(F, Pp, Qp, degree, vars.size(), onlyFirst, rng);
+			if (!result.empty()) {
+				int cmp = compare(img.signature, signature);
+				// The prime is unlucky.
+				if (cmp < 0) continue;
+				if (cmp == 0 && modulus > bound) {
+					bool matches = true;
+					for (std::size_t i = 0; matches && i < result.size(); ++i) {
+						for (std::size_t j = 0; matches && j < result[i].size(); ++j) {
+							matches = F.fromInteger(result[i][j]) == img.lcoeffs[i][j];
+						}
+					}
+					if (matches) break;
+					CARL_LOG_DEBUG("carl.core.resultant", "Reconstruction does not match the image modulo " << F.p() << ", restarting");
+					cmp = 1;
+				}
+				// All previous primes were unlucky.
+				if (cmp > 0) result.clear();
+			}
+			if (result.empty()) {
+				CARL_LOG_TRACE("carl.core.resultant", "Starting reconstruction modulo " << F.p());
+				signature = img.signature;
+				modulus = 1;
+				for (const auto& lc: img.lcoeffs) result.emplace_back(lc.size(), 0);
+			}
+			for (std::size_t i = 0; i < result.size(); ++i) {
+				combine(F, result[i], modulus, img.lcoeffs[i]);
+			}
+			modulus *= static_cast<unsigned long>(F.p());
+		}
+
+		firstIsConstant = signature.back().second == 0;
+		std::vector<Coeff> res;
+		std::size_t offset = signature.size() - result.size();
+		for (std::size_t i = result.size(); i-- > 0;) {
+			std::size_t index = signature[offset + i].first;
+			// The entry is a determinant with deg(q) - index rows of P and deg(p) - index rows of Q.
+			std::size_t pExp = q.degree() - std::min(index, q.degree());
+			std::size_t qExp = p.degree() - std::min(index, p.degree());
+			if (offset + i == 0) {
+				pExp = 1;
+				qExp = 0;
+			} else if (offset + i == 1) {
+				pExp = 0;
+				qExp = 1;
+			}
+			res.emplace_back(toPolynomial<Coeff>(result[i], vars, degree, carl::pow(pFactor, pExp) * carl::pow(qFactor, qExp)));
+		}
+		return res;
+	}
+}
+}
+
+/**
+ * Computes the principal subresultant coefficients like principalSubresultantsCoefficients(), using modular arithmetic.
+ */
+template<typename Coeff>
+std::vector<UnivariatePolynomial<Coeff>> modular_principalSubresultantsCoefficients(const UnivariatePolynomial<Coeff>& p, const UnivariatePolynomial<Coeff>& q) {
+	bool firstIsConstant;
+	std::vector<UnivariatePolynomial<Coeff>> res;
+	for (auto& lc: resultant_detail::modular::leadingCoefficients(p, q, false, firstIsConstant)) {
+		res.emplace_back(p.mainVar(), std::move(lc));
+	}
+	return res;
+}
+
+/**
+ * Computes the resultant like resultant(), using modular arithmetic.
+ * Assumes that p and q are already normalized.
+ */
+template<typename Coeff>
+UnivariatePolynomial<Coeff> modular_resultant(const UnivariatePolynomial<Coeff>& p, const UnivariatePolynomial<Coeff>& q) {
+	bool firstIsConstant;
+	std::vector<Coeff> res = resultant_detail::modular::leadingCoefficients(p, q, true, firstIsConstant);
+	if (!firstIsConstant) return UnivariatePolynomial<Coeff>(p.mainVar());
+	return UnivariatePolynomial<Coeff>(p.mainVar(), res.front());
+}
+
+}
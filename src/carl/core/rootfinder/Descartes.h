@@ -0,0 +1,181 @@
+/**
+ * @file Descartes.h
+ * @ingroup rootfinder
+ */
+
+#pragma once
+
+#include "../../interval/Interval.h"
+#include "../../numbers/numbers.h"
+#include "../logging.h"
+#include "../Sign.h"
+#include "../UnivariatePolynomial.h"
+
+#include <boost/optional.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace carl {
+namespace rootfinder {
+namespace descartes {
+
+/**
+ * Applies the Taylor shift \f$ p(x) \rightarrow p(x+1) \f$ to the given coefficients.
+ * Only additions are necessary, hence this is significantly cheaper than UnivariatePolynomial::shift().
+ * @param c Coefficients, starting with the constant one.
+ * @complexity O(n^2) additions
+ */
+template<typename T>
+void taylorShiftOne(std::vector<T>& c) {
+	if (c.size() < 2) return;
+	std::size_t n = c.size() - 1;
+	for (std::size_t i = 0; i < n; ++i) {
+		for (std::size_t j = n; j > i; --j) {
+			c[j-1] += c[j];
+		}
+	}
+}
+
+/**
+ * Applies \f$ p(x) \rightarrow 2^n p(x/2) \f$ to the given coefficients.
+ * This maps the roots from \f$(0,2)\f$ to \f$(0,1)\f$ and keeps integral coefficients integral.
+ * @param c Coefficients, starting with the constant one.
+ */
+template<typename Integer>
+void halve(std::vector<Integer>& c) {
+	Integer factor = carl::constant_one<Integer>::get();
+	for (auto it = c.rbegin(); it != c.rend(); ++it) {
+		*it *= factor;
+		factor *= 2;
+	}
+}
+
+/**
+ * Counts the sign variations of \f$ (x+1)^n p(1/(x+1)) \f$.
+ * By Descartes' rule of signs, this is an upper bound for the number of real roots of p within \f$(0,1)\f$.
+ * If it is zero or one, it is exact.
+ * @param c Coefficients of p, starting with the constant one.
+ * @return Number of sign variations.
+ */
+template<typename Integer>
+std::size_t unitVariations(const std::vector<Integer>& c) {
+	std::vector<Integer> t(c.rbegin(), c.rend());
+	taylorShiftOne(t);
+	return carl::sign_variations(t.begin(), t.end(), [](const Integer& i){ return carl::sgn(i); });
+}
+
+/**
+ * Counts the sign variations like unitVariations(), but only uses double approximations of the coefficients.
+ * This corresponds to a single step of the bitstream Descartes method @cite Eigenwillig2005 with a fixed precision.
+ *
+ * The Taylor shift is applied to the approximations and to their absolute values.
+ * As only additions are involved, the error of every resulting coefficient is bounded by a multiple of the respective sum of absolute values.
+ * A sign is only used if the approximation exceeds this bound, hence no rounding mode switches are necessary.
+ * @param c Coefficients of p, starting with the constant one.
+ * @return Number of sign variations, if all signs could be determined from the approximations.
+ */
+template<typename Integer>
+boost::optional<std::size_t> approximateUnitVariations(const std::vector<Integer>& c) {
+	std::vector<double> t;
+	std::vector<double> magnitude;
+	t.reserve(c.size());
+	magnitude.reserve(c.size());
+	for (auto it = c.rbegin(); it != c.rend(); ++it) {
+		t.emplace_back(carl::toDouble(*it));
+		magnitude.emplace_back(std::abs(t.back()));
+	}
+	taylorShiftOne(t);
+	taylorShiftOne(magnitude);
+	// Covers the conversion, at most c.size() roundings per coefficient and the rounding errors of the bound itself.
+	double factor = 4 * double(c.size() + 1) * std::numeric_limits<double>::epsilon();
+	std::size_t variations = 0;
+	Sign last = Sign::ZERO;
+	for (std::size_t i = 0; i < t.size(); ++i) {
+		if (!std::isfinite(magnitude[i])) return boost::none;
+		if (magnitude[i] == 0) continue;
+		double error = factor * magnitude[i];
+		Sign s;
+		if (t[i] > error) s = Sign::POSITIVE;
+		else if (t[i] < -error) s = Sign::NEGATIVE;
+		else return boost::none;
+		if (last != Sign::ZERO && s != last) ++variations;
+		last = s;
+	}
+	return variations;
+}
+
+/**
+ * Isolates the real roots of a square-free polynomial within a bounded open interval using the Vincent-Collins-Akritas method @cite CollinsAkritas76.
+ *
+ * The polynomial is transformed such that the interval is mapped to \f$(0,1)\f$ and converted to integral coefficients.
+ * Subintervals are then obtained by halving and Taylor shifts by one, and Descartes' rule of signs decides whether a subinterval contains no root, exactly one root or must be split further.
+ * No Sturm sequences are computed.
+ * @param polynomial Square-free polynomial.
+ * @param interval Bounded open interval.
+ * @param approximate Flag if the sign variations shall first be computed from double approximations.
+ * @param addRoot Callback for roots that were found exactly.
+ * @param addInterval Callback for open intervals that contain exactly one root.
+ */
+template<typename Number, typename RootCallback, typename IntervalCallback>
+void isolateRoots(const UnivariatePolynomial<Number>& polynomial, const Interval<Number>& interval, bool approximate, RootCallback&& addRoot, IntervalCallback&& addInterval) {
+	using Integer = typename IntegralType<Number>::type;
+	struct Node {
+		std::vector<Integer> coefficients;
+		Number lower;
+		Number upper;
+	};
+	assert(interval.lowerBoundType() != BoundType::INFTY && interval.upperBoundType() != BoundType::INFTY);
+	if (polynomial.isConstant() || interval.lower() >= interval.upper()) return;
+
+	UnivariatePolynomial<Number> p(polynomial);
+	p.shift(interval.lower());
+	p.scale(interval.diameter());
+	Integer denominator = carl::constant_one<Integer>::get();
+	for (const auto& c: p.coefficients()) {
+		denominator = carl::lcm(denominator, carl::getDenom(c));
+	}
+	std::vector<Node> stack;
+	stack.push_back(Node{ {}, interval.lower(), interval.upper() });
+	for (const auto& c: p.coefficients()) {
+		stack.back().coefficients.emplace_back(carl::getNum(Number(c * denominator)));
+	}
+	// A root at the lower bound is not within the interval.
+	if (carl::isZero(stack.back().coefficients.front())) {
+		stack.back().coefficients.erase(stack.back().coefficients.begin());
+	}
+
+	while (!stack.empty()) {
+		Node node = std::move(stack.back());
+		stack.pop_back();
+		std::size_t variations;
+		boost::optional<std::size_t> approximation;
+		if (approximate) approximation = approximateUnitVariations(node.coefficients);
+		if (approximation) {
+			variations = *approximation;
+		} else {
+			variations = unitVariations(node.coefficients);
+		}
+		CARL_LOG_TRACE("carl.core.rootfinder", "Sign variations within (" << node.lower << ", " << node.upper << "): " << variations);
+		if (variations == 0) continue;
+		if (variations == 1) {
+			addInterval(Interval<Number>(node.lower, BoundType::STRICT, node.upper, BoundType::STRICT));
+			continue;
+		}
+		Number middle = (node.lower + node.upper) / 2;
+		halve(node.coefficients);
+		std::vector<Integer> right(node.coefficients);
+		taylorShiftOne(right);
+		if (carl::isZero(right.front())) {
+			addRoot(middle);
+			right.erase(right.begin());
+		}
+		stack.push_back(Node{ std::move(right), middle, node.upper });
+		stack.push_back(Node{ std::move(node.coefficients), node.lower, middle });
+	}
+}
+
+}
+}
+}
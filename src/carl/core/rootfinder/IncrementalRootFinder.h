@@ -52,6 +52,10 @@ enum class SplittingStrategy {
 	EIGENVALUES,
 	/// Uses AberthStrategy for first step, BinarySampleStrategy afterwards
 	ABERTH,
+	/// Uses DescartesStrategy, i.e. isolates all roots at once without Sturm sequences
+	DESCARTES,
+	/// Uses DescartesStrategy with sign variations computed from double approximations if possible
+	BITSTREAM,
 	/// Defaults to EIGENVALUES
 	DEFAULT = EIGENVALUES
 };
@@ -70,6 +74,8 @@ inline std::ostream& operator<<(std::ostream& os, const SplittingStrategy& s) {
 		case SplittingStrategy::GRID: return os << "Grid";
 		case SplittingStrategy::EIGENVALUES: return os << "Eigenvalues";
 		case SplittingStrategy::ABERTH: return os << "Aberth";
+		case SplittingStrategy::DESCARTES: return os << "Descartes";
+		case SplittingStrategy::BITSTREAM: return os << "Bitstream";
 	}
 }
 
@@ -196,6 +202,21 @@ struct AberthStrategy : AbstractStrategy<AberthStrategy<Number>, Number> {
 	virtual void operator()(const Interval<Number>& interval, RootFinder<Number>& finder);
 };
 
+/**
+ * Implements a complete root isolation based on Descartes' rule of signs.
+ */
+template<typename Number, bool Approximate = false>
+struct DescartesStrategy : AbstractStrategy<DescartesStrategy<Number, Approximate>, Number> {
+	/**
+	 * Isolates all real roots within the interval \f$(a,b)\f$ using descartes::isolateRoots().
+	 * Instead of adding new intervals to the queue, all roots are added to the finder directly.
+	 * If Approximate is set, the sign variations are first computed from double approximations of the coefficients.
+	 * @param interval Interval.
+	 * @param finder Finder object.
+	 */
+	virtual void operator()(const Interval<Number>& interval, RootFinder<Number>& finder);
+};
+
 }
 
 /**
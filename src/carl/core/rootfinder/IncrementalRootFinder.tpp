@@ -9,6 +9,7 @@
 #include "../../util/debug.h"
 #include "../logging.h"
 #include "AbstractRootFinder.h"
+#include "Descartes.h"
 #include "RootFinder.h"
 
 #include "../polynomialfunctions/Derivative.h"
@@ -58,6 +59,14 @@ bool IncrementalRootFinder<Number, C>::processQueueItem() {
 		splitting_strategies::EigenValueStrategy<Number>::getInstance()(interval, *this);
 		CARL_LOG_TRACE("carl.core.rootfinder", "Called Eigenvalue strategy");
 		return true;
+	} else if (strategy == SplittingStrategy::DESCARTES) {
+		splitting_strategies::DescartesStrategy<Number>::getInstance()(interval, *this);
+		CARL_LOG_TRACE("carl.core.rootfinder", "Called Descartes strategy");
+		return true;
+	} else if (strategy == SplittingStrategy::BITSTREAM) {
+		splitting_strategies::DescartesStrategy<Number, true>::getInstance()(interval, *this);
+		CARL_LOG_TRACE("carl.core.rootfinder", "Called Bitstream strategy");
+		return true;
 	} else if (strategy == SplittingStrategy::ABERTH) {
 		//AberthStrategy<Number>::instance()(interval, *this);
 		//return true;
@@ -92,6 +101,8 @@ bool IncrementalRootFinder<Number, C>::processQueueItem() {
 			break;
 		case SplittingStrategy::EIGENVALUES:	// Should not happen, safe fallback anyway
 		case SplittingStrategy::ABERTH:		// Should not happen, safe fallback anyway
+		case SplittingStrategy::DESCARTES:	// Should not happen, safe fallback anyway
+		case SplittingStrategy::BITSTREAM:	// Should not happen, safe fallback anyway
 		case SplittingStrategy::BINARYSAMPLE: splitting_strategies::BinarySampleStrategy<Number>::getInstance()(interval, *this);
 			break;
 		case SplittingStrategy::BINARYNEWTON: splitting_strategies::BinaryNewtonStrategy<Number>::getInstance()(interval, *this);
@@ -236,6 +247,14 @@ void EigenValueStrategy<Number>::operator()(const Interval<Number>& interval, Ro
 	buildIsolation(eigen::root_approximation(coeffs), interval, finder);
 }
 
+template<typename Number, bool Approximate>
+void DescartesStrategy<Number, Approximate>::operator()(const Interval<Number>& interval, RootFinder<Number>& finder) {
+	descartes::isolateRoots(finder.getPolynomial(), interval, Approximate,
+		[&finder](const Number& root) { finder.addRoot(RealAlgebraicNumber<Number>(root), false); },
+		[&finder](const Interval<Number>& i) { finder.addRoot(i); }
+	);
+}
+
 }
 
 }
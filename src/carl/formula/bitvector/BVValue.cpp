@@ -1,7 +1,123 @@
 #include "BVValue.h"
 
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/function_output_iterator.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+
+#include <algorithm>
+#include <vector>
+
 namespace carl {
 
+namespace {
+/**
+ * The value of a bit vector as little endian array of GMP limbs, on which the arithmetic operations are implemented.
+ * Values of up to 128 bits, and also their full products, are stored inline such that arithmetic on small bit vectors does not allocate.
+ * Larger values are stored on the heap and handled by the mpn functions of GMP.
+ * The bits above the width are zero, except for intermediate results of arithmetic operations.
+ */
+class Limbs {
+public:
+	using Block = BVValue::Base::block_type;
+	static constexpr std::size_t BITS = GMP_NUMB_BITS;
+	static_assert(GMP_NAIL_BITS == 0, "Limbs with nail bits are not supported.");
+	static_assert(BITS % BVValue::Base::bits_per_block == 0, "Blocks must not be larger than limbs.");
+private:
+	static constexpr std::size_t BLOCK_BITS = BVValue::Base::bits_per_block;
+	static constexpr std::size_t BLOCKS_PER_LIMB = BITS / BLOCK_BITS;
+	static constexpr std::size_t INLINE = 2 * 128 / BITS;
+
+	std::size_t mWidth;
+	std::size_t mSize;
+	std::array<mp_limb_t, INLINE> mInline;
+	std::vector<mp_limb_t> mHeap;
+	mp_limb_t* mData;
+
+public:
+	/// Creates a zero value of the given width.
+	explicit Limbs(std::size_t width)
+		: mWidth(width), mSize(std::max(std::size_t(1), (width + BITS - 1) / BITS)) {
+		if (mSize <= INLINE) {
+			mInline.fill(0);
+			mData = mInline.data();
+		} else {
+			mHeap.assign(mSize, 0);
+			mData = mHeap.data();
+		}
+	}
+
+	explicit Limbs(const BVValue& value)
+		: Limbs(value.width()) {
+		std::size_t i = 0;
+		boost::to_block_range(value.base(), boost::make_function_output_iterator([this, &i](Block b) {
+			mData[i / BLOCKS_PER_LIMB] |= mp_limb_t(b) << (BLOCK_BITS * (i % BLOCKS_PER_LIMB));
+			++i;
+		}));
+	}
+
+	Limbs(const Limbs&) = delete;
+	Limbs& operator=(const Limbs&) = delete;
+
+	std::size_t size() const {
+		return mSize;
+	}
+	mp_limb_t* data() {
+		return mData;
+	}
+	const mp_limb_t* data() const {
+		return mData;
+	}
+	mp_limb_t& operator[](std::size_t i) {
+		return mData[i];
+	}
+	mp_limb_t operator[](std::size_t i) const {
+		return mData[i];
+	}
+
+	/// Number of limbs without the leading zero limbs, but at least one.
+	std::size_t significant() const {
+		std::size_t n = mSize;
+		while (n > 1 && mData[n - 1] == 0) --n;
+		return n;
+	}
+
+	/// Reduces the width, dropping the higher bits.
+	void truncate(std::size_t width) {
+		assert(width <= mWidth);
+		mWidth = width;
+		mSize = std::max(std::size_t(1), (width + BITS - 1) / BITS);
+	}
+
+	/// Clears the bits above the width.
+	void normalize() {
+		if (mWidth % BITS != 0) {
+			mData[mSize - 1] &= (mp_limb_t(1) << (mWidth % BITS)) - 1;
+		}
+	}
+
+	/// Inverts all bits.
+	void complement() {
+		mpn_com(mData, mData, mp_size_t(mSize));
+		normalize();
+	}
+
+	BVValue toValue() {
+		normalize();
+		BVValue::Base res(mWidth);
+		const mp_limb_t* data = mData;
+		auto block = [data](std::size_t i) {
+			return Block(data[i / BLOCKS_PER_LIMB] >> (BLOCK_BITS * (i % BLOCKS_PER_LIMB)));
+		};
+		boost::from_block_range(
+			boost::make_transform_iterator(boost::counting_iterator<std::size_t>(0), block),
+			boost::make_transform_iterator(boost::counting_iterator<std::size_t>(res.num_blocks()), block),
+			res
+		);
+		return BVValue(std::move(res));
+	}
+};
+}
+
 BVValue::BVValue(std::size_t _width, const mpz_class& _value) {
 	// Obtain an mpz_t copy of _value
 	mpz_t value;
@@ -41,6 +157,7 @@ BVValue::BVValue(std::size_t _width, const mpz_class& _value) {
 	if (valueNegative) {
 		mValue.flip();
 	}
+	mpz_clear(value);
 }
 
 BVValue BVValue::concat(const BVValue& _other) const {
@@ -123,97 +240,85 @@ BVValue BVValue::extract(std::size_t _highest, std::size_t _lowest) const {
 }
 
 BVValue BVValue::shift(const BVValue& _other, bool _left, bool _arithmetic) const {
-	std::size_t firstSize = width() - 1;
-	std::size_t highestRelevantPos = 0;
-
 	bool fillWithOnes = !_left && _arithmetic && (*this)[width() - 1];
 
-	while ((firstSize >>= 1) != 0)
-		++highestRelevantPos;
-
-	for (std::size_t i = highestRelevantPos + 1; i < _other.width(); ++i) {
-		if (_other[i]) {
-			Base allZero(width());
-			return BVValue(fillWithOnes ? ~allZero : allZero);
-		}
+	// Shifting by at least the width yields zero (or all ones).
+	Limbs amount(_other);
+	std::size_t shiftBy = width();
+	if (amount.significant() == 1 && amount[0] < width()) {
+		shiftBy = std::size_t(amount[0]);
 	}
 
-	Base shifted(fillWithOnes ? ~mValue : mValue);
-	std::size_t shiftBy = 1;
-
-	for (std::size_t i = 0; i <= highestRelevantPos && i < _other.width(); ++i) {
-		if (_other[i]) {
-			if (_left) {
-				shifted <<= shiftBy;
-			} else {
-				shifted >>= shiftBy;
-			}
+	Limbs value(*this);
+	if (fillWithOnes) value.complement();
+	Limbs shifted(width());
+	if (shiftBy < width()) {
+		std::size_t limbs = shiftBy / Limbs::BITS;
+		unsigned bits = unsigned(shiftBy % Limbs::BITS);
+		std::size_t n = value.size() - limbs;
+		if (_left) {
+			if (bits == 0) mpn_copyi(shifted.data() + limbs, value.data(), mp_size_t(n));
+			else mpn_lshift(shifted.data() + limbs, value.data(), mp_size_t(n), bits);
+		} else {
+			if (bits == 0) mpn_copyi(shifted.data(), value.data() + limbs, mp_size_t(n));
+			else mpn_rshift(shifted.data(), value.data() + limbs, mp_size_t(n), bits);
 		}
-		shiftBy *= 2;
 	}
-
-	return BVValue(fillWithOnes ? ~shifted : shifted);
+	if (fillWithOnes) shifted.complement();
+	return shifted.toValue();
 }
 
 BVValue BVValue::divideUnsigned(const BVValue& _other, bool _returnRemainder) const {
 	assert(width() == _other.width());
-	assert(Base(_other) != Base(_other.width(), 0));
-
-	Base quotient(width());
-	std::size_t quotientIndex = 0;
-	Base divisor = static_cast<Base>(_other);
-	Base remainder(mValue);
-
-	while (!divisor[divisor.size() - 1] && remainder > divisor) {
-		++quotientIndex;
-		divisor <<= 1;
-	}
-
-	while (true) {
-		if (remainder >= divisor) {
-			quotient[quotientIndex] = true;
-			// substract divisor from remainder
-			bool carry = false;
-			for (std::size_t i = divisor.find_first(); i < remainder.size(); ++i) {
-				bool newRemainderI = (remainder[i] != divisor[i]) != carry;
-				carry = (remainder[i] && carry && divisor[i]) || (!remainder[i] && (carry || divisor[i]));
-				remainder[i] = newRemainderI;
-			}
-		}
-		if (quotientIndex == 0) {
-			break;
-		}
-		divisor >>= 1;
-		--quotientIndex;
-	}
+	assert(!_other.isZero());
 
-	return BVValue(_returnRemainder ? std::move(remainder) : std::move(quotient));
+	Limbs dividend(*this);
+	Limbs divisor(_other);
+	if (dividend.size() == 1) {
+		dividend[0] = _returnRemainder ? dividend[0] % divisor[0] : dividend[0] / divisor[0];
+		return dividend.toValue();
+	}
+	std::size_t nn = dividend.significant();
+	std::size_t dn = divisor.significant();
+	if (nn < dn) {
+		// The divisor is larger than the dividend.
+		return _returnRemainder ? *this : BVValue(width());
+	}
+	Limbs quotient(width());
+	Limbs remainder(width());
+	mpn_tdiv_qr(quotient.data(), remainder.data(), 0, dividend.data(), mp_size_t(nn), divisor.data(), mp_size_t(dn));
+	return _returnRemainder ? remainder.toValue() : quotient.toValue();
 }
 
 BVValue operator+(const BVValue& lhs, const BVValue& rhs) {
 	assert(lhs.width() == rhs.width());
-	bool carry = false;
-	BVValue::Base sum(lhs.width());
-	for (std::size_t i = 0; i < lhs.width(); ++i) {
-		sum[i] = (lhs[i] != rhs[i]) != carry;
-		carry = (lhs[i] && rhs[i]) || (carry && (lhs[i] || rhs[i]));
-	}
-	return BVValue(std::move(sum));
+	Limbs sum(lhs);
+	Limbs summand(rhs);
+	mpn_add_n(sum.data(), sum.data(), summand.data(), mp_size_t(sum.size()));
+	return sum.toValue();
 }
 
 BVValue operator*(const BVValue& lhs, const BVValue& rhs) {
 	assert(lhs.width() == rhs.width());
-	BVValue product(lhs.width());
-	BVValue::Base summand(lhs.base());
-
-	for (std::size_t i = 0; i < lhs.width(); ++i) {
-		if (rhs[i]) {
-			product = product + BVValue(BVValue::Base(summand));
-		}
-		summand <<= 1;
+	Limbs a(lhs);
+	Limbs b(rhs);
+	if (a.size() == 1) {
+		a[0] *= b[0];
+		return a.toValue();
 	}
-
-	return product;
+	std::size_t an = a.significant();
+	std::size_t bn = b.significant();
+	// mpn_mul expects the longer operand first.
+	const Limbs* first = &a;
+	const Limbs* second = &b;
+	if (an < bn) {
+		std::swap(first, second);
+		std::swap(an, bn);
+	}
+	Limbs product(std::max(lhs.width(), (an + bn) * Limbs::BITS));
+	mpn_mul(product.data(), first->data(), mp_size_t(an), second->data(), mp_size_t(bn));
+	product.truncate(lhs.width());
+	return product.toValue();
 }
 
-}
\ No newline at end of file
+}
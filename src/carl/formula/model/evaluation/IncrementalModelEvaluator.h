@@ -0,0 +1,312 @@
+#pragma once
+
+#include "../Model.h"
+#include "ModelEvaluation.h"
+#include "../ran/RealAlgebraicNumberEvaluation.h"
+
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace carl {
+namespace model {
+
+	/**
+	 * Evaluates a fixed formula over a model that changes in only few variables at a time.
+	 *
+	 * The formula is compiled once into a DAG of formula nodes, where every distinct subformula is a single node.
+	 * The left hand sides of constraints form a second layer of polynomial nodes, shared by all constraints with the same polynomial.
+	 * Nodes are numbered such that every node comes after its children.
+	 * Every variable has a list of the nodes that depend on it: polynomial nodes for arithmetic variables, formula nodes for boolean variables.
+	 *
+	 * Every node caches its last value: a polynomial node the sign of its polynomial (or the polynomial with the known values substituted if the sign is not determined),
+	 * a formula node the substituted formula as computed by model::substituteIn().
+	 * After the caller reported the changed variables with changed(), evaluate() only recomputes the polynomial nodes of these variables,
+	 * and the formula nodes above them whose children actually changed their values.
+	 * Signs at real algebraic numbers are computed by RealAlgebraicNumberEvaluation::sgn().
+	 *
+	 * Nodes that can not be tracked this way are recomputed on every evaluation:
+	 * formulas other than the boolean skeleton, constraints and boolean variables (like bitvector constraints or variable comparisons),
+	 * and polynomials with a variable whose value is a substitution, as it may depend on other variables.
+	 */
+	template<typename Rational, typename Poly>
+	class IncrementalModelEvaluator {
+	public:
+		using ModelT = Model<Rational,Poly>;
+	private:
+		struct PolynomialNode {
+			Poly polynomial;
+			std::set<Variable> variables;
+			/// Indices of the constraint nodes using this polynomial.
+			std::vector<std::size_t> parents;
+			/// Whether the sign is determined by the model.
+			bool determined = false;
+			Sign sign = Sign::ZERO;
+			/// The polynomial with the known values substituted, if the sign is not determined.
+			Poly residual;
+			/// Whether some variable is assigned a substitution.
+			bool isVolatile = false;
+		};
+		struct FormulaNode {
+			Formula<Poly> formula;
+			/// Indices of the subformula nodes, or of the polynomial node for constraints.
+			std::vector<std::size_t> children;
+			std::vector<std::size_t> parents;
+			/// Whether the node is evaluated by model::substitute() on every evaluation.
+			bool isVolatile = false;
+			Formula<Poly> value;
+		};
+
+		std::vector<PolynomialNode> mPolynomials;
+		std::vector<FormulaNode> mFormulas;
+		std::unordered_map<Poly, std::size_t> mPolynomialIndex;
+		std::unordered_map<Formula<Poly>, std::size_t> mFormulaIndex;
+		std::map<Variable, std::vector<std::size_t>> mPolynomialDependencies;
+		std::map<Variable, std::vector<std::size_t>> mFormulaDependencies;
+		std::vector<std::size_t> mVolatileFormulas;
+		std::set<std::size_t> mVolatilePolynomials;
+
+		std::set<std::size_t> mDirtyPolynomials;
+		std::set<std::size_t> mDirtyFormulas;
+
+		std::size_t mPolynomialEvaluations = 0;
+		std::size_t mFormulaEvaluations = 0;
+
+		std::size_t addPolynomial(const Poly& p, std::size_t parent) {
+			auto it = mPolynomialIndex.find(p);
+			if (it == mPolynomialIndex.end()) {
+				std::size_t id = mPolynomials.size();
+				it = mPolynomialIndex.emplace(p, id).first;
+				mPolynomials.emplace_back();
+				mPolynomials.back().polynomial = p;
+				mPolynomials.back().variables = p.gatherVariables();
+				for (auto v: mPolynomials.back().variables) {
+					mPolynomialDependencies[v].push_back(id);
+				}
+			}
+			mPolynomials[it->second].parents.push_back(parent);
+			return it->second;
+		}
+
+		std::size_t addFormula(const Formula<Poly>& f) {
+			auto it = mFormulaIndex.find(f);
+			if (it != mFormulaIndex.end()) return it->second;
+			std::vector<std::size_t> children;
+			bool isVolatile = false;
+			switch (f.getType()) {
+				case FormulaType::TRUE:
+				case FormulaType::FALSE:
+				case FormulaType::BOOL:
+				case FormulaType::CONSTRAINT:
+					break;
+				case FormulaType::NOT:
+					children.push_back(addFormula(f.subformula()));
+					break;
+				case FormulaType::IMPLIES:
+					children.push_back(addFormula(f.premise()));
+					children.push_back(addFormula(f.conclusion()));
+					break;
+				case FormulaType::ITE:
+					children.push_back(addFormula(f.condition()));
+					children.push_back(addFormula(f.firstCase()));
+					children.push_back(addFormula(f.secondCase()));
+					break;
+				case FormulaType::AND:
+				case FormulaType::OR:
+				case FormulaType::XOR:
+				case FormulaType::IFF:
+					for (const auto& sub: f.subformulas()) {
+						children.push_back(addFormula(sub));
+					}
+					break;
+				default:
+					isVolatile = true;
+			}
+			std::size_t id = mFormulas.size();
+			mFormulaIndex.emplace(f, id);
+			mFormulas.emplace_back();
+			mFormulas.back().formula = f;
+			mFormulas.back().isVolatile = isVolatile;
+			for (auto c: children) {
+				mFormulas[c].parents.push_back(id);
+			}
+			if (f.getType() == FormulaType::CONSTRAINT) {
+				children.push_back(addPolynomial(f.constraint().lhs(), id));
+			} else if (f.getType() == FormulaType::BOOL) {
+				mFormulaDependencies[f.boolean()].push_back(id);
+			}
+			if (isVolatile) mVolatileFormulas.push_back(id);
+			mFormulas.back().children = std::move(children);
+			return id;
+		}
+
+		void evaluate(PolynomialNode& node, const ModelT& m) {
+			mPolynomialEvaluations++;
+			Poly p = node.polynomial;
+			RealAlgebraicNumberEvaluation::RANMap<Rational> rans;
+			bool complete = true;
+			node.isVolatile = false;
+			for (auto v: node.variables) {
+				auto it = m.find(v);
+				if (it == m.end()) {
+					complete = false;
+					continue;
+				}
+				if (it->second.isSubstitution()) node.isVolatile = true;
+				const auto& value = m.evaluated(v);
+				if (value.isRational()) {
+					substituteIn(p, v, value.asRational());
+				} else if (value.isRAN()) {
+					if (value.asRAN().isNumeric()) substituteIn(p, v, value.asRAN().value());
+					else rans.emplace(v, value.asRAN());
+				} else {
+					complete = false;
+				}
+			}
+			if (node.isVolatile && !complete) {
+				p = substitute(node.polynomial, m);
+			}
+			if (p.isNumber()) {
+				node.determined = true;
+				node.sign = carl::sgn(p.constantPart());
+			} else if (complete) {
+				node.determined = true;
+				node.sign = RealAlgebraicNumberEvaluation::sgn(p, rans);
+			} else {
+				node.determined = false;
+				node.residual = std::move(p);
+			}
+		}
+
+		Formula<Poly> evaluate(const FormulaNode& node, const ModelT& m) {
+			mFormulaEvaluations++;
+			const auto& f = node.formula;
+			if (node.isVolatile) return substitute(f, m);
+			switch (f.getType()) {
+				case FormulaType::BOOL: {
+					auto it = m.find(f.boolean());
+					if (it == m.end() || !it->second.isBool()) return f;
+					return Formula<Poly>(it->second.asBool() ? FormulaType::TRUE : FormulaType::FALSE);
+				}
+				case FormulaType::CONSTRAINT: {
+					const auto& p = mPolynomials[node.children.front()];
+					if (p.determined) {
+						return Formula<Poly>(carl::evaluate(p.sign, f.constraint().relation()) ? FormulaType::TRUE : FormulaType::FALSE);
+					}
+					return Formula<Poly>(Constraint<Poly>(p.residual, f.constraint().relation()));
+				}
+				case FormulaType::NOT:
+					return Formula<Poly>(FormulaType::NOT, value(node.children[0]));
+				case FormulaType::IMPLIES:
+					return Formula<Poly>(FormulaType::IMPLIES, value(node.children[0]), value(node.children[1]));
+				case FormulaType::ITE:
+					return Formula<Poly>(FormulaType::ITE, value(node.children[0]), value(node.children[1]), value(node.children[2]));
+				case FormulaType::AND:
+				case FormulaType::OR:
+				case FormulaType::XOR:
+				case FormulaType::IFF: {
+					Formulas<Poly> subformulas;
+					for (auto c: node.children) subformulas.push_back(value(c));
+					return Formula<Poly>(f.getType(), std::move(subformulas));
+				}
+				default:
+					return f;
+			}
+		}
+
+		const Formula<Poly>& value(std::size_t id) const {
+			return mFormulas[id].value;
+		}
+
+	public:
+		/**
+		 * Compiles the given formula.
+		 * All nodes are evaluated by the first call to evaluate().
+		 */
+		explicit IncrementalModelEvaluator(const Formula<Poly>& f) {
+			addFormula(f);
+			reset();
+		}
+
+		/**
+		 * Reports that the value of the given variable has changed, was added or was removed from the model.
+		 * Values of other variables are assumed to be unchanged in the next call to evaluate().
+		 */
+		void changed(const ModelVariable& var) {
+			// Nodes depending on other kinds of variables are evaluated anyway.
+			if (!var.isVariable()) return;
+			auto pit = mPolynomialDependencies.find(var.asVariable());
+			if (pit != mPolynomialDependencies.end()) {
+				mDirtyPolynomials.insert(pit->second.begin(), pit->second.end());
+			}
+			auto fit = mFormulaDependencies.find(var.asVariable());
+			if (fit != mFormulaDependencies.end()) {
+				mDirtyFormulas.insert(fit->second.begin(), fit->second.end());
+			}
+		}
+
+		/// Marks all nodes to be recomputed, for example if the model was replaced.
+		void reset() {
+			for (std::size_t i = 0; i < mPolynomials.size(); ++i) mDirtyPolynomials.insert(i);
+			for (std::size_t i = 0; i < mFormulas.size(); ++i) mDirtyFormulas.insert(i);
+		}
+
+		/**
+		 * Evaluates the formula over the given model.
+		 * The model must only differ from the model of the previous call in the variables reported by changed().
+		 * @return The same result as model::evaluate() for the formula.
+		 */
+		ModelValue<Rational,Poly> evaluate(const ModelT& m) {
+			mDirtyPolynomials.insert(mVolatilePolynomials.begin(), mVolatilePolynomials.end());
+			for (auto id: mDirtyPolynomials) {
+				auto& node = mPolynomials[id];
+				bool determined = node.determined;
+				Sign sign = node.sign;
+				Poly residual = std::move(node.residual);
+				evaluate(node, m);
+				if (node.isVolatile) mVolatilePolynomials.insert(id);
+				else mVolatilePolynomials.erase(id);
+				if (determined != node.determined || (determined && sign != node.sign) || (!determined && residual != node.residual)) {
+					mDirtyFormulas.insert(node.parents.begin(), node.parents.end());
+				}
+			}
+			mDirtyPolynomials.clear();
+			mDirtyFormulas.insert(mVolatileFormulas.begin(), mVolatileFormulas.end());
+			// Parents have larger indices, hence every node is evaluated at most once.
+			while (!mDirtyFormulas.empty()) {
+				std::size_t id = *mDirtyFormulas.begin();
+				mDirtyFormulas.erase(mDirtyFormulas.begin());
+				auto& node = mFormulas[id];
+				Formula<Poly> res = evaluate(node, m);
+				if (res != node.value) {
+					node.value = res;
+					mDirtyFormulas.insert(node.parents.begin(), node.parents.end());
+				}
+			}
+			const auto& res = mFormulas.back().value;
+			if (res.isTrue()) return ModelValue<Rational,Poly>(true);
+			if (res.isFalse()) return ModelValue<Rational,Poly>(false);
+			return createSubstitution<Rational,Poly,ModelFormulaSubstitution<Rational,Poly>>(res);
+		}
+
+		/// Number of distinct subformulas.
+		std::size_t numberOfFormulas() const {
+			return mFormulas.size();
+		}
+		/// Number of distinct polynomials.
+		std::size_t numberOfPolynomials() const {
+			return mPolynomials.size();
+		}
+		/// Number of evaluations of polynomial nodes so far.
+		std::size_t polynomialEvaluations() const {
+			return mPolynomialEvaluations;
+		}
+		/// Number of evaluations of formula nodes so far.
+		std::size_t formulaEvaluations() const {
+			return mFormulaEvaluations;
+		}
+	};
+
+}
+}
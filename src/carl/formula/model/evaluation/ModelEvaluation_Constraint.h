@@ -25,14 +25,14 @@ namespace model {
 	template<typename Rational, typename Poly>
 	void evaluate(ModelValue<Rational,Poly>& res, Constraint<Poly>& c, const Model<Rational,Poly>& m) {
 		Poly p = c.lhs();
-		evaluate(res, p, m);
-		if (res.isRational()) {
-			res = evaluate(res.asRational(), c.relation());
-		} else if (res.isRAN()) {
-			res = evaluate(res.asRAN().sgn(), c.relation());
-		} else {
-			res = createSubstitution<Rational,Poly,ModelFormulaSubstitution<Rational,Poly>>(Formula<Poly>(Constraint<Poly>(p, c.relation())));
+		substituteIn(p, m);
+		auto map = collectRANIR(p.gatherVariables(), m);
+		if (map.size() == p.gatherVariables().size()) {
+			// Only the sign is needed, which avoids computing the value as a real algebraic number.
+			res = evaluate(RealAlgebraicNumberEvaluation::sgn(p, map), c.relation());
+			return;
 		}
+		res = createSubstitution<Rational,Poly,ModelFormulaSubstitution<Rational,Poly>>(Formula<Poly>(Constraint<Poly>(p, c.relation())));
 	}
 }
 }
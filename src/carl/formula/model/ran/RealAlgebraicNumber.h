@@ -407,6 +407,25 @@ std::ostream& operator<<(std::ostream& os, const RealAlgebraicNumber<Num>& ran)
 	}, ran.mContent);
 }
 
+/**
+ * Hashes a real algebraic number by its representation, that is the value of a numeric number or the defining polynomial and the isolating interval of an interval number.
+ * Other than std::hash, it never refines the number and different numbers hardly ever collide.
+ * However, equal numbers with different representations get different hashes, hence it only suits containers that tolerate duplicates, like the store of compact_tree.
+ */
+template<typename Number>
+struct RealAlgebraicNumberRepresentationHash {
+	std::size_t operator()(const RealAlgebraicNumber<Number>& n) const {
+		if (n.isNumeric()) {
+			return carl::hash_all(n.isRoot(), n.value());
+		}
+		if (n.isInterval()) {
+			const auto& c = std::get<typename RealAlgebraicNumber<Number>::IntervalContent>(n.content());
+			return carl::hash_all(n.isRoot(), c.polynomial(), c.interval());
+		}
+		return std::hash<RealAlgebraicNumber<Number>>()(n);
+	}
+};
+
 }
 
 namespace std {
@@ -7,6 +7,7 @@
  * get the resulting polynomial or algebraic real.
  */
 
+#include <algorithm>
 #include <map>
 #include <vector>
 
@@ -71,6 +72,43 @@ RealAlgebraicNumber<Number> evaluate(const MultivariatePolynomial<Number>& p, co
 template<typename Number>
 RealAlgebraicNumber<Number> evaluateIR(const MultivariatePolynomial<Number>& p, const RANMap<Number>& m);
 
+/**
+ * Counts which stage of sgn() decided the sign.
+ * The counters are global and, as most of carl, not synchronized.
+ */
+struct SignStatistics {
+	/// The polynomial was constant after plugging in the numeric values.
+	std::size_t numeric = 0;
+	/// The evaluation with double intervals excluded zero.
+	std::size_t floatingPoint = 0;
+	/// The evaluation with exact intervals excluded zero, possibly after refining the real algebraic numbers.
+	std::size_t refinement = 0;
+	/// The sign was obtained from the full evaluation with resultants.
+	std::size_t fallback = 0;
+};
+inline SignStatistics& signStatistics() {
+	static SignStatistics stats;
+	return stats;
+}
+
+/**
+ * Compute the sign of the given polynomial 'p' at the point represented by the variable-to-number-mapping 'm'.
+ * This is equivalent to <code>evaluate(p, m).sgn()</code>, but the resulting real algebraic number is only constructed if the sign can not be decided otherwise.
+ * After plugging in the numeric values, the remaining numbers are first represented by their isolating intervals rounded outward to doubles.
+ * If the interval evaluation of 'p' does not contain zero, this is the sign.
+ * Otherwise 'p' is evaluated on the exact isolating intervals, and the numbers are refined (which also affects 'm') at most 'refinements' times.
+ * Only if zero still can not be excluded, the result is computed by evaluate().
+ * Note that variables of 'p' must be assigned in 'm'.
+ */
+template<typename Number>
+Sign sgn(const MultivariatePolynomial<Number>& p, const RANMap<Number>& m, std::size_t refinements = 8);
+/**
+ * Compute the sign of the given polynomial 'p' at the given 'point' based on the variable order given by 'variables'.
+ * @see sgn(const MultivariatePolynomial<Number>&, const RANMap<Number>&, std::size_t)
+ */
+template<typename Number, typename Coeff>
+Sign sgn(const MultivariatePolynomial<Coeff>& p, const RealAlgebraicPoint<Number>& point, const std::vector<Variable>& variables, std::size_t refinements = 8);
+
 /**
  * Compute a univariate polynomial with rational coefficients that has the roots of 'p' whose coefficient variables have been substituted by the roots given in m.
  * The map varToInterval gives back an assignment of variables to the isolating intervals of the roots for each variable.
@@ -169,6 +207,70 @@ RealAlgebraicNumber<Number> evaluate(const MultivariatePolynomial<Number>& p, co
 }
 
 
+template<typename Number>
+Sign sgn(const MultivariatePolynomial<Number>& p, const RANMap<Number>& m, std::size_t refinements) {
+	CARL_LOG_TRACE("carl.ran", "Computing sign of " << p << " on " << m);
+	MultivariatePolynomial<Number> pol(p);
+	RANMap<Number> IRmap;
+	for (const auto& r: m) {
+		if (!pol.has(r.first)) continue;
+		if (r.second.isNumeric()) {
+			pol.substituteIn(r.first, MultivariatePolynomial<Number>(r.second.value()));
+		} else {
+			IRmap.emplace(r.first, r.second);
+		}
+	}
+	if (pol.isNumber()) {
+		signStatistics().numeric++;
+		return carl::sgn(pol.constantPart());
+	}
+
+	// Only isolating intervals can be refined, other representations are passed on to evaluate() directly.
+	bool intervals = std::all_of(IRmap.begin(), IRmap.end(), [](const auto& r){ return r.second.isInterval(); });
+	if (intervals) {
+		std::map<Variable, Interval<double>> doubleMap;
+		for (const auto& r: IRmap) {
+			const auto& i = r.second.getInterval();
+			doubleMap.emplace(r.first, Interval<double>(i.lower(), BoundType::WEAK, i.upper(), BoundType::WEAK));
+		}
+		Sign s = IntervalEvaluation::evaluate(pol, doubleMap).sgn();
+		if (s != Sign::ZERO) {
+			CARL_LOG_TRACE("carl.ran", "Sign " << s << " from double intervals " << doubleMap);
+			signStatistics().floatingPoint++;
+			return s;
+		}
+
+		std::map<Variable, Interval<Number>> exactMap;
+		for (std::size_t i = 0; i <= refinements; i++) {
+			if (i > 0) {
+				for (const auto& r: IRmap) r.second.refine();
+			}
+			for (const auto& r: IRmap) {
+				exactMap[r.first] = r.second.getInterval();
+			}
+			Interval<Number> res = IntervalEvaluation::evaluate(pol, exactMap);
+			// If all numbers were refined to numeric values, the evaluation is a point interval.
+			if (res.sgn() != Sign::ZERO || (res.isPointInterval() && carl::isZero(res.lower()))) {
+				CARL_LOG_TRACE("carl.ran", "Sign " << res.sgn() << " from " << exactMap << " after " << i << " refinements");
+				signStatistics().refinement++;
+				return res.sgn();
+			}
+		}
+	}
+	signStatistics().fallback++;
+	return evaluate(pol, IRmap).sgn();
+}
+
+template<typename Number, typename Coeff>
+Sign sgn(const MultivariatePolynomial<Coeff>& p, const RealAlgebraicPoint<Number>& point, const std::vector<Variable>& variables, std::size_t refinements) {
+	assert(point.dim() == variables.size());
+	RANMap<Number> RANs;
+	for (std::size_t i = 0; i < point.dim(); i++) {
+		RANs.emplace(variables[i], point[i]);
+	}
+	return sgn(MultivariatePolynomial<Number>(p), RANs, refinements);
+}
+
 /**
  * Evaluate the given polynomial with the given values for the variables.
  * Asserts that all variables of p have an assignment in m and that m has no additional assignments.
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "../../../config.h"
+
 namespace carl {
 namespace RealAlgebraicNumberSettings {
 
@@ -19,6 +21,22 @@ enum class RefinementStrategy {
 	DEFAULT = BINARYSAMPLE
 };
 
+/// Predefined flags for how ran::IntervalContent decides which part of an interval contains the root and computes signs of polynomials.
+enum class RootCountingStrategy {
+	/// Counts real roots with Sturm sequences, which are computed once per number and reused.
+	STURM,
+	/// Compares the signs at the interval bounds and refines until Descartes' rule of signs excludes roots of other polynomials. No Sturm sequences are computed.
+	DESCARTES,
+#ifdef RAN_USE_DESCARTES
+	DEFAULT = DESCARTES
+#else
+	DEFAULT = STURM
+#endif
+};
+
+/// Root counting strategy that is used by ran::IntervalContent. Descartes' rule of signs is used if carl is built with RAN_USE_DESCARTES.
+static const RootCountingStrategy ROOT_COUNTING = RootCountingStrategy::DEFAULT;
+
 /// Maximum number of refinements in which the sample() value should be computed for splitting. Otherwise the midpoint is taken.
 static const std::size_t MAXREFINE = 8;
 
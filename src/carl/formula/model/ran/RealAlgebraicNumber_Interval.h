@@ -3,12 +3,15 @@
 #include "../../../core/UnivariatePolynomial.h"
 #include "../../../core/polynomialfunctions/Resultant.h"
 #include "../../../core/polynomialfunctions/RootCounting.h"
+#include "../../../core/polynomialfunctions/SignVariations.h"
 #include "../../../core/polynomialfunctions/SquareFreePart.h"
 #include "../../../core/polynomialfunctions/SturmSequence.h"
 
 #include "../../../interval/Interval.h"
 #include "../../../interval/IntervalEvaluation.h"
 
+#include "RealAlgebraicNumberSettings.h"
+
 #include <list>
 
 namespace carl {
@@ -34,7 +37,7 @@ namespace ran {
 				assert(polynomial == carl::squareFreePart(polynomial));
 			}
 			Content(const Polynomial& p, const Interval<Number>& i):
-				polynomial(carl::squareFreePart(p)), interval(i), sturmSequence(carl::sturm_sequence(polynomial))
+				polynomial(carl::squareFreePart(p)), interval(i)
 			{}
 		};
 
@@ -43,6 +46,58 @@ namespace ran {
 		static Polynomial replaceVariable(const Polynomial& p) {
 			return p.replaceVariable(auxVariable);
 		}
+
+		static constexpr bool useDescartes() {
+			return RealAlgebraicNumberSettings::ROOT_COUNTING == RealAlgebraicNumberSettings::RootCountingStrategy::DESCARTES;
+		}
+
+		/**
+		 * Checks whether the root lies within the open interval between the lower bound and n.
+		 * Assumes that n is within the interval and not a root.
+		 */
+		bool isRootBelow(const Number& n) const {
+			if (useDescartes()) {
+				// The polynomial is square-free and has a single root within the interval.
+				return polynomial().sgn(interval().lower()) != polynomial().sgn(n);
+			}
+			return carl::count_real_roots(sturm_sequence(), Interval<Number>(interval().lower(), BoundType::STRICT, n, BoundType::STRICT)) > 0;
+		}
+
+		/**
+		 * Checks whether the current interval contains the root.
+		 * Assumes that the interval is contained in an isolating interval and its bounds are not roots.
+		 */
+		bool containsRoot() const {
+			if (useDescartes()) {
+				return polynomial().sgn(interval().lower()) != polynomial().sgn(interval().upper());
+			}
+			return carl::count_real_roots(sturm_sequence(), interval()) > 0;
+		}
+
+		/**
+		 * Checks whether this number is a root of p without Sturm sequences.
+		 * If so, it is also a root of gcd(polynomial(), p), which divides polynomial() and thus has at most one root in the interval.
+		 */
+		bool isRootOfDescartes(const Polynomial& p) const {
+			if (interval().isPointInterval()) return p.isRoot(interval().lower());
+			Polynomial g = carl::gcd(polynomial(), p);
+			return !g.isConstant() && g.sgn(interval().lower()) != g.sgn(interval().upper());
+		}
+
+		/**
+		 * Computes the sign of p at this number without Sturm sequences.
+		 * If this number is not a root of p, the interval is refined until the sign variations of p exclude all roots of p from it.
+		 */
+		Sign sgnDescartes(const Polynomial& p) const {
+			if (isRootOfDescartes(p)) return Sign::ZERO;
+			while (!interval().isPointInterval() && carl::sign_variations(p, interval()) > 0) {
+				refine();
+			}
+			if (interval().isPointInterval()) {
+				return p.sgn(interval().lower());
+			}
+			return p.sgn(carl::center(interval()));
+		}
 	public:
 
 		IntervalContent():
@@ -89,6 +144,9 @@ namespace ran {
 			return mContent->interval;
 		}
 		auto& sturm_sequence() const {
+			if (mContent->sturmSequence.empty()) {
+				mContent->sturmSequence = carl::sturm_sequence(polynomial());
+			}
 			return mContent->sturmSequence;
 		}
 		auto& refinementCount() const {
@@ -110,7 +168,11 @@ namespace ran {
 		}
 
 		bool is_root_of(const UnivariatePolynomial<Number>& p) const {
-			return carl::count_real_roots(p, interval()) == 1;
+			if (useDescartes()) {
+				return isRootOfDescartes(replaceVariable(p));
+			}
+			// p may have another root within the interval
+			return sgn(p) == Sign::ZERO;
 		}
 
 		bool isIntegral() {
@@ -119,7 +181,7 @@ namespace ran {
 		
 		void setPolynomial(const Polynomial& p) const {
 			polynomial() = replaceVariable(p);
-			sturm_sequence() = carl::sturm_sequence(polynomial());
+			mContent->sturmSequence.clear();
 		}
 
 		Sign sgn() const {
@@ -129,6 +191,7 @@ namespace ran {
 		Sign sgn(const Polynomial& p) const {
 			Polynomial tmp = replaceVariable(p);
 			if (polynomial() == tmp) return Sign::ZERO;
+			if (useDescartes()) return sgnDescartes(tmp);
 			auto seq = carl::sturm_sequence(polynomial(), derivative(polynomial()) * tmp);
 			int variations = carl::count_real_roots(seq, interval());
 			assert((variations == -1) || (variations == 0) || (variations == 1));
@@ -173,7 +236,7 @@ namespace ran {
 					interval() = Interval<Number>(pivot, pivot);
 					return;
 				}
-				if (carl::count_real_roots(sturm_sequence(), Interval<Number>(interval().lower(), BoundType::STRICT, pivot, BoundType::STRICT)) > 0) {
+				if (isRootBelow(pivot)) {
 					interval().setUpper(pivot);
 				} else {
 					interval().setLower(pivot);
@@ -195,7 +258,7 @@ namespace ran {
 					interval() = Interval<Number>(n, n);
 					return true;
 				}
-				if (carl::count_real_roots(polynomial(), Interval<Number>(interval().lower(), BoundType::STRICT, n, BoundType::STRICT)) > 0) {
+				if (isRootBelow(n)) {
 					interval().setUpper(n);
 				} else {
 					interval().setLower(n);
@@ -220,7 +283,7 @@ namespace ran {
 				interval().setUpper(newBound);
 			}
 			
-			while (carl::count_real_roots(polynomial(), interval()) == 0) {
+			while (!containsRoot()) {
 				if (isLeft) {
 					Number oldBound = interval().lower();
 					newBound = carl::sample(Interval<Number>(n, BoundType::STRICT, oldBound, BoundType::STRICT));
@@ -350,19 +413,27 @@ IntervalContent<Number> evaluate(const MultivariatePolynomial<Number>& p, const
 	Interval<Number> interval = IntervalEvaluation::evaluate(poly, varToInterval);
 	CARL_LOG_DEBUG("carl.ran", "-> " << interval);
 
-	auto sturmSeq = sturm_sequence(res);
 	// the interval should include at least one root.
 	assert(!carl::isZero(res));
 	assert(
 		res.sgn(interval.lower()) == Sign::ZERO ||
 		res.sgn(interval.upper()) == Sign::ZERO ||
-		count_real_roots(sturmSeq, interval) >= 1
+		count_real_roots(res, interval) >= 1
 	);
-	while (
-		res.sgn(interval.lower()) == Sign::ZERO ||
-		res.sgn(interval.upper()) == Sign::ZERO ||
-		count_real_roots(sturmSeq, interval) != 1) 
-	{
+	std::vector<UnivariatePolynomial<Number>> sturmSeq;
+	bool useDescartes = RealAlgebraicNumberSettings::ROOT_COUNTING == RealAlgebraicNumberSettings::RootCountingStrategy::DESCARTES;
+	if (useDescartes) {
+		// Descartes' rule of signs counts multiple roots repeatedly.
+		res = carl::squareFreePart(res);
+	} else {
+		sturmSeq = sturm_sequence(res);
+	}
+	auto isolates = [&](const Interval<Number>& i) {
+		if (res.sgn(i.lower()) == Sign::ZERO || res.sgn(i.upper()) == Sign::ZERO) return false;
+		if (useDescartes) return carl::sign_variations(res, i) == 1;
+		return count_real_roots(sturmSeq, i) == 1;
+	};
+	while (!isolates(interval)) {
 		// refine the result interval until it isolates exactly one real root of the result polynomial
 		for (auto it = m.begin(); it != m.end(); it++) {
 			it->second.refine();
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "ideal-ds/IdealDSDivMask.h"
 #include "ideal-ds/IdealDSVector.h"
 #include "ideal-ds/PolynomialSorts.h"
 
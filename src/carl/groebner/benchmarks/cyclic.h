@@ -44,6 +44,42 @@ std::vector<MultivariatePolynomial<C, O, P>> cyclic3()
 	return res;
 }
 
+template<typename C, typename O, typename P>
+std::vector<MultivariatePolynomial<C, O, P>> cyclic4()
+{
+	carl::StringParser sp;
+	sp.setVariables({"x", "y", "z", "t"});
+	std::vector<MultivariatePolynomial<C, O, P>> res;
+	// x + y + z + t
+	res.push_back(sp.parseMultivariatePolynomial<C, O, P>("x + y + z + t"));
+	// x*y + y*z + z*t + t*x
+	res.push_back(sp.parseMultivariatePolynomial<C, O, P>("x*y + y*z + z*t + t*x"));
+	// x*y*z + y*z*t + z*t*x + t*x*y
+	res.push_back(sp.parseMultivariatePolynomial<C, O, P>("x*y*z + y*z*t + z*t*x + t*x*y"));
+	// x*y*z*t - 1
+	res.push_back(sp.parseMultivariatePolynomial<C, O, P>("x*y*z*t + -1"));
+	return res;
+}
+
+template<typename C, typename O, typename P>
+std::vector<MultivariatePolynomial<C, O, P>> cyclic5()
+{
+	carl::StringParser sp;
+	sp.setVariables({"x", "y", "z", "t", "u"});
+	std::vector<MultivariatePolynomial<C, O, P>> res;
+	// x + y + z + t + u
+	res.push_back(sp.parseMultivariatePolynomial<C, O, P>("x + y + z + t + u"));
+	// x*y + y*z + z*t + t*u + u*x
+	res.push_back(sp.parseMultivariatePolynomial<C, O, P>("x*y + y*z + z*t + t*u + u*x"));
+	// x*y*z + y*z*t + z*t*u + t*u*x + u*x*y
+	res.push_back(sp.parseMultivariatePolynomial<C, O, P>("x*y*z + y*z*t + z*t*u + t*u*x + u*x*y"));
+	// x*y*z*t + y*z*t*u + z*t*u*x + t*u*x*y + u*x*y*z
+	res.push_back(sp.parseMultivariatePolynomial<C, O, P>("x*y*z*t + y*z*t*u + z*t*u*x + t*u*x*y + u*x*y*z"));
+	// x*y*z*t*u - 1
+	res.push_back(sp.parseMultivariatePolynomial<C, O, P>("x*y*z*t*u + -1"));
+	return res;
+}
+
 
 
 #define run_cyclic_case(INDEX)	case INDEX: return cyclic##INDEX<C, O, P>()
@@ -55,13 +91,11 @@ std::vector<MultivariatePolynomial<C, O, P>> cyclic(unsigned index)
 	{
 		run_cyclic_case(2);
 		run_cyclic_case(3);
-		//run_katsura_case(4);
-		//run_katsura_case(5);
-		//run_katsura_case(6);
-		//run_katsura_case(4);
+		run_cyclic_case(4);
+		run_cyclic_case(5);
 		default:
 			assert(index > 1);
-			assert(index < 4);
+			assert(index < 6);
 	}
 	return std::vector<MultivariatePolynomial<C, O, P>>();
 }
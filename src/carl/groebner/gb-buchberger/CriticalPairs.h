@@ -93,6 +93,15 @@ public:
      * @return 
      */
     SPolPair pop( );
+	/**
+	 * Gets the first SPol from the data structure without removing it.
+	 * @return 
+	 */
+    const SPolPair& top( ) const
+    {
+        assert( !empty( ) );
+        return mDatastruct.top( )->getFirst( );
+    }
 	/**
 	 * Eliminate multiples of the given monomial.
      * @param lm
@@ -0,0 +1,69 @@
+/**
+ * @file   ParallelBuchberger.h
+ * @ingroup gb
+ */
+
+#pragma once
+
+#include "Buchberger.h"
+#include "../../util/WorkStealingPool.h"
+
+#include <thread>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Variant of the Buchberger algorithm that reduces the S-polynomials of all critical pairs of the lowest degree concurrently.
+ *
+ * The reductions are done by a WorkStealingPool against a copy of the current ideal without the eliminated generators, which is only read.
+ * Afterwards, the remainders are reduced once more by the current ideal in the order of the pairs, as they might be reducible by remainders added before.
+ * They are added to the Groebner basis in this order, which also applies Buchberger's criteria to the new pairs, hence the result does not depend on the number of threads.
+ * Finally, the tails of the generators are reduced concurrently as well, such that the result is the reduced Groebner basis.
+ *
+ * Concurrent reductions need carl to be built with THREAD_SAFE, otherwise the reductions are done sequentially.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+class ParallelBuchberger : public Buchberger<Polynomial, AddingPolicy>
+{
+	using Base = Buchberger<Polynomial, AddingPolicy>;
+	/// Number of threads reducing S-polynomials.
+	std::size_t mThreads = std::max(1u, std::thread::hardware_concurrency());
+public:
+	ParallelBuchberger() = default;
+	ParallelBuchberger(const ParallelBuchberger& rhs) = default;
+	~ParallelBuchberger() override = default;
+
+	void calculate(const std::list<Polynomial>& scheduledForAdding);
+
+	/**
+	 * Sets the number of threads reducing S-polynomials.
+	 * @param threads Number of threads, including the calling thread.
+	 */
+	void setThreads(std::size_t threads)
+	{
+		mThreads = std::max<std::size_t>(threads, 1);
+	}
+protected:
+	/**
+	 * Computes the remainders of the S-polynomials of the given pairs.
+	 * @param pairs Critical pairs.
+	 * @return Remainders, in the order of the pairs.
+	 */
+	std::vector<Polynomial> reduceConcurrently(const std::vector<SPolPair>& pairs) const;
+	/**
+	 * Replaces the Groebner basis by the reduced Groebner basis.
+	 * Generators whose leading monomial is divisible by the leading monomial of another generator are removed.
+	 * The tails of the remaining generators are reduced concurrently, which does not change their leading terms.
+	 */
+	void interreduce();
+private:
+	/// Number of threads for the concurrent reductions, which is one unless carl was built with THREAD_SAFE.
+	std::size_t threads() const;
+};
+
+}
+
+#include "ParallelBuchberger.tpp"
@@ -0,0 +1,149 @@
+/**
+ * @file ParallelBuchberger.tpp
+ * @ingroup gb
+ */
+#pragma once
+#include "ParallelBuchberger.h"
+
+#include "../../core/polynomialfunctions/SPolynomial.h"
+
+namespace carl
+{
+
+/**
+ * Calculate the Groebner basis
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+void ParallelBuchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
+{
+	CARL_LOG_INFO("carl.gb.buchberger", "Calculate gb with " << mThreads << " threads");
+	for(std::size_t i = 0; i < this->pGb->getGenerators().size(); ++i)
+	{
+		this->mGbElementsIndices.push_back(i);
+	}
+
+	bool foundGB = false;
+	for(const Polynomial& newPol : scheduledForAdding)
+	{
+		if(this->addToGb(newPol))
+		{
+			CARL_LOG_INFO("carl.gb.buchberger", "Added a constant polynomial.");
+			foundGB = true;
+			break;
+		}
+	}
+
+	while(!foundGB && !this->pCritPairs->empty())
+	{
+		auto degree = this->pCritPairs->top().mLcm->tdeg();
+		std::vector<SPolPair> pairs;
+		while(!this->pCritPairs->empty() && this->pCritPairs->top().mLcm->tdeg() == degree)
+		{
+			pairs.push_back(this->pCritPairs->pop());
+		}
+		CARL_LOG_DEBUG("carl.gb.buchberger", "Reducing " << pairs.size() << " pairs of degree " << degree);
+		for(const Polynomial& r : reduceConcurrently(pairs))
+		{
+			if(isZero(r)) continue;
+			// Remainders added before might reduce this one further.
+			Reductor<Polynomial, Polynomial> reductor(*this->pGb, r);
+			Polynomial remainder = reductor.fullReduce();
+			CARL_LOG_DEBUG("carl.gb.buchberger", "Remainder of SPol: " << remainder);
+			if(isZero(remainder)) continue;
+			if(remainder.isConstant())
+			{
+				this->pGb->clear();
+				this->pGb->addGenerator(remainder.normalize());
+				foundGB = true;
+				break;
+			}
+			if(this->addToGb(remainder.normalize()))
+			{
+				foundGB = true;
+				break;
+			}
+		}
+	}
+	if(!foundGB)
+	{
+		interreduce();
+	}
+	this->mGbElementsIndices.clear();
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+std::vector<Polynomial> ParallelBuchberger<Polynomial, AddingPolicy>::reduceConcurrently(const std::vector<SPolPair>& pairs) const
+{
+	const std::vector<Polynomial>& generators = this->pGb->getGenerators();
+	// The lookup of the divisors removes eliminated generators on the fly, hence the reductions use a copy without them.
+	Ideal<Polynomial> snapshot(*this->pGb);
+	std::vector<Polynomial> res(pairs.size());
+	auto reduce = [&](std::size_t i) {
+		const Polynomial& p1 = generators[pairs[i].mP1];
+		const Polynomial& p2 = generators[pairs[i].mP2];
+		Polynomial spol = carl::SPolynomial(p1, p2);
+		spol.setReasons(p1.getReasons() | p2.getReasons());
+		Reductor<Polynomial, Polynomial> reductor(snapshot, spol);
+		res[i] = reductor.fullReduce();
+	};
+	WorkStealingPool::shared().parallelFor(pairs.size(), reduce, threads());
+	return res;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+void ParallelBuchberger<Polynomial, AddingPolicy>::interreduce()
+{
+	// The copy does not contain the eliminated generators.
+	Ideal<Polynomial> snapshot(*this->pGb);
+	const std::vector<Polynomial>& generators = snapshot.getGenerators();
+	Ideal<Polynomial> minimal;
+	for(std::size_t i : snapshot.getOrderedIndices())
+	{
+		bool divisible = false;
+		for(std::size_t j = 0; !divisible && j < generators.size(); ++j)
+		{
+			if(j == i) continue;
+			// Of generators with the same leading monomial, the first one is kept.
+			divisible = generators[i].lmon()->divisible(generators[j].lmon()) && (j < i || !generators[j].lmon()->divisible(generators[i].lmon()));
+		}
+		if(!divisible)
+		{
+			minimal.addGenerator(generators[i]);
+		}
+	}
+	CARL_LOG_DEBUG("carl.gb.buchberger", "Minimal gb: " << minimal);
+	std::vector<Polynomial> res(minimal.nrGenerators());
+	auto reduce = [&](std::size_t i) {
+		const Polynomial& p = minimal.getGenerator(i);
+		if(p.nrTerms() == 1)
+		{
+			res[i] = p;
+			return;
+		}
+		// Terms of the remainder are smaller than the leading term, hence p itself may be used as well.
+		Polynomial tail(p);
+		tail.stripLT();
+		Reductor<Polynomial, Polynomial> reductor(minimal, tail);
+		res[i] = reductor.fullReduce();
+		res[i] += p.lterm();
+	};
+	WorkStealingPool::shared().parallelFor(res.size(), reduce, threads());
+	this->pGb->clear();
+	for(Polynomial& p : res)
+	{
+		this->pGb->addGenerator(p.normalize());
+	}
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+std::size_t ParallelBuchberger<Polynomial, AddingPolicy>::threads() const
+{
+#ifdef THREAD_SAFE
+	return mThreads;
+#else
+	CARL_LOG_DEBUG("carl.gb.buchberger", "Concurrent reduction needs THREAD_SAFE, reducing sequentially.");
+	return 1;
+#endif
+}
+
+}
@@ -0,0 +1,55 @@
+/**
+ * @file F4.h
+ * @ingroup gb
+ *
+ */
+
+#pragma once
+
+#include "../gb-buchberger/Buchberger.h"
+#include "../../numbers/PrimeFactory.h"
+#include "F4Matrix.h"
+
+#include <type_traits>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Implementation of Faugere's F4 algorithm @cite Faugere99 with the normal selection strategy.
+ *
+ * Instead of reducing one S-polynomial at a time, all critical pairs of the lowest degree are taken from the critical pairs at once.
+ * The S-polynomials of these pairs, together with the multiples of the generators needed to reduce them (found by symbolic preprocessing), form a sparse Macaulay matrix.
+ * The rows of the reduced row echelon form whose leading monomial is not a leading monomial of the matrix are computed modulo word-sized primes and lifted to the rationals, where the result is verified exactly.
+ * These rows are added to the Groebner basis.
+ * The management of the critical pairs (including Buchberger's criteria) is shared with Buchberger.
+ *
+ * The reasons of a new polynomial are the union of the reasons of all generators occurring in the matrix it was computed from.
+ * The coefficients must be of type mpq_class.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+class F4 : public Buchberger<Polynomial, AddingPolicy>
+{
+	using Base = Buchberger<Polynomial, AddingPolicy>;
+	using Coeff = typename Polynomial::CoeffType;
+	static_assert(std::is_same<Coeff, mpq_class>::value, "F4 is only implemented for mpq_class coefficients.");
+public:
+	F4() = default;
+	F4(const F4& rhs) = default;
+	~F4() override = default;
+
+	void calculate(const std::list<Polynomial>& scheduledForAdding);
+protected:
+	/**
+	 * Computes the new polynomials from a batch of critical pairs.
+	 * @param pairs Critical pairs.
+	 * @return Polynomials to be added to the Groebner basis.
+	 */
+	std::vector<Polynomial> reduce(const std::vector<SPolPair>& pairs);
+};
+
+}
+
+#include "F4.tpp"
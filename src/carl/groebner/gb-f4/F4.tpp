@@ -0,0 +1,187 @@
+/**
+ * @file F4.tpp
+ * @ingroup gb
+ */
+#pragma once
+#include "F4.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace carl
+{
+
+/**
+ * Calculate the Groebner basis
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+void F4<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
+{
+	CARL_LOG_INFO("carl.gb.f4", "Calculate gb");
+	for(std::size_t i = 0; i < this->pGb->getGenerators().size(); ++i)
+	{
+		this->mGbElementsIndices.push_back(i);
+	}
+
+	bool foundGB = false;
+	for(const Polynomial& newPol : scheduledForAdding)
+	{
+		if(this->addToGb(newPol))
+		{
+			CARL_LOG_INFO("carl.gb.f4", "Added a constant polynomial.");
+			foundGB = true;
+			break;
+		}
+	}
+
+	while(!foundGB && !this->pCritPairs->empty())
+	{
+		// Normal strategy: take all pairs of the lowest degree.
+		auto degree = this->pCritPairs->top().mLcm->tdeg();
+		std::vector<SPolPair> pairs;
+		while(!this->pCritPairs->empty() && this->pCritPairs->top().mLcm->tdeg() == degree)
+		{
+			pairs.push_back(this->pCritPairs->pop());
+		}
+		CARL_LOG_DEBUG("carl.gb.f4", "Reducing " << pairs.size() << " pairs of degree " << degree);
+		for(const Polynomial& p : reduce(pairs))
+		{
+			if(this->addToGb(p))
+			{
+				CARL_LOG_INFO("carl.gb.f4", "Added a constant polynomial.");
+				foundGB = true;
+				break;
+			}
+		}
+	}
+	this->mGbElementsIndices.clear();
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+std::vector<Polynomial> F4<Polynomial, AddingPolicy>::reduce(const std::vector<SPolPair>& pairs)
+{
+	using namespace f4_detail;
+	const std::vector<Polynomial>& generators = this->pGb->getGenerators();
+
+	// Rows are multiples of generators, given as generator index and multiplier.
+	std::vector<std::pair<std::size_t, Monomial::Arg>> rows;
+	std::unordered_map<std::size_t, std::unordered_set<Monomial::Arg>> multipliers;
+	// All monomials occurring in the matrix, mapped to their columns later on.
+	std::unordered_map<Monomial::Arg, Column> columns;
+	std::vector<Monomial::Arg> todo;
+
+	auto addRow = [&](std::size_t index, const Monomial::Arg& multiplier) {
+		if (!multipliers[index].insert(multiplier).second) return;
+		rows.emplace_back(index, multiplier);
+		for (const auto& t: generators[index]) {
+			Monomial::Arg m = multiplier * t.monomial();
+			if (columns.emplace(m, NO_COLUMN).second) todo.push_back(m);
+		}
+	};
+	for (const auto& pair: pairs) {
+		// Both halves of the pair provide the lcm, hence it needs no reductor.
+		columns.emplace(pair.mLcm, NO_COLUMN);
+		for (std::size_t index: {pair.mP1, pair.mP2}) {
+			Monomial::Arg multiplier;
+			bool divisible = pair.mLcm->divide(generators[index].lmon(), multiplier);
+			assert(divisible);
+			(void)divisible;
+			addRow(index, multiplier);
+		}
+	}
+	// Symbolic preprocessing: add a reductor for every monomial in the matrix, if there is one.
+	while (!todo.empty()) {
+		Monomial::Arg m = todo.back();
+		todo.pop_back();
+		if (m == nullptr) continue;
+		auto divisor = this->pGb->getDivisor(Term<Coeff>(Coeff(1), m));
+		if (!divisor.success()) continue;
+		addRow(std::size_t(divisor.mDivisor - generators.data()), divisor.mFactor.monomial());
+	}
+
+	// Columns are sorted descending with respect to the monomial ordering.
+	std::vector<Monomial::Arg> monomials;
+	monomials.reserve(columns.size());
+	for (const auto& c: columns) monomials.push_back(c.first);
+	std::sort(monomials.begin(), monomials.end(), [](const Monomial::Arg& lhs, const Monomial::Arg& rhs){
+		return Polynomial::OrderedBy::less(rhs, lhs);
+	});
+	for (std::size_t i = 0; i < monomials.size(); ++i) columns[monomials[i]] = Column(i);
+	CARL_LOG_DEBUG("carl.gb.f4", "Matrix has " << rows.size() << " rows and " << monomials.size() << " columns");
+
+	std::vector<SparseRow<mpq_class>> matrix;
+	// One row for every leading column of the matrix
+	std::vector<const SparseRow<mpq_class>*> pivotRow(monomials.size(), nullptr);
+	BitVector reasons;
+	for (const auto& row: rows) {
+		const Polynomial& g = generators[row.first];
+		SparseRow<mpq_class> r;
+		for (auto t = g.rbegin(); t != g.rend(); ++t) {
+			r.columns.push_back(columns[row.second * t->monomial()]);
+			r.coeffs.push_back(t->coeff());
+		}
+		matrix.emplace_back(std::move(r));
+		reasons = reasons | g.getReasons();
+	}
+	for (const auto& r: matrix) {
+		if (pivotRow[r.lead()] == nullptr) pivotRow[r.lead()] = &r;
+	}
+
+	// The new rows of the reduced row echelon form are computed by multi-modular arithmetic.
+	EchelonFormLifting lifting;
+	std::vector<SparseRow<mpq_class>> echelon;
+	// Field requires p < 2^32.
+	WordPrimeFactory<32> primes;
+	while (true) {
+		Field F{primes.nextPrime()};
+		// Coefficients are converted once per generator.
+		std::unordered_map<std::size_t, std::vector<Residue>> images;
+		bool lucky = true;
+		for (const auto& row: rows) {
+			if (images.find(row.first) != images.end()) continue;
+			std::vector<Residue>& image = images[row.first];
+			const Polynomial& g = generators[row.first];
+			for (auto t = g.rbegin(); t != g.rend(); ++t) {
+				const mpz_class& num = carl::getNum(t->coeff());
+				const mpz_class& den = carl::getDenom(t->coeff());
+				if (mpz_divisible_ui_p(num.get_mpz_t(), F.p()) || mpz_divisible_ui_p(den.get_mpz_t(), F.p())) {
+					lucky = false;
+					break;
+				}
+				image.push_back(fromRational(F, num, den));
+			}
+			if (!lucky) break;
+		}
+		if (!lucky) continue;
+		std::vector<SparseRow<Residue>> modular;
+		for (std::size_t i = 0; i < rows.size(); ++i) {
+			SparseRow<Residue> r;
+			r.columns = matrix[i].columns;
+			r.coeffs = images[rows[i].first];
+			modular.emplace_back(std::move(r));
+		}
+		if (!lifting.add(F, reduceMatrix(F, std::move(modular), monomials.size()))) continue;
+		if (!lifting.reconstruct(echelon)) continue;
+		// The number of pivots is the rank modulo some prime, hence at most the rank over the rationals.
+		// Thus, if all rows of the matrix reduce to zero by the pivots, the pivots span the same space as the matrix.
+		std::vector<const SparseRow<mpq_class>*> pivots(pivotRow);
+		for (const auto& r: echelon) pivots[r.lead()] = &r;
+		std::vector<mpq_class> dense(monomials.size());
+		if (std::all_of(matrix.begin(), matrix.end(), [&](const auto& r){ return pivots[r.lead()] == &r || reducesToZero(r, pivots, dense); })) break;
+		CARL_LOG_DEBUG("carl.gb.f4", "Reconstruction modulo " << F.p() << " failed, using another prime");
+	}
+
+	std::vector<Polynomial> res;
+	for (const auto& r: echelon) {
+		typename Polynomial::TermsType terms;
+		for (std::size_t i = r.size(); i > 0; --i) {
+			terms.emplace_back(Coeff(r.coeffs[i - 1]), monomials[r.columns[i - 1]]);
+		}
+		res.emplace_back(std::move(terms), false, true);
+		res.back().setReasons(reasons);
+		CARL_LOG_DEBUG("carl.gb.f4", "New polynomial: " << res.back());
+	}
+	return res;
+}
+
+}
@@ -0,0 +1,273 @@
+/**
+ * @file F4Matrix.h
+ * @ingroup gb
+ *
+ * Sparse linear algebra for the F4 algorithm.
+ * The rows of a Macaulay matrix are reduced modulo word-sized primes.
+ * The images are combined by chinese remaindering and lifted to the rationals by rational reconstruction @cite GCL92, chapter 5.
+ */
+
+#pragma once
+
+#include "../../core/logging.h"
+#include "../../numbers/numbers.h"
+#include "../../numbers/ChineseRemainder.h"
+#include "../../numbers/GaloisField.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <vector>
+
+namespace carl {
+namespace f4_detail {
+
+	using Residue = std::uint64_t;
+	using Column = std::uint32_t;
+	constexpr Column NO_COLUMN = std::numeric_limits<Column>::max();
+
+	/// Arithmetic in Z_p for a prime p < 2^32.
+	using Field = GaloisField<uint>;
+
+	/**
+	 * Maps a rational number to Z_p.
+	 * @param num Numerator.
+	 * @param den Denominator, must not be divisible by p.
+	 */
+	inline Residue fromRational(const Field& F, const mpz_class& num, const mpz_class& den) {
+		return F.mul(F.fromInteger(num), F.inverse(F.fromInteger(den)));
+	}
+
+	/**
+	 * A sparse row with strictly increasing columns and nonzero coefficients.
+	 */
+	template<typename Coeff>
+	struct SparseRow {
+		std::vector<Column> columns;
+		std::vector<Coeff> coeffs;
+		Column lead() const {
+			return columns.empty() ? NO_COLUMN : columns.front();
+		}
+		std::size_t size() const {
+			return columns.size();
+		}
+	};
+
+	/**
+	 * The rows of the reduced row echelon form of a Macaulay matrix whose leading columns are not leading columns of the matrix.
+	 * The rows are ordered by their leading column and have leading coefficient one.
+	 */
+	template<typename Coeff>
+	struct EchelonForm {
+		std::vector<SparseRow<Coeff>> rows;
+		/// Leading columns of the rows.
+		std::vector<Column> pivots() const {
+			std::vector<Column> res;
+			for (const auto& r: rows) res.push_back(r.lead());
+			return res;
+		}
+	};
+
+	/**
+	 * Reduces a Macaulay matrix over Z_p as in @cite Faugere99.
+	 *
+	 * For every leading column of the matrix, one row with this leading column is taken as pivot as is.
+	 * All other rows are scattered into a dense accumulator and reduced by the pivots from left to right.
+	 * The nonzero results have a new leading column and become pivots as well.
+	 * Finally, the new pivots are reduced by all pivots, such that they coincide with the respective rows of the reduced row echelon form.
+	 * Only the new pivots are returned, as only those are needed for the Groebner basis.
+	 * @param F Field.
+	 * @param rows Rows, columns must be less than columns.
+	 * @param columns Number of columns.
+	 */
+	inline EchelonForm<Residue> reduceMatrix(const Field& F, std::vector<SparseRow<Residue>>&& rows, std::size_t columns) {
+		std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b){
+			if (a.lead() != b.lead()) return a.lead() < b.lead();
+			return a.size() < b.size();
+		});
+		constexpr std::size_t NO_ROW = std::numeric_limits<std::size_t>::max();
+		std::vector<std::size_t> pivotRow(columns, NO_ROW);
+		std::vector<SparseRow<Residue>> pivots;
+		std::vector<Residue> dense(columns, 0);
+
+		auto normalize = [&F](SparseRow<Residue>& row) {
+			if (row.coeffs.front() == 1) return;
+			Residue inv = F.inverse(row.coeffs.front());
+			for (auto& c: row.coeffs) c = F.mul(c, inv);
+		};
+		// Reduces the row in dense by all pivots in the columns [from, last] and returns the largest column touched.
+		auto reduceDense = [&](Column from, Column last) {
+			for (Column c = from; c <= last; ++c) {
+				if (dense[c] == 0 || pivotRow[c] == NO_ROW) continue;
+				const auto& pivot = pivots[pivotRow[c]];
+				Residue factor = dense[c];
+				for (std::size_t i = 0; i < pivot.size(); ++i) {
+					Residue& d = dense[pivot.columns[i]];
+					d = F.sub(d, F.mul(factor, pivot.coeffs[i]));
+				}
+				last = std::max(last, pivot.columns.back());
+			}
+			return last;
+		};
+		auto scatter = [&dense](const SparseRow<Residue>& row) {
+			for (std::size_t i = 0; i < row.size(); ++i) dense[row.columns[i]] = row.coeffs[i];
+		};
+		// Collects the nonzero entries of dense in [from, to] into a row and clears dense.
+		auto gather = [&dense](Column from, Column to) {
+			SparseRow<Residue> res;
+			for (Column c = from; c <= to; ++c) {
+				if (dense[c] == 0) continue;
+				res.columns.push_back(c);
+				res.coeffs.push_back(dense[c]);
+				dense[c] = 0;
+			}
+			return res;
+		};
+
+		std::vector<std::size_t> remaining;
+		for (std::size_t r = 0; r < rows.size(); ++r) {
+			auto& row = rows[r];
+			if (row.columns.empty()) continue;
+			if (pivotRow[row.lead()] == NO_ROW) {
+				normalize(row);
+				pivotRow[row.lead()] = pivots.size();
+				pivots.emplace_back(std::move(row));
+			} else {
+				remaining.push_back(r);
+			}
+		}
+		std::size_t firstNew = pivots.size();
+		for (std::size_t r: remaining) {
+			const auto& row = rows[r];
+			scatter(row);
+			Column last = reduceDense(row.lead(), row.columns.back());
+			Column lead = row.lead();
+			while (lead <= last && dense[lead] == 0) ++lead;
+			if (lead > last) continue;
+			SparseRow<Residue> reduced = gather(lead, last);
+			normalize(reduced);
+			pivotRow[lead] = pivots.size();
+			pivots.emplace_back(std::move(reduced));
+		}
+
+		// reduce the new pivots by the pivots found later on
+		EchelonForm<Residue> res;
+		for (std::size_t i = firstNew; i < pivots.size(); ++i) {
+			auto& row = pivots[i];
+			scatter(row);
+			Column last = reduceDense(row.lead() + 1, row.columns.back());
+			res.rows.emplace_back(gather(row.lead(), last));
+		}
+		std::sort(res.rows.begin(), res.rows.end(), [](const auto& a, const auto& b){ return a.lead() < b.lead(); });
+		return res;
+	}
+
+	/**
+	 * Combines reduced row echelon forms modulo different primes.
+	 * Only images with the same pivots are combined: an image with more pivots, or lexicographically smaller pivots with the same number, replaces all previous images as the previous primes were unlucky.
+	 */
+	class EchelonFormLifting {
+		std::vector<Column> mPivots;
+		std::vector<SparseRow<mpz_class>> mRows;
+		mpz_class mModulus = 0;
+	public:
+		/**
+		 * Adds an image modulo F.p().
+		 * @return If the image was used.
+		 */
+		bool add(const Field& F, EchelonForm<Residue>&& image) {
+			std::vector<Column> pivots = image.pivots();
+			if (!carl::isZero(mModulus)) {
+				if (pivots.size() < mPivots.size()) return false;
+				if (pivots.size() == mPivots.size() && pivots > mPivots) return false;
+				if (pivots != mPivots) {
+					CARL_LOG_DEBUG("carl.gb.f4", "Discarding images of unlucky primes");
+					mModulus = 0;
+				}
+			}
+			if (carl::isZero(mModulus)) {
+				mPivots = std::move(pivots);
+				mRows.clear();
+				for (auto& r: image.rows) {
+					SparseRow<mpz_class> row;
+					row.columns = std::move(r.columns);
+					for (Residue c: r.coeffs) row.coeffs.emplace_back(static_cast<unsigned long>(c));
+					mRows.emplace_back(std::move(row));
+				}
+				mModulus = static_cast<unsigned long>(F.p());
+				return true;
+			}
+			ChineseRemainder crt(F, mModulus, false);
+			for (std::size_t i = 0; i < mRows.size(); ++i) {
+				const auto& lhs = mRows[i];
+				const auto& rhs = image.rows[i];
+				SparseRow<mpz_class> row;
+				std::size_t l = 0;
+				std::size_t r = 0;
+				while (l < lhs.size() || r < rhs.size()) {
+					Column c = std::min(l < lhs.size() ? lhs.columns[l] : NO_COLUMN, r < rhs.size() ? rhs.columns[r] : NO_COLUMN);
+					mpz_class coeff = (l < lhs.size() && lhs.columns[l] == c) ? lhs.coeffs[l++] : mpz_class(0);
+					Residue val = (r < rhs.size() && rhs.columns[r] == c) ? rhs.coeffs[r++] : 0;
+					crt.lift(coeff, val);
+					row.columns.push_back(c);
+					row.coeffs.push_back(std::move(coeff));
+				}
+				mRows[i] = std::move(row);
+			}
+			mModulus = crt.modulus();
+			return true;
+		}
+
+		/**
+		 * Lifts the combined images to the rationals.
+		 * @param res Rows over the rationals.
+		 * @return If all coefficients could be reconstructed.
+		 */
+		bool reconstruct(std::vector<SparseRow<mpq_class>>& res) const {
+			res.clear();
+			mpz_class bound = mModulus / 2;
+			mpz_sqrt(bound.get_mpz_t(), bound.get_mpz_t());
+			for (const auto& row: mRows) {
+				SparseRow<mpq_class> r;
+				for (std::size_t i = 0; i < row.size(); ++i) {
+					if (carl::isZero(row.coeffs[i])) continue;
+					mpq_class q;
+					if (!rationalReconstruction(row.coeffs[i], mModulus, bound, q)) return false;
+					r.columns.push_back(row.columns[i]);
+					r.coeffs.push_back(q);
+				}
+				res.emplace_back(std::move(r));
+			}
+			return true;
+		}
+	};
+
+	/**
+	 * Checks whether the given row reduces to zero by the given pivots over the rationals.
+	 * @param row Row to be reduced.
+	 * @param pivotRow Maps the columns to the pivot with this leading column, or to nullptr.
+	 * @param dense Accumulator with an entry for every column, must be zero and is zero afterwards.
+	 */
+	inline bool reducesToZero(const SparseRow<mpq_class>& row, const std::vector<const SparseRow<mpq_class>*>& pivotRow, std::vector<mpq_class>& dense) {
+		for (std::size_t i = 0; i < row.size(); ++i) dense[row.columns[i]] = row.coeffs[i];
+		bool zero = true;
+		Column last = row.columns.back();
+		for (Column c = row.lead(); c <= last; ++c) {
+			if (carl::isZero(dense[c])) continue;
+			const auto* pivot = pivotRow[c];
+			if (pivot == nullptr) {
+				zero = false;
+				dense[c] = 0;
+				continue;
+			}
+			mpq_class factor = dense[c] / pivot->coeffs.front();
+			for (std::size_t i = 0; i < pivot->size(); ++i) {
+				dense[pivot->columns[i]] -= factor * pivot->coeffs[i];
+			}
+			last = std::max(last, pivot->columns.back());
+		}
+		return zero;
+	}
+}
+}
@@ -0,0 +1,262 @@
+/**
+ * @file:   IdealDSDivMask.h
+ *
+ */
+
+#pragma once
+
+#include "../../core/Term.h"
+#include "../../core/VariablePool.h"
+#include "../DivisionLookupResult.h"
+#include "PolynomialSorts.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <unordered_set>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * An ideal datastructure that finds divisors of a term in sublinear time.
+ *
+ * The leading monomials of the generators are stored in the leaves of a kd-tree.
+ * Every inner node splits its monomials by the exponent of a single variable: the left child contains the monomials with an exponent of at most the split value, the right child all others.
+ * As a divisor of t has an exponent of at most the exponent of t in every variable, the right child can be skipped whenever the exponent of t is at most the split value.
+ *
+ * Within the leaves, every monomial is stored with a short divisibility mask @cite Bachmann98:
+ * Every variable is assigned to one of 16 slots of four bits, and the i'th bit is set if the exponent is larger than i.
+ * If m divides t, the mask of m is a subset of the mask of t, hence most non-divisors are rejected by a single bitwise operation.
+ *
+ * Like IdealDatastructureVector, the smallest divisor with respect to the order is returned, and eliminated generators are removed lazily.
+ * @ingroup gb
+ */
+template<class Polynomial>
+class IdealDatastructureDivMask
+{
+public:
+	using Mask = std::uint64_t;
+
+	IdealDatastructureDivMask(const std::vector<Polynomial>& generators, const std::unordered_set<size_t>& eliminated, const sortByLeadingTerm<Polynomial>& order)
+	: mGenerators(generators), mEliminated(eliminated), mOrder(order), mNodes(1)
+	{
+	}
+
+	IdealDatastructureDivMask(const IdealDatastructureDivMask& id)
+	: mGenerators(id.mGenerators), mEliminated(id.mEliminated), mOrder(id.mOrder), mNodes(id.mNodes)
+	{
+	}
+
+	virtual ~IdealDatastructureDivMask() = default;
+
+	/**
+	 * Computes the divisibility mask of a monomial.
+	 * @param m Monomial.
+	 * @return Mask such that mask(m) & ~mask(t) == 0 if m divides t.
+	 */
+	static Mask divMask(const Monomial::Arg& m)
+	{
+		Mask res = 0;
+		if (!m) return res;
+		for (const auto& e: m->exponents())
+		{
+			std::size_t slot = e.first.id() % SLOTS;
+			res |= ((Mask(1) << std::min<uint>(e.second, BITS_PER_SLOT)) - 1) << (slot * BITS_PER_SLOT);
+		}
+		return res;
+	}
+
+	/**
+	 * Should be called whenever an generator is added
+	 * @param fIndex
+	 */
+	void addGenerator(size_t fIndex) const
+	{
+		const Monomial::Arg& lm = mGenerators[fIndex].lmon();
+		std::size_t node = 0;
+		while (!mNodes[node].isLeaf())
+		{
+			node = childFor(mNodes[node], lm);
+		}
+		mNodes[node].entries.push_back(Entry{divMask(lm), fIndex});
+		if (mNodes[node].entries.size() > LEAF_SIZE) split(node);
+	}
+
+	/**
+	 *
+	 * @param t
+	 * @return A divisionresult [divisor, factor].
+	 *
+	 */
+	DivisionLookupResult<Polynomial> getDivisor(const Term<typename Polynomial::CoeffType>& t) const
+	{
+		const Monomial::Arg& m = t.monomial();
+		Mask complement = ~divMask(m);
+		std::size_t best = NO_INDEX;
+		std::vector<std::size_t> stack({0});
+		while (!stack.empty())
+		{
+			Node& node = mNodes[stack.back()];
+			stack.pop_back();
+			if (!node.isLeaf())
+			{
+				stack.push_back(node.left);
+				if (exponent(m, node.variable) > node.value) stack.push_back(node.right);
+				continue;
+			}
+			auto& entries = node.entries;
+			for (auto it = entries.begin(); it != entries.end();)
+			{
+				if ((it->mask & complement) != 0 || !divides(mGenerators[it->index].lmon(), m))
+				{
+					++it;
+					continue;
+				}
+				// The possible divisor might not be in the ideal anymore.
+				if (mEliminated.count(it->index) == 1)
+				{
+					it = entries.erase(it);
+					continue;
+				}
+				if (best == NO_INDEX || mOrder(it->index, best)) best = it->index;
+				++it;
+			}
+		}
+		if (best == NO_INDEX) return DivisionLookupResult<Polynomial>();
+		Term<typename Polynomial::CoeffType> divres;
+		bool divided = t.divide(mGenerators[best].lterm(), divres);
+		assert(divided);
+		(void)divided;
+		//To eliminate, we have to negate the factor.
+		divres.negate();
+		return DivisionLookupResult<Polynomial>(&mGenerators[best], divres);
+	}
+
+	/**
+	 * Should be called if the generator set is reset.
+	 */
+	void reset()
+	{
+		mNodes.assign(1, Node());
+		for(size_t i = 0; i < mGenerators.size(); ++i)
+		{
+			if (mEliminated.count(i) == 0) addGenerator(i);
+		}
+	}
+
+private:
+	/// Number of slots in a mask.
+	static constexpr std::size_t SLOTS = 16;
+	/// Number of bits of each slot.
+	static constexpr uint BITS_PER_SLOT = 4;
+	/// Leaves with more entries are split, if possible.
+	static constexpr std::size_t LEAF_SIZE = 8;
+	static constexpr std::size_t NO_INDEX = std::numeric_limits<std::size_t>::max();
+
+	struct Entry
+	{
+		Mask mask;
+		std::size_t index;
+	};
+	struct Node
+	{
+		/// Split variable, or NO_VARIABLE for leaves.
+		Variable variable = Variable::NO_VARIABLE;
+		/// Monomials with an exponent of at most this value are in the left child.
+		uint value = 0;
+		std::size_t left = 0;
+		std::size_t right = 0;
+		std::vector<Entry> entries;
+
+		bool isLeaf() const
+		{
+			return variable == Variable::NO_VARIABLE;
+		}
+	};
+
+	static uint exponent(const Monomial::Arg& m, Variable v)
+	{
+		return m ? m->exponentOfVariable(v) : 0;
+	}
+	static bool divides(const Monomial::Arg& divisor, const Monomial::Arg& m)
+	{
+		if (!m) return !divisor;
+		return m->divisible(divisor);
+	}
+	std::size_t childFor(const Node& node, const Monomial::Arg& m) const
+	{
+		return exponent(m, node.variable) <= node.value ? node.left : node.right;
+	}
+
+	/**
+	 * Splits a leaf by the variable whose exponents have the largest range at the median exponent.
+	 * @param node Leaf.
+	 */
+	void split(std::size_t node) const
+	{
+		std::vector<Entry> entries = std::move(mNodes[node].entries);
+		Variable variable = Variable::NO_VARIABLE;
+		uint range = 0;
+		for (const auto& e: entries)
+		{
+			const Monomial::Arg& lm = mGenerators[e.index].lmon();
+			if (!lm) continue;
+			for (const auto& v: lm->exponents())
+			{
+				uint min = v.second;
+				uint max = v.second;
+				for (const auto& f: entries)
+				{
+					uint exp = exponent(mGenerators[f.index].lmon(), v.first);
+					min = std::min(min, exp);
+					max = std::max(max, exp);
+				}
+				if (max - min > range)
+				{
+					variable = v.first;
+					range = max - min;
+				}
+			}
+		}
+		if (variable == Variable::NO_VARIABLE)
+		{
+			// All leading monomials are equal.
+			mNodes[node].entries = std::move(entries);
+			return;
+		}
+		std::vector<uint> exps;
+		for (const auto& e: entries) exps.push_back(exponent(mGenerators[e.index].lmon(), variable));
+		std::nth_element(exps.begin(), exps.begin() + std::ptrdiff_t((exps.size() - 1) / 2), exps.end());
+		uint value = exps[(exps.size() - 1) / 2];
+		uint max = *std::max_element(exps.begin(), exps.end());
+		if (value >= max) value = max - 1;
+
+		std::size_t left = mNodes.size();
+		std::size_t right = left + 1;
+		mNodes.resize(mNodes.size() + 2);
+		Node& n = mNodes[node];
+		n.variable = variable;
+		n.value = value;
+		n.left = left;
+		n.right = right;
+		for (const auto& e: entries)
+		{
+			mNodes[childFor(n, mGenerators[e.index].lmon())].entries.push_back(e);
+		}
+	}
+
+	/// A reference to the generators in the ideal
+	const std::vector<Polynomial>& mGenerators;
+	/// A reference to the indices of eliminated generators
+	const std::unordered_set<size_t>& mEliminated;
+	/// A object which orders the generators according their leading terms, given their indices
+	const sortByLeadingTerm<Polynomial>& mOrder;
+	/// Nodes of the kd-tree, the root is the first node.
+	/// Has to be mutable so we can remove eliminated generators found while looking for a divisor.
+	mutable std::vector<Node> mNodes;
+};
+
+}
@@ -0,0 +1,308 @@
+/**
+ * @file BatchIntervalEvaluation.h
+ */
+
+#pragma once
+
+#include "Interval.h"
+#include "../core/CompiledRationalFunction.h"
+#include "../core/RationalFunction.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Evaluates a polynomial with double intervals over many boxes at once.
+ *
+ * The polynomial is compiled once to the straight-line program of CompiledRationalFunction.
+ * The boxes are given as structure of arrays, that is one column of lower bounds and one column of upper bounds per variable, and are processed in blocks.
+ * Every instruction is executed for the whole block by a branch-free loop over plain arrays of doubles, which the compiler can vectorize.
+ *
+ * The rounding mode is set to upward rounding only once per call of evaluate().
+ * Lower bounds are stored negated, such that rounding them upward rounds the actual lower bounds downward ("opposite trick"), as in boost's rounded_arith_opp.
+ * Unless compiled with -frounding-math, the compiler assumes rounding to nearest and may rewrite (-x) * y to -(x * y), which is rounded in the wrong direction.
+ * Negated factors are therefore stored and hidden from the optimizer by hide() before they are multiplied.
+ * Unbounded boxes are given by infinite bounds. All bounds of the results are weak, and infinite bounds denote unboundedness.
+ * The results coincide with the evaluation of the same program with Interval<double>.
+ * @ingroup interval
+ */
+template<typename Pol>
+class BatchIntervalEvaluation
+{
+public:
+	/**
+	 * Compiles a polynomial.
+	 * @param p Polynomial.
+	 * @param variables Variable order of the boxes. If empty, the variables of p in ascending order are used.
+	 */
+	explicit BatchIntervalEvaluation(const Pol& p, const std::vector<Variable>& variables = {})
+	: mFunction(RationalFunction<Pol>(p), variables)
+	{
+		assert(!mFunction.hasDenominator());
+		for (const auto& c: mFunction.constants())
+		{
+			Interval<double> i(c);
+			mNegatedLowerConstants.push_back(-i.lower());
+			mUpperConstants.push_back(i.upper());
+		}
+	}
+
+	/**
+	 * @return Variable order of the boxes.
+	 */
+	const std::vector<Variable>& variables() const
+	{
+		return mFunction.variables();
+	}
+
+	/**
+	 * Evaluates the polynomial on many boxes.
+	 * The i'th box is given by lower[v][i] and upper[v][i] for every variable v, in the order of variables().
+	 * @param lower Lower bounds of the variables.
+	 * @param upper Upper bounds of the variables.
+	 * @param resLower Lower bounds of the results.
+	 * @param resUpper Upper bounds of the results.
+	 */
+	void evaluate(const std::vector<std::vector<double>>& lower, const std::vector<std::vector<double>>& upper, std::vector<double>& resLower, std::vector<double>& resUpper) const
+	{
+		assert(lower.size() == variables().size());
+		assert(upper.size() == variables().size());
+		std::size_t count = lower.empty() ? 1 : lower.front().size();
+		resLower.resize(count);
+		resUpper.resize(count);
+		const auto& program = mFunction.program();
+		std::vector<double> negLow(program.size() * BLOCK_SIZE);
+		std::vector<double> up(program.size() * BLOCK_SIZE);
+		std::vector<double> scratch(3 * BLOCK_SIZE);
+
+		Rounding rounding;
+		for (std::size_t offset = 0; offset < count; offset += BLOCK_SIZE)
+		{
+			const std::size_t lanes = std::min(BLOCK_SIZE, count - offset);
+			for (std::size_t i = 0; i < program.size(); ++i)
+			{
+				const auto& in = program[i];
+				double* nl = negLow.data() + i * BLOCK_SIZE;
+				double* u = up.data() + i * BLOCK_SIZE;
+				// Operands of POW, ADD and MUL.
+				const double* nla = negLow.data() + std::min(in.lhs, i) * BLOCK_SIZE;
+				const double* ua = up.data() + std::min(in.lhs, i) * BLOCK_SIZE;
+				const double* nlb = negLow.data() + std::min(in.rhs, i) * BLOCK_SIZE;
+				const double* ub = up.data() + std::min(in.rhs, i) * BLOCK_SIZE;
+				switch (in.op)
+				{
+					case Opcode::CONSTANT:
+						std::fill(nl, nl + lanes, mNegatedLowerConstants[in.lhs]);
+						std::fill(u, u + lanes, mUpperConstants[in.lhs]);
+						break;
+					case Opcode::VARIABLE:
+					{
+						const double* lo = lower[in.lhs].data() + offset;
+						const double* hi = upper[in.lhs].data() + offset;
+						for (std::size_t l = 0; l < lanes; ++l)
+						{
+							nl[l] = -lo[l];
+							u[l] = hi[l];
+						}
+						break;
+					}
+					case Opcode::POW:
+						power(nla, ua, in.rhs, nl, u, lanes, scratch.data());
+						break;
+					case Opcode::ADD:
+						for (std::size_t l = 0; l < lanes; ++l)
+						{
+							nl[l] = nla[l] + nlb[l];
+							u[l] = ua[l] + ub[l];
+						}
+						break;
+					case Opcode::MUL:
+						multiply(nla, ua, nlb, ub, nl, u, lanes, scratch.data());
+						break;
+				}
+			}
+			const double* nl = negLow.data() + mFunction.nominatorIndex() * BLOCK_SIZE;
+			const double* u = up.data() + mFunction.nominatorIndex() * BLOCK_SIZE;
+			for (std::size_t l = 0; l < lanes; ++l)
+			{
+				resLower[offset + l] = -nl[l];
+				resUpper[offset + l] = u[l];
+			}
+		}
+	}
+
+	/**
+	 * Evaluates the polynomial on many boxes.
+	 * @param lower Lower bounds of the variables.
+	 * @param upper Upper bounds of the variables.
+	 * @return Results as intervals.
+	 */
+	std::vector<Interval<double>> evaluate(const std::vector<std::vector<double>>& lower, const std::vector<std::vector<double>>& upper) const
+	{
+		std::vector<double> resLower;
+		std::vector<double> resUpper;
+		evaluate(lower, upper, resLower, resUpper);
+		std::vector<Interval<double>> res;
+		res.reserve(resLower.size());
+		for (std::size_t i = 0; i < resLower.size(); ++i)
+		{
+			BoundType lbt = std::isinf(resLower[i]) ? BoundType::INFTY : BoundType::WEAK;
+			BoundType ubt = std::isinf(resUpper[i]) ? BoundType::INFTY : BoundType::WEAK;
+			res.emplace_back(resLower[i], lbt, resUpper[i], ubt);
+		}
+		return res;
+	}
+
+private:
+	using Opcode = typename CompiledRationalFunction<Pol>::Opcode;
+	/// Sets upward rounding on construction and restores the previous rounding mode on destruction.
+	using Rounding = boost::numeric::interval_lib::save_state<boost::numeric::interval_lib::rounded_arith_opp<double>>;
+
+	/// Number of boxes evaluated at once.
+	static constexpr std::size_t BLOCK_SIZE = 64;
+
+	CompiledRationalFunction<Pol> mFunction;
+	/// Enclosures of the constants of the program.
+	std::vector<double> mNegatedLowerConstants;
+	std::vector<double> mUpperConstants;
+
+	/**
+	 * Makes the optimizer forget the contents of the memory data points to.
+	 * Values loaded from data afterwards are unrelated to the values that were stored, for example to the negations of other operands.
+	 */
+	static void hide(double* data)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r"(data) : "memory");
+#else
+		static double* volatile escape;
+		escape = data;
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+	}
+
+	/**
+	 * A product of bounds, rounded upward.
+	 * The product of zero and an infinite bound is undefined, and is soundly replaced by infinity.
+	 */
+	static double mulUp(double a, double b)
+	{
+		double res = a * b;
+		return res != res ? std::numeric_limits<double>::infinity() : res;
+	}
+
+	/**
+	 * Multiplies [a,b] and [c,d].
+	 * The bounds of the product are the minimum and the maximum of a*c, a*d, b*c and b*d.
+	 * If all bounds are finite, no product is undefined and a cheaper loop is used.
+	 * The scratch memory holds the negated operands a, c and -b for 3 * BLOCK_SIZE lanes.
+	 */
+	static void multiply(const double* nla, const double* ua, const double* nlb, const double* ub, double* nl, double* u, std::size_t lanes, double* scratch)
+	{
+		double* la = scratch;
+		double* lb = scratch + BLOCK_SIZE;
+		double* nua = scratch + 2 * BLOCK_SIZE;
+		for (std::size_t l = 0; l < lanes; ++l)
+		{
+			la[l] = -nla[l];
+			lb[l] = -nlb[l];
+			nua[l] = -ua[l];
+		}
+		hide(scratch);
+		double max = 0;
+		for (std::size_t l = 0; l < lanes; ++l)
+		{
+			max = std::max(max, std::max(std::max(std::abs(nla[l]), std::abs(ua[l])), std::max(std::abs(nlb[l]), std::abs(ub[l]))));
+		}
+		if (max < std::numeric_limits<double>::infinity())
+		{
+			multiply(nla, ua, nlb, ub, la, lb, nua, nl, u, lanes, [](double a, double b){ return a * b; });
+		}
+		else
+		{
+			multiply(nla, ua, nlb, ub, la, lb, nua, nl, u, lanes, mulUp);
+		}
+	}
+	template<typename Mul>
+	static void multiply(const double* nla, const double* ua, const double* nlb, const double* ub, const double* la, const double* lb, const double* nua, double* nl, double* u, std::size_t lanes, Mul mul)
+	{
+		for (std::size_t l = 0; l < lanes; ++l)
+		{
+			// The operands are loaded first, otherwise the loop is not vectorized due to possible aliasing.
+			// [a,b] and [c,d] with a = -na and c = -nc
+			double na = nla[l];
+			double a = la[l];
+			double b = ua[l];
+			double nb = nua[l];
+			double nc = nlb[l];
+			double c = lb[l];
+			double d = ub[l];
+			double upper = std::max(std::max(mul(na, nc), mul(a, d)), std::max(mul(b, c), mul(b, d)));
+			double negLower = std::max(std::max(mul(a, nc), mul(na, d)), std::max(mul(b, nc), mul(nb, d)));
+			u[l] = upper;
+			nl[l] = negLower;
+		}
+	}
+
+	/**
+	 * Computes [a,b]^exp.
+	 * With m = min(|a|,|b|) and M = max(|a|,|b|), even powers are [m^exp, M^exp] or [0, M^exp] if zero is contained.
+	 * Odd powers are monotone, hence [a^exp, b^exp].
+	 * At most one bound is rounded downward, its negated base is stored in the scratch memory.
+	 */
+	static void power(const double* nla, const double* ua, std::size_t exp, double* nl, double* u, std::size_t lanes, double* scratch)
+	{
+		for (std::size_t l = 0; l < lanes; ++l)
+		{
+			scratch[l] = -downwardBase(-nla[l], ua[l], exp);
+		}
+		hide(scratch);
+		for (std::size_t l = 0; l < lanes; ++l)
+		{
+			double a = -nla[l];
+			double b = ua[l];
+			double base = downwardBase(a, b, exp);
+			double negatedBase = scratch[l];
+			if (exp % 2 == 0)
+			{
+				double max = std::max(std::abs(a), std::abs(b));
+				nl[l] = (a <= 0 && b >= 0) ? 0.0 : negatedPowDown(negatedBase, base, exp);
+				u[l] = powUp(max, exp);
+			}
+			else
+			{
+				nl[l] = a >= 0 ? negatedPowDown(negatedBase, base, exp) : powUp(-a, exp);
+				u[l] = b >= 0 ? powUp(b, exp) : negatedPowDown(negatedBase, base, exp);
+			}
+		}
+	}
+	/// The base of the bound of [a,b]^exp that is rounded downward, if any.
+	static double downwardBase(double a, double b, std::size_t exp)
+	{
+		if (exp % 2 == 0) return std::min(std::abs(a), std::abs(b));
+		return a >= 0 ? a : -b;
+	}
+	/// x^exp rounded upward, for x >= 0.
+	static double powUp(double x, std::size_t exp)
+	{
+		double res = x;
+		for (std::size_t i = 1; i < exp; ++i) res *= x;
+		return res;
+	}
+	/// -(x^exp rounded downward), for x >= 0, where negatedX = -x.
+	static double negatedPowDown(double negatedX, double x, std::size_t exp)
+	{
+		double res = negatedX;
+		for (std::size_t i = 1; i < exp; ++i) res *= x;
+		return res;
+	}
+};
+
+}
@@ -32,7 +32,9 @@
 #include "../util/SFINAE.h"
 #include "BoundType.h"
 #include "checking.h"
+#include "config.h"
 #include "rounding.h"
+#include "rounding/rounded_arith_eft.h"
 
 CLANG_WARNING_DISABLE("-Wunused-parameter")
 CLANG_WARNING_DISABLE("-Wunused-local-typedef")
@@ -83,7 +85,11 @@ namespace carl
     template<typename Interval>
     struct policies<double, Interval>
     {
+#ifdef INTERVAL_EFT_ROUNDING
+        using roundingP = carl::rounded_arith_eft;
+#else
         using roundingP = boost::numeric::interval_lib::save_state<boost::numeric::interval_lib::rounded_transc_std<double> >; // TODO: change it to boost::numeric::interval_lib::rounded_transc_opp, if new boost release patches the bug with clang
+#endif
         using checkingP = boost::numeric::interval_lib::checking_no_nan<double, boost::numeric::interval_lib::checking_no_nan<double> >;
 		static void sanitize(Interval& n) {
 			if (std::isinf(n.lower())) {
@@ -0,0 +1,240 @@
+#pragma once
+
+#include "../core/MultivariatePolynomial.h"
+#include "../core/polynomialfunctions/Derivative.h"
+#include "../numbers/numbers.h"
+#include "Interval.h"
+#include "IntervalEvaluation.h"
+#include "sampling.h"
+#include "set_theory.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+namespace carl {
+namespace contractor {
+
+/**
+ * Contracts a box with respect to a square system of polynomial equations p_1 = ... = p_n = 0 in the variables x_1, ..., x_n.
+ *
+ * In contrast to Contractor, which solves a single constraint for a single variable, all equations and variables are considered at once.
+ * The interval Jacobian J of the system is evaluated on the box X, and the system is linearized around the midpoint m of X.
+ * The linearization is preconditioned with an approximate inverse Y of the midpoint of J, which is computed with doubles.
+ * Any Y yields a sound contraction, the quality of Y only affects how much the box is contracted.
+ * Every common root in X is contained in the contracted box, and an empty box proves that there is no common root in X.
+ *
+ * Two operators are available:
+ * - The Krawczyk operator K(X) = m - Y f(m) + (I - YJ)(X - m) @cite Krawczyk69.
+ * - The preconditioned interval Newton operator, which solves (YJ)(X - m) = -Y f(m) by one sweep of interval Gauss-Seidel @cite Hansen81.
+ *   It uses the contracted intervals immediately and usually contracts more than the Krawczyk operator.
+ *
+ * Near a regular root, the width of the box shrinks quadratically when the contraction is iterated.
+ * Only bounded boxes are contracted.
+ */
+template<typename Polynomial, typename Number = double>
+class NewtonContractor {
+public:
+	enum class Operator { KRAWCZYK, GAUSS_SEIDEL };
+	using Box = std::map<Variable, Interval<Number>>;
+private:
+	std::vector<Polynomial> mPolynomials;
+	std::vector<Variable> mVariables;
+	/// mJacobian[i][j] is the derivative of the i'th polynomial with respect to the j'th variable.
+	std::vector<std::vector<Polynomial>> mJacobian;
+	Operator mOperator;
+
+	/// Matrix of doubles, stored row by row.
+	using Matrix = std::vector<std::vector<double>>;
+
+	/**
+	 * Inverts a matrix by Gauss-Jordan elimination with partial pivoting.
+	 * @return false if the matrix is (numerically) singular.
+	 */
+	static bool invert(Matrix a, Matrix& inverse) {
+		std::size_t n = a.size();
+		inverse.assign(n, std::vector<double>(n, 0.0));
+		for (std::size_t i = 0; i < n; ++i) inverse[i][i] = 1.0;
+		double norm = 0;
+		for (const auto& row: a) {
+			for (double d: row) norm = std::max(norm, std::abs(d));
+		}
+		for (std::size_t col = 0; col < n; ++col) {
+			std::size_t pivot = col;
+			for (std::size_t row = col + 1; row < n; ++row) {
+				if (std::abs(a[row][col]) > std::abs(a[pivot][col])) pivot = row;
+			}
+			if (!(std::abs(a[pivot][col]) > norm * 1e-14)) return false;
+			std::swap(a[pivot], a[col]);
+			std::swap(inverse[pivot], inverse[col]);
+			double factor = 1.0 / a[col][col];
+			for (std::size_t j = 0; j < n; ++j) {
+				a[col][j] *= factor;
+				inverse[col][j] *= factor;
+			}
+			for (std::size_t row = 0; row < n; ++row) {
+				if (row == col || a[row][col] == 0) continue;
+				double f = a[row][col];
+				for (std::size_t j = 0; j < n; ++j) {
+					a[row][j] -= f * a[col][j];
+					inverse[row][j] -= f * inverse[col][j];
+				}
+			}
+		}
+		return true;
+	}
+
+	/// Smallest interval with weak bounds that contains both intervals, which are not empty.
+	static Interval<Number> hull(const Interval<Number>& lhs, const Interval<Number>& rhs) {
+		BoundType lbt = (lhs.lowerBoundType() == BoundType::INFTY || rhs.lowerBoundType() == BoundType::INFTY) ? BoundType::INFTY : BoundType::WEAK;
+		BoundType ubt = (lhs.upperBoundType() == BoundType::INFTY || rhs.upperBoundType() == BoundType::INFTY) ? BoundType::INFTY : BoundType::WEAK;
+		return Interval<Number>(std::min(lhs.lower(), rhs.lower()), lbt, std::max(lhs.upper(), rhs.upper()), ubt);
+	}
+
+	/**
+	 * Performs one contraction.
+	 * @return false if the box contains no common root.
+	 */
+	bool step(Box& box) const {
+		std::size_t n = mVariables.size();
+		std::vector<Interval<Number>> x;
+		Box midpoint;
+		std::vector<Number> m;
+		for (auto v: mVariables) {
+			assert(box.find(v) != box.end());
+			const auto& i = box.find(v)->second;
+			if (i.isEmpty()) return false;
+			if (i.isUnbounded()) {
+				CARL_LOG_DEBUG("carl.contractor", "Not contracting unbounded " << v << " in " << i);
+				return true;
+			}
+			x.emplace_back(i);
+			m.emplace_back(carl::center(i));
+			midpoint.emplace(v, Interval<Number>(m.back()));
+		}
+		// The variables of the system are replaced by their midpoints, other variables keep their intervals.
+		for (const auto& entry: box) midpoint.emplace(entry);
+
+		std::vector<std::vector<Interval<Number>>> jacobian(n);
+		Matrix center(n, std::vector<double>(n));
+		for (std::size_t i = 0; i < n; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				jacobian[i].emplace_back(IntervalEvaluation::evaluate(mJacobian[i][j], box));
+				if (jacobian[i][j].isUnbounded()) return true;
+				center[i][j] = carl::toDouble(carl::center(jacobian[i][j]));
+			}
+		}
+		Matrix inverse;
+		if (!invert(center, inverse)) {
+			CARL_LOG_DEBUG("carl.contractor", "Midpoint of the Jacobian is singular.");
+			return true;
+		}
+		std::vector<Interval<Number>> values;
+		for (const auto& p: mPolynomials) {
+			values.emplace_back(IntervalEvaluation::evaluate(p, midpoint));
+		}
+
+		// A = YJ and b = -Y f(m)
+		std::vector<std::vector<Interval<Number>>> a(n, std::vector<Interval<Number>>(n, Interval<Number>(0)));
+		std::vector<Interval<Number>> b(n, Interval<Number>(0));
+		for (std::size_t i = 0; i < n; ++i) {
+			for (std::size_t k = 0; k < n; ++k) {
+				if (inverse[i][k] == 0) continue;
+				Number y(inverse[i][k]);
+				for (std::size_t j = 0; j < n; ++j) {
+					a[i][j] += jacobian[k][j] * y;
+				}
+				b[i] -= values[k] * y;
+			}
+		}
+
+		std::vector<Interval<Number>> offset;
+		for (std::size_t j = 0; j < n; ++j) offset.emplace_back(x[j] - m[j]);
+		for (std::size_t i = 0; i < n; ++i) {
+			Interval<Number> res;
+			if (mOperator == Operator::KRAWCZYK) {
+				res = b[i];
+				for (std::size_t j = 0; j < n; ++j) {
+					Interval<Number> coeff = (i == j) ? Interval<Number>(1) - a[i][j] : -a[i][j];
+					res += coeff * offset[j];
+				}
+				res = set_intersection(x[i], res + m[i]);
+			} else {
+				Interval<Number> numerator = b[i];
+				for (std::size_t j = 0; j < n; ++j) {
+					if (i != j) numerator -= a[i][j] * offset[j];
+				}
+				Interval<Number> resA;
+				Interval<Number> resB;
+				if (numerator.div_ext(a[i][i], resA, resB)) {
+					resA = set_intersection(x[i], resA + m[i]);
+					resB = set_intersection(x[i], resB + m[i]);
+					if (resA.isEmpty()) res = resB;
+					else if (resB.isEmpty()) res = resA;
+					else res = hull(resA, resB);
+				} else {
+					res = set_intersection(x[i], resA + m[i]);
+				}
+			}
+			CARL_LOG_DEBUG("carl.contractor", mVariables[i] << ": " << x[i] << " -> " << res);
+			if (res.isEmpty()) {
+				box[mVariables[i]] = res;
+				return false;
+			}
+			x[i] = res;
+			offset[i] = x[i] - m[i];
+		}
+		for (std::size_t i = 0; i < n; ++i) box[mVariables[i]] = x[i];
+		return true;
+	}
+public:
+	/**
+	 * Prepares the contraction for the system p = 0 in the given variables.
+	 * @param polynomials The polynomials of the system.
+	 * @param variables The variables to contract, as many as polynomials.
+	 * @param op The operator to use.
+	 */
+	NewtonContractor(const std::vector<Polynomial>& polynomials, const std::vector<Variable>& variables, Operator op = Operator::GAUSS_SEIDEL):
+		mPolynomials(polynomials),
+		mVariables(variables),
+		mOperator(op)
+	{
+		assert(mPolynomials.size() == mVariables.size());
+		for (const auto& p: mPolynomials) {
+			mJacobian.emplace_back();
+			for (auto v: mVariables) {
+				mJacobian.back().emplace_back(carl::derivative(p, v));
+			}
+		}
+	}
+
+	const auto& polynomials() const {
+		return mPolynomials;
+	}
+	const auto& variables() const {
+		return mVariables;
+	}
+	const auto& jacobian() const {
+		return mJacobian;
+	}
+
+	/**
+	 * Contracts the intervals of the variables in the given box.
+	 * The contraction is repeated until no interval is changed or the number of iterations is reached.
+	 * @param box Box to contract, must contain intervals for all variables.
+	 * @param iterations Maximal number of contractions.
+	 * @return false if the box contains no common root.
+	 */
+	bool contract(Box& box, std::size_t iterations = 1) const {
+		for (std::size_t i = 0; i < iterations; ++i) {
+			Box old = box;
+			if (!step(box)) return false;
+			if (box == old) break;
+		}
+		return true;
+	}
+};
+
+}
+}
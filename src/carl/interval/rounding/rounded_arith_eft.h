@@ -0,0 +1,282 @@
+/**
+ * This file contains a rounding policy for boost intervals over double that
+ * does not change the rounding mode for arithmetic operations.
+ *
+ * @file   rounded_arith_eft.h
+ */
+
+#pragma once
+
+#include <boost/numeric/interval/hw_rounding.hpp>
+#include <boost/numeric/interval/rounded_arith.hpp>
+#include <boost/numeric/interval/rounded_transc.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+/**
+ * Disables floating point contraction for the function it is applied to, independently of the compiler flags.
+ * Clang honours the standard pragma at the beginning of the function body, gcc ignores it but accepts the optimize attribute.
+ */
+#if defined(__clang__)
+#define CARL_FP_CONTRACT_OFF_ATTRIBUTE
+#define CARL_FP_CONTRACT_OFF_PRAGMA _Pragma("STDC FP_CONTRACT OFF")
+#elif defined(__GNUC__)
+#define CARL_FP_CONTRACT_OFF_ATTRIBUTE __attribute__((optimize("fp-contract=off")))
+#define CARL_FP_CONTRACT_OFF_PRAGMA
+#else
+#define CARL_FP_CONTRACT_OFF_ATTRIBUTE
+#define CARL_FP_CONTRACT_OFF_PRAGMA
+#endif
+
+namespace carl
+{
+	/**
+	 * Rounding policy for boost intervals over double based on error-free transformations.
+	 *
+	 * The default policy for double switches the rounding mode of the FPU twice for every bound of every operation, and saves and restores it around every operation.
+	 * This policy computes all arithmetic operations with the default rounding to nearest instead.
+	 * The rounding error of every operation is obtained exactly by an error-free transformation (TwoSum, Dekker's TwoProduct and the residuals of division and square root) @cite Ogita05,
+	 * and the result is moved to the neighbouring floating point number if the exact result lies on that side.
+	 * Hence the bounds are exactly the results of directed rounding.
+	 * If an error-free transformation is not exact because of overflow or underflow, the result is conservatively widened by one ulp.
+	 *
+	 * The rounding mode must be rounding to nearest whenever arithmetic operations are performed.
+	 * A fused multiply-add breaks TwoProduct, hence floating point contraction is disabled for the error-free transformations themselves.
+	 * If INTERVAL_EFT_ROUNDING is enabled, carl and its users are additionally compiled with -ffp-contract=off.
+	 * Transcendental functions are rare and still computed by switching the rounding mode, exactly as by the default policy.
+	 */
+	struct rounded_arith_eft
+	{
+		using T = double;
+		using unprotected_rounding = rounded_arith_eft;
+
+		void init() {}
+
+		/// Conversions are exact for floating point types and small integers.
+		template<typename U>
+		T conv_down(const U& v)
+		{
+			T res = static_cast<T>(v);
+			if (std::is_floating_point<U>::value) return res <= v ? res : next_down(res);
+			return std::abs(res) <= INTEGER_LIMIT ? res : next_down(res);
+		}
+		template<typename U>
+		T conv_up(const U& v)
+		{
+			T res = static_cast<T>(v);
+			if (std::is_floating_point<U>::value) return res >= v ? res : next_up(res);
+			return std::abs(res) <= INTEGER_LIMIT ? res : next_up(res);
+		}
+
+		T add_down(const T& x, const T& y)
+		{
+			T e;
+			T s = two_sum(x, y, e);
+			if (e != e) return next_down(s);
+			return e < 0 ? next_down(s) : s;
+		}
+		T add_up(const T& x, const T& y)
+		{
+			T e;
+			T s = two_sum(x, y, e);
+			if (e != e) return next_up(s);
+			return e > 0 ? next_up(s) : s;
+		}
+		T sub_down(const T& x, const T& y)
+		{
+			return add_down(x, -y);
+		}
+		T sub_up(const T& x, const T& y)
+		{
+			return add_up(x, -y);
+		}
+
+		T mul_down(const T& x, const T& y)
+		{
+			T e;
+			T p = two_product(x, y, e);
+			if (e != e) return next_down(p);
+			return e < 0 ? next_down(p) : p;
+		}
+		T mul_up(const T& x, const T& y)
+		{
+			T e;
+			T p = two_product(x, y, e);
+			if (e != e) return next_up(p);
+			return e > 0 ? next_up(p) : p;
+		}
+
+		T div_down(const T& x, const T& y)
+		{
+			T q = x / y;
+			int s = division_error(x, y, q);
+			if (s == INEXACT) return next_down(q);
+			return s < 0 ? next_down(q) : q;
+		}
+		T div_up(const T& x, const T& y)
+		{
+			T q = x / y;
+			int s = division_error(x, y, q);
+			if (s == INEXACT) return next_up(q);
+			return s > 0 ? next_up(q) : q;
+		}
+
+		T sqrt_down(const T& x)
+		{
+			T r = std::sqrt(x);
+			T e;
+			T p = two_product(r, r, e);
+			// The exact square root is larger than r if x > r*r = p + e.
+			if (e != e) return std::max(T(0), next_down(r));
+			T residual = (x - p) - e;
+			return residual < 0 ? std::max(T(0), next_down(r)) : r;
+		}
+		T sqrt_up(const T& x)
+		{
+			T r = std::sqrt(x);
+			T e;
+			T p = two_product(r, r, e);
+			if (e != e) return next_up(r);
+			T residual = (x - p) - e;
+			return residual > 0 ? next_up(r) : r;
+		}
+
+		T median(const T& x, const T& y)
+		{
+			return (x + y) / 2;
+		}
+		T int_down(const T& x)
+		{
+			return std::floor(x);
+		}
+		T int_up(const T& x)
+		{
+			return std::ceil(x);
+		}
+
+#define CARL_INTERVAL_EFT_TRANSC(f) \
+		T f##_down(const T& x) { Transcendental rnd; return rnd.f##_down(x); } \
+		T f##_up(const T& x) { Transcendental rnd; return rnd.f##_up(x); }
+		CARL_INTERVAL_EFT_TRANSC(exp)
+		CARL_INTERVAL_EFT_TRANSC(log)
+		CARL_INTERVAL_EFT_TRANSC(sin)
+		CARL_INTERVAL_EFT_TRANSC(cos)
+		CARL_INTERVAL_EFT_TRANSC(tan)
+		CARL_INTERVAL_EFT_TRANSC(asin)
+		CARL_INTERVAL_EFT_TRANSC(acos)
+		CARL_INTERVAL_EFT_TRANSC(atan)
+		CARL_INTERVAL_EFT_TRANSC(sinh)
+		CARL_INTERVAL_EFT_TRANSC(cosh)
+		CARL_INTERVAL_EFT_TRANSC(tanh)
+		CARL_INTERVAL_EFT_TRANSC(asinh)
+		CARL_INTERVAL_EFT_TRANSC(acosh)
+		CARL_INTERVAL_EFT_TRANSC(atanh)
+#undef CARL_INTERVAL_EFT_TRANSC
+
+		/// Smallest double larger than x.
+		static T next_up(T x)
+		{
+			if (x != x || x == std::numeric_limits<T>::infinity()) return x;
+			if (x == 0) return std::numeric_limits<T>::denorm_min();
+			std::uint64_t bits;
+			std::memcpy(&bits, &x, sizeof(T));
+			if (x > 0) ++bits;
+			else --bits;
+			std::memcpy(&x, &bits, sizeof(T));
+			return x;
+		}
+		/// Largest double smaller than x.
+		static T next_down(T x)
+		{
+			return -next_up(-x);
+		}
+
+	private:
+		using Transcendental = boost::numeric::interval_lib::save_state<boost::numeric::interval_lib::rounded_transc_std<T>>;
+		/// Integers up to this absolute value are exactly representable.
+		static constexpr T INTEGER_LIMIT = 9007199254740992.0; // 2^53
+		/// Bounds for the exponents such that Dekker's TwoProduct neither overflows nor underflows.
+		static constexpr T SPLIT_LIMIT = 6.69692879491417e+299; // 2^996
+		static constexpr T UNDERFLOW_LIMIT = 1.0020841800044864e-292; // 2^-969
+		static constexpr int INEXACT = 2;
+
+		/**
+		 * Knuth's TwoSum: s + e = x + y exactly, where s is x + y rounded to nearest.
+		 * @return s, and e is NaN if s is not finite.
+		 */
+		static T two_sum(T x, T y, T& e)
+		{
+			T s = x + y;
+			if (!std::isfinite(s))
+			{
+				// Sums of infinite bounds are exact, otherwise s overflowed.
+				e = (std::isfinite(x) && std::isfinite(y)) ? std::numeric_limits<T>::quiet_NaN() : 0;
+				return s;
+			}
+			T yy = s - x;
+			e = (x - (s - yy)) + (y - yy);
+			return s;
+		}
+
+		/**
+		 * Dekker's TwoProduct: p + e = x * y exactly, where p is x * y rounded to nearest.
+		 * @return p, and e is NaN if p + e may be inexact due to overflow or underflow.
+		 * Products of infinite bounds are exact.
+		 */
+		CARL_FP_CONTRACT_OFF_ATTRIBUTE static T two_product(T x, T y, T& e)
+		{
+			CARL_FP_CONTRACT_OFF_PRAGMA
+			T p = x * y;
+			if (x == 0 || y == 0 || !std::isfinite(x) || !std::isfinite(y))
+			{
+				e = 0;
+				return p;
+			}
+			if (!(std::abs(x) < SPLIT_LIMIT && std::abs(y) < SPLIT_LIMIT && std::abs(p) > UNDERFLOW_LIMIT && std::abs(p) < SPLIT_LIMIT))
+			{
+				e = std::numeric_limits<T>::quiet_NaN();
+				return p;
+			}
+			T xh, xl, yh, yl;
+			split(x, xh, xl);
+			split(y, yh, yl);
+			e = xl * yl - (((p - xh * yh) - xl * yh) - xh * yl);
+			return p;
+		}
+		/// Veltkamp's splitting: x = h + l, where h and l have at most 26 significant bits.
+		CARL_FP_CONTRACT_OFF_ATTRIBUTE static void split(T x, T& h, T& l)
+		{
+			CARL_FP_CONTRACT_OFF_PRAGMA
+			T c = 134217729.0 * x; // 2^27 + 1
+			h = c - (c - x);
+			l = x - h;
+		}
+
+		/**
+		 * Computes the sign of x / y - q, where q is x / y rounded to nearest.
+		 * The residual x - q * y is representable, and computed exactly from TwoProduct.
+		 * @return Sign of x / y - q, or INEXACT.
+		 */
+		static int division_error(T x, T y, T q)
+		{
+			// Quotients of infinite bounds are exact.
+			if (!std::isfinite(x) || !std::isfinite(y)) return 0;
+			if (x == 0) return 0;
+			// The quotient overflowed or underflowed.
+			if (!std::isfinite(q) || std::abs(q) < std::numeric_limits<T>::min()) return INEXACT;
+			T e;
+			T p = two_product(q, y, e);
+			if (e != e) return INEXACT;
+			T residual = (x - p) - e;
+			if (residual == 0) return 0;
+			return (residual > 0) == (y > 0) ? 1 : -1;
+		}
+	};
+}
+
+#undef CARL_FP_CONTRACT_OFF_ATTRIBUTE
+#undef CARL_FP_CONTRACT_OFF_PRAGMA
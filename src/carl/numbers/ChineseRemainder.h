@@ -0,0 +1,95 @@
+/**
+ * @file ChineseRemainder.h
+ *
+ * Chinese remaindering and rational reconstruction for multi-modular algorithms with word-sized primes.
+ */
+
+#pragma once
+
+#include "GaloisField.h"
+#include "numbers.h"
+
+namespace carl {
+
+/**
+ * Lifts integers known modulo m to integers modulo m * p, given their residues modulo a prime p that does not divide m.
+ * A lifted integer is congruent to its old value modulo m and to the given residue modulo p.
+ * It lies in [0, m * p) or, for the symmetric representation, in (-m * p / 2, m * p / 2], if the old value was in the respective range modulo m.
+ */
+class ChineseRemainder {
+	const GaloisField<uint>& mField;
+	mpz_class mModulus;
+	/// m^-1 mod p
+	uint mInverse;
+	/// m * p
+	mpz_class mProduct;
+	/// m * p / 2
+	mpz_class mHalf;
+	bool mSymmetric;
+public:
+	/**
+	 * @param F Field of the new residues.
+	 * @param m Modulus of the old values.
+	 * @param symmetric If the symmetric representation is used.
+	 */
+	ChineseRemainder(const GaloisField<uint>& F, const mpz_class& m, bool symmetric):
+		mField(F),
+		mModulus(m),
+		mInverse(F.inverse(F.fromInteger(m))),
+		mProduct(m * static_cast<unsigned long>(F.size())),
+		mHalf(mProduct / 2),
+		mSymmetric(symmetric)
+	{}
+
+	/// Returns the new modulus m * p.
+	const mpz_class& modulus() const {
+		return mProduct;
+	}
+
+	/**
+	 * Lifts c such that it is congruent to r modulo p.
+	 * @return If c changed.
+	 */
+	bool lift(mpz_class& c, uint r) const {
+		// c + m * ((r - c) / m mod p)
+		uint t = mField.mul(mField.sub(r, mField.fromInteger(c)), mInverse);
+		if (t == 0) return false;
+		c += mModulus * static_cast<unsigned long>(t);
+		if (mSymmetric && c > mHalf) c -= mProduct;
+		return true;
+	}
+};
+
+/**
+ * Computes n / d with |n|, d <= bound such that n / d = a modulo m, if it exists, following @cite GCL92, chapter 5.
+ * @param a Residue in [0, m).
+ * @param m Modulus.
+ * @param bound Bound for numerator and denominator, usually sqrt(m / 2).
+ * @param res Reconstructed rational.
+ * @return If the reconstruction was successful.
+ */
+inline bool rationalReconstruction(const mpz_class& a, const mpz_class& m, const mpz_class& bound, mpq_class& res) {
+	if (a <= bound) {
+		res = a;
+		return true;
+	}
+	mpz_class r0 = m;
+	mpz_class r1 = a;
+	mpz_class t0 = 0;
+	mpz_class t1 = 1;
+	mpz_class q;
+	while (r1 > bound) {
+		mpz_fdiv_qr(q.get_mpz_t(), r0.get_mpz_t(), r0.get_mpz_t(), r1.get_mpz_t());
+		mpz_swap(r0.get_mpz_t(), r1.get_mpz_t());
+		mpz_submul(t0.get_mpz_t(), q.get_mpz_t(), t1.get_mpz_t());
+		mpz_swap(t0.get_mpz_t(), t1.get_mpz_t());
+	}
+	if (t1 == 0 || abs(t1) > bound) return false;
+	mpz_gcd(q.get_mpz_t(), r1.get_mpz_t(), t1.get_mpz_t());
+	if (q != 1) return false;
+	res = mpq_class(r1, t1);
+	res.canonicalize();
+	return true;
+}
+
+}
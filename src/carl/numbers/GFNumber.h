@@ -216,3 +216,4 @@ std::string toString(const GFNumber<IntegerType>& _number, bool /*unused*/)
 
 }
 #include "GFNumber.tpp"
+#include "GFNumber_word.h"
@@ -127,6 +127,7 @@ GFNumber<IntegerType>& GFNumber<IntegerType>::operator +=(const GFNumber& rhs)
 		mGf = rhs.mGf;
 	}
 	mN += rhs.mN;
+	if (mGf != nullptr) mN = mGf->symmetricModulo(mN);
 	return *this;
 }
 
@@ -170,6 +171,7 @@ GFNumber<IntegerType>& GFNumber<IntegerType>::operator -=(const GFNumber& rhs)
 		mGf = rhs.mGf;
 	}
 	mN -= rhs.mN;
+	if (mGf != nullptr) mN = mGf->symmetricModulo(mN);
 	return *this;
 }
 
@@ -0,0 +1,287 @@
+/**
+ * @file GFNumber_word.h
+ *
+ * Specialization of GFNumber for fields of size below 2^63.
+ */
+
+#pragma once
+
+#include "GFNumber.h"
+
+namespace carl
+{
+
+/**
+ * Galois field numbers over a GaloisField<uint>, i.e. Z_{p^k} with p^k < 2^63.
+ *
+ * In contrast to the general GFNumber, the number is stored in a machine word in the range [0, p^k) instead of the symmetric range,
+ * and every operation reduces its result with the word arithmetic of GaloisField<uint>.
+ * As for the general GFNumber, a number may have no field (yet), in which case it is a plain nonnegative integer that is reduced once it is combined with a number from a field.
+ *
+ * Integer polynomials are mapped to such a field by UnivariatePolynomial::toFiniteDomain().
+ * Multiplication, division and gcd of the resulting polynomials then use the kernels from dense_arithmetic.
+ */
+template<>
+class GFNumber<uint>
+{
+	uint mN = 0;
+	const GaloisField<uint>* mGf = nullptr;
+
+	/// Returns the field of lhs and rhs, of which at least one must have a field.
+	static const GaloisField<uint>* field(const GFNumber& lhs, const GFNumber& rhs) {
+		assert(lhs.mGf == nullptr || rhs.mGf == nullptr || *(lhs.mGf) == *(rhs.mGf));
+		return lhs.mGf == nullptr ? rhs.mGf : lhs.mGf;
+	}
+	/// Returns the value of n in the field gf.
+	static uint value(const GFNumber& n, const GaloisField<uint>* gf) {
+		return n.mGf == nullptr ? gf->modulo(n.mN) : n.mN;
+	}
+	/// Creates a number from a value that is already reduced.
+	static GFNumber reduced(uint n, const GaloisField<uint>* gf) {
+		GFNumber res;
+		res.mN = n;
+		res.mGf = gf;
+		return res;
+	}
+
+public:
+	GFNumber() = default;
+	explicit GFNumber(uint n, const GaloisField<uint>* gf = nullptr):
+		mN(gf == nullptr ? n : gf->modulo(n)),
+		mGf(gf)
+	{
+	}
+	/// Creates the residue class of a (possibly negative) integer, which requires a field.
+	GFNumber(sint n, const GaloisField<uint>* gf):
+		mN(gf->fromInteger(n)),
+		mGf(gf)
+	{
+	}
+	explicit GFNumber(int n, const GaloisField<uint>* gf = nullptr):
+		mN(gf == nullptr ? uint(n) : gf->fromInteger(sint(n))),
+		mGf(gf)
+	{
+		assert(gf != nullptr || n >= 0);
+	}
+	/// Creates the residue class of an arbitrary precision integer.
+	GFNumber(const mpz_class& n, const GaloisField<uint>* gf):
+		mN(mpz_fdiv_ui(n.get_mpz_t(), static_cast<unsigned long>(gf->size()))),
+		mGf(gf)
+	{
+	}
+
+	GFNumber(const GFNumber& n, const GaloisField<uint>* gf):
+		mN(gf == nullptr ? n.mN : gf->modulo(n.mN)),
+		mGf(gf)
+	{
+	}
+
+	const GaloisField<uint>* gf() const
+	{
+		return mGf;
+	}
+
+	GFNumber toGF(const GaloisField<uint>* newfield) const
+	{
+		return GFNumber(*this, newfield);
+	}
+
+	void normalize()
+	{
+		if (mGf != nullptr) mN = mGf->modulo(mN);
+	}
+
+	bool isZero() const
+	{
+		return mN == 0;
+	}
+
+	bool isOne() const
+	{
+		return isUnit();
+	}
+
+	bool isUnit() const
+	{
+		return mN == 1;
+	}
+
+	/// Returns the number as an integer in [0, p^k).
+	uint representingInteger() const
+	{
+		return mN;
+	}
+
+	GFNumber inverse() const
+	{
+		assert(mGf != nullptr);
+		return reduced(mGf->inverse(mN), mGf);
+	}
+
+	friend bool operator==(const GFNumber& lhs, const GFNumber& rhs)
+	{
+		if (lhs.mN == rhs.mN) return true;
+		if (lhs.mGf == nullptr && rhs.mGf == nullptr) return false;
+		const auto* gf = field(lhs, rhs);
+		return value(lhs, gf) == value(rhs, gf);
+	}
+	/**
+	 * lhs == rhs, if rhs \\in [lhs].
+	 */
+	friend bool operator==(const GFNumber& lhs, uint rhs)
+	{
+		if (lhs.mGf == nullptr) return lhs.mN == rhs;
+		return lhs.mN == lhs.mGf->modulo(rhs);
+	}
+	friend bool operator==(uint lhs, const GFNumber& rhs)
+	{
+		return rhs == lhs;
+	}
+	/**
+	 * lhs == rhs, if rhs \\in [lhs].
+	 */
+	friend bool operator==(const GFNumber& lhs, int rhs)
+	{
+		if (lhs.mGf == nullptr) return rhs >= 0 && lhs.mN == uint(rhs);
+		return lhs.mN == lhs.mGf->fromInteger(sint(rhs));
+	}
+	friend bool operator==(int lhs, const GFNumber& rhs)
+	{
+		return rhs == lhs;
+	}
+	friend bool operator!=(const GFNumber& lhs, const GFNumber& rhs)
+	{
+		return !(lhs == rhs);
+	}
+	friend bool operator!=(const GFNumber& lhs, uint rhs)
+	{
+		return !(lhs == rhs);
+	}
+	friend bool operator!=(uint lhs, const GFNumber& rhs)
+	{
+		return !(lhs == rhs);
+	}
+	friend bool operator!=(const GFNumber& lhs, int rhs)
+	{
+		return !(lhs == rhs);
+	}
+	friend bool operator!=(int lhs, const GFNumber& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	GFNumber operator-() const
+	{
+		assert(mGf != nullptr || mN == 0);
+		return mGf == nullptr ? *this : reduced(mGf->neg(mN), mGf);
+	}
+
+	friend GFNumber operator+(const GFNumber& lhs, const GFNumber& rhs)
+	{
+		const auto* gf = field(lhs, rhs);
+		if (gf == nullptr) return GFNumber(lhs.mN + rhs.mN);
+		return reduced(gf->add(value(lhs, gf), value(rhs, gf)), gf);
+	}
+	friend GFNumber operator+(const GFNumber& lhs, uint rhs)
+	{
+		return lhs + GFNumber(rhs);
+	}
+	friend GFNumber operator+(uint lhs, const GFNumber& rhs)
+	{
+		return rhs + lhs;
+	}
+
+	GFNumber& operator++()
+	{
+		return *this += GFNumber(uint(1));
+	}
+	GFNumber& operator+=(const GFNumber& rhs)
+	{
+		return *this = *this + rhs;
+	}
+	GFNumber& operator+=(uint rhs)
+	{
+		return *this = *this + rhs;
+	}
+
+	friend GFNumber operator-(const GFNumber& lhs, const GFNumber& rhs)
+	{
+		const auto* gf = field(lhs, rhs);
+		if (gf == nullptr) {
+			assert(lhs.mN >= rhs.mN);
+			return GFNumber(lhs.mN - rhs.mN);
+		}
+		return reduced(gf->sub(value(lhs, gf), value(rhs, gf)), gf);
+	}
+	friend GFNumber operator-(const GFNumber& lhs, uint rhs)
+	{
+		return lhs - GFNumber(rhs);
+	}
+	friend GFNumber operator-(uint lhs, const GFNumber& rhs)
+	{
+		return GFNumber(lhs) - rhs;
+	}
+
+	GFNumber& operator--()
+	{
+		return *this -= GFNumber(uint(1));
+	}
+	GFNumber& operator-=(const GFNumber& rhs)
+	{
+		return *this = *this - rhs;
+	}
+	GFNumber& operator-=(uint rhs)
+	{
+		return *this = *this - rhs;
+	}
+
+	friend GFNumber operator*(const GFNumber& lhs, const GFNumber& rhs)
+	{
+		const auto* gf = field(lhs, rhs);
+		if (gf == nullptr) return GFNumber(lhs.mN * rhs.mN);
+		return reduced(gf->mul(value(lhs, gf), value(rhs, gf)), gf);
+	}
+	friend GFNumber operator*(const GFNumber& lhs, uint rhs)
+	{
+		return lhs * GFNumber(rhs);
+	}
+	friend GFNumber operator*(uint lhs, const GFNumber& rhs)
+	{
+		return rhs * lhs;
+	}
+
+	GFNumber& operator*=(const GFNumber& rhs)
+	{
+		return *this = *this * rhs;
+	}
+	GFNumber& operator*=(uint rhs)
+	{
+		return *this = *this * rhs;
+	}
+
+	friend GFNumber operator/(const GFNumber& lhs, const GFNumber& rhs)
+	{
+		assert(!rhs.isZero());
+		const auto* gf = field(lhs, rhs);
+		assert(gf != nullptr);
+		return reduced(gf->mul(value(lhs, gf), gf->inverse(value(rhs, gf))), gf);
+	}
+
+	GFNumber& operator/=(const GFNumber& rhs)
+	{
+		return *this = *this / rhs;
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const GFNumber& rhs)
+	{
+		os << "(" << rhs.mN << ") mod ";
+		if (rhs.mGf != nullptr) {
+			os << rhs.mGf->size();
+		} else {
+			os << "?";
+		}
+		return os;
+	}
+};
+
+}
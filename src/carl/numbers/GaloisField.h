@@ -95,12 +95,229 @@ private:
 	}
 };
 
+namespace detail {
+	/// Computes the full product of a and b as hi * 2^64 + lo.
+	inline void umul128(uint a, uint b, uint& hi, uint& lo) {
+#ifdef __SIZEOF_INT128__
+		unsigned __int128 res = static_cast<unsigned __int128>(a) * b;
+		hi = uint(res >> 64);
+		lo = uint(res);
+#else
+		uint a0 = a & 0xffffffffu, a1 = a >> 32;
+		uint b0 = b & 0xffffffffu, b1 = b >> 32;
+		uint p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+		uint mid = (p00 >> 32) + (p01 & 0xffffffffu) + (p10 & 0xffffffffu);
+		hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+		lo = (mid << 32) | (p00 & 0xffffffffu);
+#endif
+	}
+	/// Computes the upper half of the product of a and b.
+	inline uint umulhi(uint a, uint b) {
+		uint hi;
+		uint lo;
+		umul128(a, b, hi, lo);
+		return hi;
+	}
+}
+
+/**
+ * The ring Z_{p^k} for p^k < 2^63, where elements are represented by machine words in [0, p^k).
+ *
+ * Double word products are reduced with a precomputed reciprocal of the shifted modulus as in @cite Moeller11, Algorithm 4,
+ * a variant of Barrett reduction that needs two multiplications and no division.
+ * When one factor is used many times, for example in polynomial arithmetic, Shoup's method precomputes floor(w * 2^64 / p^k) and needs no double word product at all.
+ * As the modulus is below 2^63, sums of two elements and the intermediate results of Shoup's method fit into a word.
+ */
+template<>
+class GaloisField<uint> {
+public:
+	using BaseIntType = uint;
+private:
+	const BaseIntType mP;
+	const BaseIntType mK;
+	uint mPK;
+	/// Shift such that the highest bit of mNormalized is set.
+	unsigned mShift = 0;
+	/// mPK << mShift
+	uint mNormalized;
+	/// floor((2^128 - 1) / mNormalized) - 2^64
+	uint mInverse = 0;
+
+	/// Divides hi * 2^64 + lo by the normalized modulus, where hi < mNormalized.
+	void divideNormalized(uint hi, uint lo, uint& quotient, uint& remainder) const {
+		uint qhi;
+		uint qlo;
+		detail::umul128(mInverse, hi, qhi, qlo);
+		qlo += lo;
+		qhi += hi + (qlo < lo ? 1 : 0) + 1;
+		uint r = lo - qhi * mNormalized;
+		if (r > qlo) {
+			--qhi;
+			r += mNormalized;
+		}
+		if (r >= mNormalized) {
+			++qhi;
+			r -= mNormalized;
+		}
+		quotient = qhi;
+		remainder = r;
+	}
+	/// Divides hi * 2^64 + lo by p^k, where hi < p^k.
+	void divide(uint hi, uint lo, uint& quotient, uint& remainder) const {
+		if (mShift > 0) {
+			hi = (hi << mShift) | (lo >> (64 - mShift));
+			lo <<= mShift;
+		}
+		divideNormalized(hi, lo, quotient, remainder);
+		remainder >>= mShift;
+	}
+public:
+	/**
+	 * Creating the ring Z_{p^k}
+	 * @param p A prime number
+	 * @param k A exponent
+	 */
+	explicit GaloisField(BaseIntType p, BaseIntType k = 1):
+		mP(p), mK(k), mPK(1)
+	{
+		assert(p >= 2 && k >= 1);
+		for (BaseIntType i = 0; i < k; ++i) {
+			assert(mPK <= (uint(1) << 63) / p);
+			mPK *= p;
+		}
+		assert(mPK < (uint(1) << 63));
+		while ((mPK << mShift) >> 63 == 0) ++mShift;
+		mNormalized = mPK << mShift;
+		// Compute floor(((2^64 - 1 - d) * 2^64 + 2^64 - 1) / d) by binary long division.
+		uint hi = ~mNormalized;
+		uint lo = ~uint(0);
+		for (int i = 0; i < 64; ++i) {
+			bool carry = (hi >> 63) != 0;
+			hi = (hi << 1) | (lo >> 63);
+			lo <<= 1;
+			mInverse <<= 1;
+			if (carry || hi >= mNormalized) {
+				hi -= mNormalized;
+				mInverse |= 1;
+			}
+		}
+	}
+
+	/**
+	 * Returns the p from Z_{p^k}
+	 * @return a prime
+	 */
+	BaseIntType p() const noexcept {
+		return mP;
+	}
+
+	/**
+	 * Returns the k from Z_{p^k}
+	 * @return A positive integer
+	 */
+	BaseIntType k() const noexcept {
+		return mK;
+	}
+
+	const uint& size() const noexcept {
+		return mPK;
+	}
+
+	uint modulo(uint n) const {
+		return n < mPK ? n : n % mPK;
+	}
+	/// Maps a signed integer to [0, p^k).
+	uint fromInteger(sint n) const {
+		if (n >= 0) return modulo(uint(n));
+		uint r = modulo(uint(-(n + 1)) + 1);
+		return r == 0 ? 0 : mPK - r;
+	}
+	/// Maps an arbitrary precision integer to [0, p^k).
+	uint fromInteger(const mpz_class& n) const {
+		return mpz_fdiv_ui(n.get_mpz_t(), static_cast<unsigned long>(mPK));
+	}
+	/// Reduces hi * 2^64 + lo, where hi < p^k.
+	uint reduce(uint hi, uint lo) const {
+		assert(hi < mPK);
+		uint q;
+		uint r;
+		divide(hi, lo, q, r);
+		return r;
+	}
+
+	uint add(uint a, uint b) const {
+		uint r = a + b;
+		return r >= mPK ? r - mPK : r;
+	}
+	uint sub(uint a, uint b) const {
+		return a >= b ? a - b : a + mPK - b;
+	}
+	uint neg(uint a) const {
+		return a == 0 ? 0 : mPK - a;
+	}
+	uint mul(uint a, uint b) const {
+		uint hi;
+		uint lo;
+		detail::umul128(a, b, hi, lo);
+		return reduce(hi, lo);
+	}
+	/// Computes floor(w * 2^64 / p^k) for w < p^k, to be used with mulShoup().
+	uint shoup(uint w) const {
+		assert(w < mPK);
+		uint q;
+		uint r;
+		divide(w, 0, q, r);
+		return q;
+	}
+	/// Computes a * w, where wShoup = shoup(w).
+	uint mulShoup(uint a, uint w, uint wShoup) const {
+		uint r = a * w - detail::umulhi(a, wShoup) * mPK;
+		return r >= mPK ? r - mPK : r;
+	}
+	uint pow(uint a, uint e) const {
+		uint res = 1;
+		for (; e > 0; e >>= 1) {
+			if (e & 1) res = mul(res, a);
+			a = mul(a, a);
+		}
+		return res;
+	}
+	/// Computes the inverse of a, which must be coprime to p.
+	uint inverse(uint a) const {
+		assert(a % mP != 0);
+		// Extended euclidean algorithm, only tracking the coefficient of a.
+		uint r0 = mPK;
+		uint r1 = a;
+		uint s0 = 0;
+		uint s1 = 1;
+		while (r1 != 0) {
+			uint q = r0 / r1;
+			uint r = r0 - q * r1;
+			r0 = r1;
+			r1 = r;
+			uint s = sub(s0, mul(modulo(q), s1));
+			s0 = s1;
+			s1 = s;
+		}
+		assert(r0 == 1);
+		return s0;
+	}
+
+	friend bool operator==(const GaloisField& lhs, const GaloisField& rhs) {
+		return lhs.mPK == rhs.mPK;
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const GaloisField& rhs) {
+		return os << "GF(" << rhs.mP << "^" << rhs.mK << ")";
+	}
+};
+
 template<typename IntegerType>
 class GaloisFieldManager: public Singleton<GaloisFieldManager<IntegerType>> {
 public:
 	using BaseIntType = typename GaloisField<IntegerType>::BaseIntType;
 private:
-	std::map<std::pair<BaseIntType,BaseIntType>, std::unique_ptr<GaloisField<IntegerType>>, IntegerPairCompare<unsigned>> mGaloisFields;
+	std::map<std::pair<BaseIntType,BaseIntType>, std::unique_ptr<GaloisField<IntegerType>>, IntegerPairCompare<BaseIntType>> mGaloisFields;
 public:
 	
 	const GaloisField<IntegerType>* getField(BaseIntType p, BaseIntType k = 1)
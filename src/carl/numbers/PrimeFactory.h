@@ -2,10 +2,73 @@
 
 #include "numbers.h"
 
+#include <algorithm>
+#include <array>
 #include <mutex>
 
 namespace carl {
 
+namespace detail {
+	/// Computes a * b mod m for a, b < m.
+	inline uint mulmod(uint a, uint b, uint m) {
+		if (m <= (uint(1) << 32)) return (a * b) % m;
+#ifdef __SIZEOF_INT128__
+		return uint((static_cast<unsigned __int128>(a) * b) % m);
+#else
+		uint res = 0;
+		for (; b > 0; b >>= 1) {
+			if (b & 1) res = (res >= m - a) ? res - (m - a) : res + a;
+			a = (a >= m - a) ? a - (m - a) : a + a;
+		}
+		return res;
+#endif
+	}
+
+	/// Checks whether n is a strong probable prime to the base a, where n - 1 = d * 2^s with d odd.
+	inline bool isStrongProbablePrime(uint n, uint d, unsigned s, uint a) {
+		a %= n;
+		if (a == 0) return true;
+		uint x = 1;
+		for (uint e = d; e > 0; e >>= 1) {
+			if (e & 1) x = mulmod(x, a, n);
+			a = mulmod(a, a, n);
+		}
+		if (x == 1 || x == n - 1) return true;
+		for (unsigned i = 1; i < s; ++i) {
+			x = mulmod(x, x, n);
+			if (x == n - 1) return true;
+		}
+		return false;
+	}
+}
+
+/**
+ * Checks whether a 64 bit number is prime.
+ * After trial division by small primes, this is a deterministic Miller-Rabin test:
+ * the bases 2, 7 and 61 suffice for n < 4759123141 @cite Jaeschke93,
+ * and the bases 2, 325, 9375, 28178, 450775, 9780504, 1795265022 found by J. Sinclair suffice for all n < 2^64.
+ */
+inline bool isPrime(uint n) {
+	static constexpr std::array<uint, 12> small = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+	static constexpr std::array<uint, 3> bases32 = { 2, 7, 61 };
+	static constexpr std::array<uint, 7> bases64 = { 2, 325, 9375, 28178, 450775, 9780504, 1795265022 };
+	if (n < 2) return false;
+	for (uint p: small) {
+		if (n % p == 0) return n == p;
+	}
+	if (n < 41 * 41) return true;
+	uint d = n - 1;
+	unsigned s = 0;
+	while ((d & 1) == 0) {
+		d >>= 1;
+		++s;
+	}
+	if (n < (uint(1) << 32)) {
+		return std::all_of(bases32.begin(), bases32.end(), [n,d,s](uint a){ return detail::isStrongProbablePrime(n, d, s, a); });
+	}
+	return std::all_of(bases64.begin(), bases64.end(), [n,d,s](uint a){ return detail::isStrongProbablePrime(n, d, s, a); });
+}
+
 /**
  * This class provides a convenient way to enumerate primes.
  */
@@ -47,14 +110,10 @@ std::mutex PrimeFactory<T>::mPrimeMutex;
 #endif
 
 namespace detail {
-	inline uint next_prime(const uint& n, const PrimeFactory<uint>& pf) {
-		for (uint res = n + 2; ; res += 2) {
-			bool found = false;
-			for (std::size_t i = 1; !found && (i < pf.size()); i++) {
-				if (res % pf[i] == 0) found = true;
-			}
-			if (!found) return res;
-		}
+	inline uint next_prime(const uint& n, const PrimeFactory<uint>&) {
+		uint res = n + 2;
+		while (!isPrime(res)) res += 2;
+		return res;
 	}
 	
 	inline mpz_class next_prime(const mpz_class& n, const PrimeFactory<mpz_class>&) {
@@ -81,4 +140,113 @@ const T& PrimeFactory<T>::nextPrime() {
     return mPrimes[mNext++];
 }
 
+namespace detail {
+	/// Table of the largest primes below 2^Bits in decreasing order, only available for some values of Bits.
+	template<std::size_t Bits>
+	struct LargestPrimes {
+		static constexpr std::array<uint, 0> table = {};
+	};
+	template<>
+	struct LargestPrimes<32> {
+		static constexpr std::array<uint, 64> table = {
+		4294967291ull, 4294967279ull, 4294967231ull, 4294967197ull,
+		4294967189ull, 4294967161ull, 4294967143ull, 4294967111ull,
+		4294967087ull, 4294967029ull, 4294966997ull, 4294966981ull,
+		4294966943ull, 4294966927ull, 4294966909ull, 4294966877ull,
+		4294966829ull, 4294966813ull, 4294966769ull, 4294966667ull,
+		4294966661ull, 4294966657ull, 4294966651ull, 4294966639ull,
+		4294966619ull, 4294966591ull, 4294966583ull, 4294966553ull,
+		4294966477ull, 4294966447ull, 4294966441ull, 4294966427ull,
+		4294966373ull, 4294966367ull, 4294966337ull, 4294966297ull,
+		4294966243ull, 4294966237ull, 4294966231ull, 4294966217ull,
+		4294966187ull, 4294966177ull, 4294966163ull, 4294966153ull,
+		4294966129ull, 4294966121ull, 4294966099ull, 4294966087ull,
+		4294966073ull, 4294966043ull, 4294966007ull, 4294966001ull,
+		4294965977ull, 4294965971ull, 4294965967ull, 4294965949ull,
+		4294965937ull, 4294965911ull, 4294965887ull, 4294965847ull,
+		4294965841ull, 4294965839ull, 4294965821ull, 4294965793ull
+		};
+	};
+	template<>
+	struct LargestPrimes<63> {
+		static constexpr std::array<uint, 64> table = {
+		9223372036854775783ull, 9223372036854775643ull, 9223372036854775549ull, 9223372036854775507ull,
+		9223372036854775433ull, 9223372036854775421ull, 9223372036854775417ull, 9223372036854775399ull,
+		9223372036854775351ull, 9223372036854775337ull, 9223372036854775291ull, 9223372036854775279ull,
+		9223372036854775259ull, 9223372036854775181ull, 9223372036854775159ull, 9223372036854775139ull,
+		9223372036854775097ull, 9223372036854775073ull, 9223372036854775057ull, 9223372036854774959ull,
+		9223372036854774937ull, 9223372036854774917ull, 9223372036854774893ull, 9223372036854774797ull,
+		9223372036854774739ull, 9223372036854774713ull, 9223372036854774679ull, 9223372036854774629ull,
+		9223372036854774587ull, 9223372036854774571ull, 9223372036854774559ull, 9223372036854774511ull,
+		9223372036854774509ull, 9223372036854774499ull, 9223372036854774451ull, 9223372036854774413ull,
+		9223372036854774341ull, 9223372036854774319ull, 9223372036854774307ull, 9223372036854774277ull,
+		9223372036854774257ull, 9223372036854774247ull, 9223372036854774233ull, 9223372036854774199ull,
+		9223372036854774179ull, 9223372036854774173ull, 9223372036854774053ull, 9223372036854773999ull,
+		9223372036854773977ull, 9223372036854773953ull, 9223372036854773899ull, 9223372036854773867ull,
+		9223372036854773783ull, 9223372036854773639ull, 9223372036854773561ull, 9223372036854773557ull,
+		9223372036854773519ull, 9223372036854773507ull, 9223372036854773489ull, 9223372036854773477ull,
+		9223372036854773443ull, 9223372036854773429ull, 9223372036854773407ull, 9223372036854773353ull
+		};
+	};
+	template<>
+	struct LargestPrimes<64> {
+		static constexpr std::array<uint, 64> table = {
+		18446744073709551557ull, 18446744073709551533ull, 18446744073709551521ull, 18446744073709551437ull,
+		18446744073709551427ull, 18446744073709551359ull, 18446744073709551337ull, 18446744073709551293ull,
+		18446744073709551263ull, 18446744073709551253ull, 18446744073709551191ull, 18446744073709551163ull,
+		18446744073709551113ull, 18446744073709550873ull, 18446744073709550791ull, 18446744073709550773ull,
+		18446744073709550771ull, 18446744073709550719ull, 18446744073709550717ull, 18446744073709550681ull,
+		18446744073709550671ull, 18446744073709550593ull, 18446744073709550591ull, 18446744073709550539ull,
+		18446744073709550537ull, 18446744073709550381ull, 18446744073709550341ull, 18446744073709550293ull,
+		18446744073709550237ull, 18446744073709550147ull, 18446744073709550141ull, 18446744073709550129ull,
+		18446744073709550111ull, 18446744073709550099ull, 18446744073709550047ull, 18446744073709550033ull,
+		18446744073709550009ull, 18446744073709549951ull, 18446744073709549861ull, 18446744073709549817ull,
+		18446744073709549811ull, 18446744073709549777ull, 18446744073709549757ull, 18446744073709549733ull,
+		18446744073709549667ull, 18446744073709549621ull, 18446744073709549613ull, 18446744073709549583ull,
+		18446744073709549571ull, 18446744073709549519ull, 18446744073709549483ull, 18446744073709549441ull,
+		18446744073709549363ull, 18446744073709549331ull, 18446744073709549327ull, 18446744073709549307ull,
+		18446744073709549237ull, 18446744073709549153ull, 18446744073709549123ull, 18446744073709549067ull,
+		18446744073709549061ull, 18446744073709549019ull, 18446744073709548983ull, 18446744073709548899ull
+		};
+	};
+}
+
+/**
+ * This class enumerates the largest primes below 2^Bits in decreasing order, for example as moduli for modular algorithms.
+ *
+ * The first primes are taken from a precomputed table (for Bits = 32, 63 and 64), further primes are found with isPrime().
+ * In contrast to PrimeFactory, every instance only stores its own position and there is no shared state.
+ * Hence every thread can use its own instance without any locking.
+ */
+template<std::size_t Bits>
+class WordPrimeFactory {
+	static_assert(Bits > 2 && Bits <= 64, "Primes must fit into a machine word.");
+	using Table = detail::LargestPrimes<Bits>;
+	std::size_t mNext = 0;
+	uint mLast = 0;
+public:
+	/// Largest candidate, that is 2^Bits - 1.
+	static constexpr uint bound = (Bits == 64) ? ~uint(0) : (uint(1) << (Bits % 64)) - 1;
+
+	/// Returns the number of primes returned so far.
+	std::size_t size() const {
+		return mNext;
+	}
+	/// Computes the next prime, which is smaller than all primes returned before.
+	uint nextPrime() {
+		if (mNext < Table::table.size()) {
+			mLast = Table::table[mNext];
+		} else {
+			uint candidate = (mNext == 0) ? bound : mLast - 2;
+			while (!isPrime(candidate)) {
+				assert(candidate > 3);
+				candidate -= 2;
+			}
+			mLast = candidate;
+		}
+		++mNext;
+		return mLast;
+	}
+};
+
 }
@@ -16,6 +16,7 @@
 #include <cmath>
 #include <iterator>
 #include <list>
+#include <map>
 #include <queue>
 
 
@@ -41,6 +42,12 @@ private:
 	Eigen::MatrixXf mMatrix;
 	bool mNeedsUpdate = false;
 	
+	// the signs realized by polynomials that were not added, valid as long as no polynomial is added
+	std::map<Polynomial, std::list<SignCondition>> mSignsCache;
+	// decompositions of the Kronecker products of the adapted matrix of a new polynomial and mMatrix,
+	// indexed by the signs realized by the new polynomial (as bitmask) and valid as long as mMatrix is unchanged
+	std::map<uint, Eigen::PartialPivLU<Eigen::MatrixXf>> mDecompositions;
+	
 	
 	
 public:
@@ -61,7 +68,9 @@ public:
 		mAda(other.mAda),
 		mAdaHelper(other.mAdaHelper),
 		mMatrix(other.mMatrix),
-		mNeedsUpdate(other.mNeedsUpdate)
+		mNeedsUpdate(other.mNeedsUpdate),
+		mSignsCache(other.mSignsCache),
+		mDecompositions(other.mDecompositions)
 	{}
 	
 	uint sizeOfZeroSet() const {
@@ -271,6 +280,7 @@ private:
 		}
 		mAda = newAda;
 		mMatrix = adaptedMat(mAda, mSigns);
+		mDecompositions.clear();
 		CARL_LOG_ASSERT("carl.thom.sign", Eigen::FullPivLU<Eigen::MatrixXf>(mMatrix).rank() == mMatrix.cols(), "mMatrix must be invertible!");
 		mProducts = adaptedProducts;
 		mNeedsUpdate = false;
@@ -309,9 +319,10 @@ private:
 		int cpos = (taq1 + taq2) / 2; // ensured to be an exact division
 		int cneg = (taq2 - taq1) / 2;
 		// the order in which elements are added to currSigns is important
-		if(czer != 0) currSigns.emplace_back(1, Sign::ZERO);
-		if(cpos != 0) currSigns.emplace_back(1, Sign::POSITIVE);
-		if(cneg != 0) currSigns.emplace_back(1, Sign::NEGATIVE);
+		uint pattern = 0;
+		if(czer != 0) { currSigns.emplace_back(1, Sign::ZERO); pattern |= 1; }
+		if(cpos != 0) { currSigns.emplace_back(1, Sign::POSITIVE); pattern |= 2; }
+		if(cneg != 0) { currSigns.emplace_back(1, Sign::NEGATIVE); pattern |= 4; }
 		currAda = {{0}, {1}, {2}};
 		currAda.resize(currSigns.size());
 		currProducts.resize(currSigns.size());     
@@ -335,10 +346,13 @@ private:
 			index++;
 		}
 		
-		Eigen::MatrixXf M_prime = kroneckerProduct(currM, mMatrix);
-		CARL_LOG_ASSERT("carl.thom.sign", Eigen::FullPivLU<Eigen::MatrixXf>(M_prime).rank() == M_prime.cols(), "M_prime must be invertible!");
-		Eigen::PartialPivLU<Eigen::MatrixXf> dec(M_prime);
-		Eigen::VectorXf c = dec.solve(dprime);
+		auto dec = mDecompositions.find(pattern);
+		if(dec == mDecompositions.end()) {
+			Eigen::MatrixXf M_prime = kroneckerProduct(currM, mMatrix);
+			CARL_LOG_ASSERT("carl.thom.sign", Eigen::FullPivLU<Eigen::MatrixXf>(M_prime).rank() == M_prime.cols(), "M_prime must be invertible!");
+			dec = mDecompositions.emplace(pattern, Eigen::PartialPivLU<Eigen::MatrixXf>(M_prime)).first;
+		}
+		Eigen::VectorXf c = dec->second.solve(dprime);
 		CARL_LOG_ASSERT("carl.thom.sign", (uint)c.size() == currSigns.size() * mSigns.size(), "failure in sign determination");
 		
 		std::list<SignCondition> newSigns;
@@ -373,11 +387,17 @@ public:
 	 * MAIN INTERFACES
 	 */
 	std::list<SignCondition> getSigns(const Polynomial& p) {
+		auto it = mSignsCache.find(p);
+		if(it != mSignsCache.end()) {
+			CARL_LOG_TRACE("carl.thom.sign", "found signs of " << p << " in cache");
+			return it->second;
+		}
 		std::list<Polynomial> dummyProducts;
 		std::list<Alpha> dummyAda;
 		std::list<uint> dummyHelper;
 		Eigen::MatrixXf dummyMatrix;
 		std::list<SignCondition> newSigns = getSigns(p, dummyProducts, dummyAda, dummyHelper, dummyMatrix);
+		mSignsCache.emplace(p, newSigns);
 		return newSigns;
 	}
 	
@@ -388,9 +408,11 @@ public:
 		Eigen::MatrixXf newMatrix;
 		std::list<SignCondition> newSigns = getSigns(p, newProducts, newAda, newHelper, newMatrix);
 		mNeedsUpdate = true;
+		mSignsCache.clear();
 		if(mP.empty()) {
 			mAda = newAda;
 			mMatrix = newMatrix;
+			mDecompositions.clear();
 			mNeedsUpdate = false;
 		}
 		mP.push_front(p);
@@ -91,4 +91,81 @@ std::vector<Coeff> charPol(const CoeffMatrix<Coeff>& m) {
 	return res;
 }
 
+/*
+ * computes the signature (number of positive minus number of negative eigenvalues) of a symmetric matrix
+ * by a symmetric Gaussian elimination, which preserves the signature due to Sylvester's law of inertia.
+ * if all remaining diagonal entries vanish, a 2x2 block [[0, b], [b, 0]] with signature zero is eliminated instead.
+ * this yields the same as the sign variations of the characteristic polynomial, but only needs O(n^3) operations.
+ */
+template<typename Coeff>
+int signature(const CoeffMatrix<Coeff>& m) {
+	CARL_LOG_FUNC("carl.thom.tarski", "");
+	CARL_LOG_ASSERT("carl.thom.tarski", m.cols() == m.rows(), "can only compute signature of square matrix");
+	std::size_t n = std::size_t(m.cols());
+	// the remaining matrix, stored row by row
+	std::vector<Coeff> a(n * n);
+	for(std::size_t i = 0; i < n; i++) {
+		for(std::size_t j = 0; j < n; j++) {
+			a[i * n + j] = m(Eigen::Index(i), Eigen::Index(j));
+		}
+	}
+	std::vector<std::size_t> rows(n);
+	for(std::size_t i = 0; i < n; i++) rows[i] = i;
+	int res = 0;
+	while(!rows.empty()) {
+		std::size_t k = rows.size();
+		for(std::size_t i = 0; i < rows.size(); i++) {
+			if(!carl::isZero(a[rows[i] * n + rows[i]])) {
+				k = i;
+				break;
+			}
+		}
+		if(k < rows.size()) {
+			// eliminate with the pivot p = a_kk: a_ij -= a_ik * a_kj / p
+			std::size_t pk = rows[k];
+			Coeff pivot = a[pk * n + pk];
+			res += (pivot > 0) ? 1 : -1;
+			rows.erase(rows.begin() + long(k));
+			for(std::size_t i : rows) {
+				if(carl::isZero(a[i * n + pk])) continue;
+				Coeff factor = a[i * n + pk] / pivot;
+				for(std::size_t j : rows) {
+					if(!carl::isZero(a[pk * n + j])) a[i * n + j] -= factor * a[pk * n + j];
+				}
+			}
+			continue;
+		}
+		// all diagonal entries are zero, look for a nonzero entry a_kl
+		std::size_t l = rows.size();
+		for(std::size_t i = 0; i < rows.size() && l == rows.size(); i++) {
+			for(std::size_t j = i + 1; j < rows.size(); j++) {
+				if(!carl::isZero(a[rows[i] * n + rows[j]])) {
+					k = i;
+					l = j;
+					break;
+				}
+			}
+		}
+		// the remaining matrix is zero
+		if(l == rows.size()) break;
+		// eliminate with the block [[0, b], [b, 0]], whose inverse is [[0, 1/b], [1/b, 0]]:
+		// a_ij -= (a_ik * a_lj + a_il * a_kj) / b
+		std::size_t pk = rows[k];
+		std::size_t pl = rows[l];
+		Coeff b = a[pk * n + pl];
+		rows.erase(rows.begin() + long(l));
+		rows.erase(rows.begin() + long(k));
+		for(std::size_t i : rows) {
+			Coeff ik = a[i * n + pk] / b;
+			Coeff il = a[i * n + pl] / b;
+			if(carl::isZero(ik) && carl::isZero(il)) continue;
+			for(std::size_t j : rows) {
+				a[i * n + j] -= ik * a[pl * n + j] + il * a[pk * n + j];
+			}
+		}
+	}
+	CARL_LOG_TRACE("carl.thom.tarski", "signature = " << res);
+	return res;
+}
+
 } // namespace carl
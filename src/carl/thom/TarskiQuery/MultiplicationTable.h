@@ -8,6 +8,9 @@
 #pragma once
 
 #include "GroebnerBase.h"
+#include "CharPol.h"
+
+#include <vector>
 
 namespace carl {
 	
@@ -50,6 +53,9 @@ struct BaseRepresentation : public std::map<uint, Number> {
  * 
  * where the base representation is the monomial viewed as a linear combination of the basis
  * and index pairs stores a list of all pairs of basis elements whose product is equal to Monomial
+ *
+ * Additionally, the multiplication by every basis element is stored as a dense matrix, together with its trace.
+ * Multiplications, traces and Hermite matrices are computed on these contiguous arrays instead of looking up monomials.
  */
 template<typename Number>
 class MultiplicationTable {
@@ -74,6 +80,16 @@ private:
 	// the groebner base object is used to compute reductions
 	GroebnerBase<Number> mGb;
 	
+	// mMatrices[(k * N + j) * N + l] is the coefficient of base_l in base_k * base_j, where N is the size of the base,
+	// i.e. the N x N block starting at k * N * N is the matrix of the multiplication by base_k (stored column by column)
+	std::vector<Number> mMatrices;
+	
+	// mTraces[k] is the trace of the multiplication by base_k
+	std::vector<Number> mTraces;
+	
+	// mTraceMatrix[i * N + j] is the trace of the multiplication by base_i * base_j
+	std::vector<Number> mTraceMatrix;
+	
 public:
 	
 	MultiplicationTable() : mTable(), mBase(), mGb() {}
@@ -102,6 +118,16 @@ public:
 		return BaseRepresentation<Number>(mBase, mGb.reduce(p));
 	}
 	
+	// the multiplication matrix of base_k: the coefficient of base_l in base_k * base_j is at index j * N + l
+	const Number* multiplicationMatrix(uint k) const {
+		assert(k < mBase.size());
+		return mMatrices.data() + std::size_t(k) * mBase.size() * mBase.size();
+	}
+	
+	const std::vector<Number>& traces() const noexcept {
+		return mTraces;
+	}
+	
 	const TableContent& getEntry(const Monomial& mon) const {
 		auto it = mTable.find(mon);
 		assert(it != mTable.end());
@@ -117,19 +143,21 @@ public:
 	}
 	
 	BaseRepresentation<Number> multiply(const BaseRepresentation<Number>& f, const BaseRepresentation<Number>& g) const {
-		BaseRepresentation<Number> res;
-		for(const auto& entry : this->mTable) {
-			if(entry.second.br.isZero()) continue;
-			for(const auto& index_coeff : entry.second.br) {
-				Number newCoeff(0);
-				for(const auto& pair : entry.second.pairs) {
-					newCoeff += f.get(pair.first) * g.get(pair.second);
-				}
-				if(newCoeff != 0) {
-					res[index_coeff.first] += newCoeff * index_coeff.second;
+		std::size_t n = mBase.size();
+		std::vector<Number> dense(n, Number(0));
+		for(const auto& f_k : f) {
+			for(const auto& g_j : g) {
+				Number c = f_k.second * g_j.second;
+				const Number* column = multiplicationMatrix(f_k.first) + std::size_t(g_j.first) * n;
+				for(std::size_t l = 0; l < n; l++) {
+					if(!carl::isZero(column[l])) dense[l] += c * column[l];
 				}
 			}
 		}
+		BaseRepresentation<Number> res;
+		for(uint l = 0; l < n; l++) {
+			if(!carl::isZero(dense[l])) res.emplace_hint(res.end(), l, dense[l]);
+		}
 		return res;
 	}
 	
@@ -137,11 +165,37 @@ public:
 	Number trace(const BaseRepresentation<Number>& f) const {
 		Number res(0);
 		for(const auto& index_coeff : f) {
-			for(uint i = 0; i < mBase.size(); i++) {
-				Monomial prod = mBase[index_coeff.first] * mBase[i];
-				BaseRepresentation<Number> prod_br = this->getEntry(prod).br;
-				res += index_coeff.second * prod_br.get(i);
-			}		   
+			res += index_coeff.second * mTraces[index_coeff.first];
+		}
+		return res;
+	}
+	
+	/*
+	 * computes the Hermite matrix of q, i.e. the matrix of the traces of the multiplications by q * base_i * base_j
+	 * the trace is linear, hence with u_l = trace(q * base_l) = sum_k q_k trace(base_k * base_l)
+	 * the entries are trace(q * base_i * base_j) = sum_l coefficient of base_l in (base_i * base_j) * u_l
+	 */
+	CoeffMatrix<Number> hermiteMatrix(const BaseRepresentation<Number>& q) const {
+		std::size_t n = mBase.size();
+		std::vector<Number> u(n, Number(0));
+		for(const auto& q_k : q) {
+			const Number* row = mTraceMatrix.data() + std::size_t(q_k.first) * n;
+			for(std::size_t l = 0; l < n; l++) {
+				u[l] += q_k.second * row[l];
+			}
+		}
+		CoeffMatrix<Number> res(n, n);
+		for(std::size_t i = 0; i < n; i++) {
+			const Number* matrix = multiplicationMatrix(uint(i));
+			for(std::size_t j = i; j < n; j++) {
+				const Number* column = matrix + j * n;
+				Number t(0);
+				for(std::size_t l = 0; l < n; l++) {
+					if(!carl::isZero(column[l])) t += column[l] * u[l];
+				}
+				res(Eigen::Index(i), Eigen::Index(j)) = t;
+				res(Eigen::Index(j), Eigen::Index(i)) = t;
+			}
 		}
 		return res;
 	}
@@ -151,18 +205,39 @@ public:
 	
 private:
 	
-	// returns a list of all pairs of indicdes (i,j) such that base_i * base_j == c
-	IndexPairs indexPairs(const Monomial& c) const {
-		IndexPairs res;
-		for(uint i = 0; i < mBase.size(); i++) {
-			for(uint j = i; j < mBase.size(); j++) {
-				if(mBase[i] * mBase[j] == c) {
-					res.push_front(std::make_pair(i, j));
-					if(i != j) res.push_front(std::make_pair(j, i));
+	// fills the index pairs and the dense multiplication matrices, once the normal forms of all products are known
+	void initMatrices() {
+		std::size_t n = mBase.size();
+		mMatrices.assign(n * n * n, Number(0));
+		for(uint i = 0; i < n; i++) {
+			for(uint j = i; j < n; j++) {
+				auto it = mTable.find(mBase[i] * mBase[j]);
+				assert(it != mTable.end());
+				if(it->second.br.isZero()) continue;
+				it->second.pairs.push_front(std::make_pair(i, j));
+				if(i != j) it->second.pairs.push_front(std::make_pair(j, i));
+				for(const auto& index_coeff : it->second.br) {
+					mMatrices[(i * n + j) * n + index_coeff.first] = index_coeff.second;
+					mMatrices[(j * n + i) * n + index_coeff.first] = index_coeff.second;
+				}
+			}
+		}
+		mTraces.assign(n, Number(0));
+		for(uint k = 0; k < n; k++) {
+			const Number* matrix = multiplicationMatrix(k);
+			for(std::size_t j = 0; j < n; j++) {
+				mTraces[k] += matrix[j * n + j];
+			}
+		}
+		mTraceMatrix.assign(n * n, Number(0));
+		for(uint i = 0; i < n; i++) {
+			const Number* matrix = multiplicationMatrix(i);
+			for(std::size_t j = 0; j < n; j++) {
+				for(std::size_t l = 0; l < n; l++) {
+					if(!carl::isZero(matrix[j * n + l])) mTraceMatrix[i * n + j] += matrix[j * n + l] * mTraces[l];
 				}
 			}
 		}
-		return res;
 	}
 	
 	void init(const GroebnerBase<Number>& gb) {
@@ -186,7 +261,7 @@ private:
 		for(uint i = 0; i < Mon.size(); i++) {
 			BaseRepresentation<Number> baseRepr;
 			baseRepr[i] = Number(1); 
-			mTable[Mon[i]] = {baseRepr, indexPairs(Mon[i])};
+			mTable[Mon[i]] = {baseRepr, IndexPairs()};
 		}
 		
 		// ---- step 1 ----
@@ -207,11 +282,7 @@ private:
 				MultivariatePolynomial<Number> diff = G.stripLT();
 				diff *= Number(-1);
 				BaseRepresentation<Number> baseRepr(mBase, diff);
-				IndexPairs pairs;
-				if(!baseRepr.isZero()) {
-					pairs = indexPairs(m);
-				}
-				mTable[m] = {baseRepr, pairs};
+				mTable[m] = {baseRepr, IndexPairs()};
 				//CARL_LOG_TRACE("carl.thom.tarski", "mTable = " << mTable);			     
 			}
 			else {
@@ -249,12 +320,8 @@ private:
 						sum += prod;
 					}
 				}
-				IndexPairs pairs;
 				BaseRepresentation<Number> baseRepr(mBase, sum);
-				if(!baseRepr.isZero()) {
-					pairs = indexPairs(m);
-				}
-				mTable[m] = {baseRepr, pairs};
+				mTable[m] = {baseRepr, IndexPairs()};
 			}
 		}
 		
@@ -264,32 +331,22 @@ private:
 		// ---- step 3 ----
 		// find the normal forms of all other elements in Tab(Mon)
 		// Tab(Mon) = set of products of elements from Mon
-		std::list<Monomial> tabmon;
-		for(const auto& m1 : Mon) {
-			for(const auto& m2 : Mon) {
-				Monomial prod = m1 * m2;
-				if(std::find(tabmon.begin(), tabmon.end(), prod) == tabmon.end()) {
-					tabmon.push_back(prod);
-				}				
-			}
-		}
-		CARL_LOG_TRACE("carl.thom.tarski", "tabmon = " << tabmon);
-		for(const auto& m : tabmon) {
-			if(!this->contains(m)) {
+		for(uint i = 0; i < Mon.size(); i++) {
+			for(uint j = i; j < Mon.size(); j++) {
+				Monomial m = Mon[i] * Mon[j];
+				if(this->contains(m)) continue;
 				// we do not have the normal form of m yet
 				CARL_LOG_TRACE("carl.thom.tarski.table", "still to compute: normal form for " << m);
 				
 				// make it easy here and use groebner reduce
 				MultivariatePolynomial<Number> nf_m = mGb.reduce(MultivariatePolynomial<Number>(m));
 				
-				IndexPairs pairs;
 				BaseRepresentation<Number> baseRepr(mBase, nf_m);
-				if(!baseRepr.isZero()) {
-					pairs = indexPairs(m);
-				}
-				mTable[m] = {baseRepr, pairs};
+				mTable[m] = {baseRepr, IndexPairs()};
 			}
 		}
+		
+		initMatrices();
 	}
 };
 
@@ -0,0 +1,193 @@
+/*
+ * File:   ThomCache.h
+ */
+
+#pragma once
+
+#include "SignDetermination/SignDetermination.h"
+#include "ThomUtil.h"
+#include "../config.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace carl {
+
+template<typename Number>
+class ThomEncoding;
+
+/*
+ * Data that is shared by all Thom encodings of the roots of the same polynomial.
+ *
+ * The roots of a polynomial p over some point are determined by the zero set of p and the polynomials defining the point.
+ * Setting up the sign determination on this zero set (that is computing a multiplication table, the Tarski queries of the
+ * derivatives of p and the adapted matrices) only depends on these polynomials. Hence it is done only once and shared by all encodings:
+ * - the derivatives p, p', ..., p^(deg p) w.r.t. the main variable,
+ * - the sign determination object, which memoises the Tarski queries, the adapted matrices and the signs realized by polynomials on the zero set,
+ * - the sign conditions realized by the derivatives on the zero set, i.e. the encodings of all roots of p.
+ *
+ * Caches are obtained via get() and are kept as long as some encoding refers to them.
+ * As a cache is shared by encodings in different threads, the sign determination object is only accessed via
+ * getSigns(), processedPolynomials() and sd(), which lock the cache if carl is built with THREAD_SAFE.
+ */
+template<typename Number>
+class ThomCache {
+
+	using Polynomial = MultivariatePolynomial<Number>;
+	using Key = std::pair<std::vector<Polynomial>, std::vector<Variable>>;
+
+	/// The zero set, starting with the defining polynomial.
+	std::vector<Polynomial> mZeroSet;
+	/// The main variables of the polynomials in the zero set.
+	std::vector<Variable> mVariables;
+	/// p^(0), ..., p^(deg p)
+	std::vector<Polynomial> mDerivatives;
+	std::shared_ptr<SignDetermination<Number>> mSd;
+	/// Sign conditions realized on the zero set, one for every root.
+	std::list<SignCondition> mSigns;
+	/// Number of derivatives of p in the sign conditions.
+	uint mRelevant = 0;
+#ifdef THREAD_SAFE
+	/// Protects mSd, whose queries memoise their results.
+	mutable std::mutex mMutex;
+	#define THOMCACHE_LOCK_GUARD std::lock_guard<std::mutex> lock(mMutex);
+#else
+	#define THOMCACHE_LOCK_GUARD
+#endif
+
+	static std::map<Key, std::weak_ptr<ThomCache<Number>>>& registry() {
+		static std::map<Key, std::weak_ptr<ThomCache<Number>>> caches;
+		return caches;
+	}
+#ifdef THREAD_SAFE
+	static std::mutex& registryMutex() {
+		static std::mutex mutex;
+		return mutex;
+	}
+#endif
+
+public:
+	/*
+	 * Sets up the sign determination on the given zero set.
+	 * point is the point the roots are lifted over (or nullptr) and must be defined by the remaining polynomials of the zero set.
+	 */
+	ThomCache(std::vector<Polynomial> zeroSet, std::vector<Variable> variables, const ThomEncoding<Number>* point):
+		mZeroSet(std::move(zeroSet)),
+		mVariables(std::move(variables))
+	{
+		assert(mZeroSet.size() == mVariables.size());
+		const Polynomial& p = mZeroSet.front();
+		std::list<Polynomial> derivatives = der(p, mainVar(), 0, p.degree(mainVar()));
+		mDerivatives.assign(derivatives.begin(), derivatives.end());
+		mSd = std::make_shared<SignDetermination<Number>>(mZeroSet.begin(), mZeroSet.end());
+
+		uint numOfRoots = mSd->sizeOfZeroSet();
+		if(numOfRoots == 0) return;
+		if(point != nullptr) {
+			const auto pointDerivatives = point->cache().processedPolynomials();
+			mSd->getSignsAndAddAll(pointDerivatives.rbegin(), pointDerivatives.rend());
+		}
+		auto it = mDerivatives.rbegin();
+		while(mSigns.size() < numOfRoots) {
+			mSigns = mSd->getSignsAndAdd(*it);
+			it++;
+			mRelevant++;
+		}
+	}
+
+	/*
+	 * Returns the cache for the given zero set, which is created if no encoding refers to such a cache.
+	 * The zero set and its main variables start with the defining polynomial, followed by those of the point.
+	 */
+	static std::shared_ptr<ThomCache<Number>> get(const std::vector<Polynomial>& zeroSet, const std::vector<Variable>& variables, const ThomEncoding<Number>* point = nullptr) {
+		Key key(zeroSet, variables);
+		{
+#ifdef THREAD_SAFE
+			std::lock_guard<std::mutex> lock(registryMutex());
+#endif
+			auto it = registry().find(key);
+			if(it != registry().end()) {
+				if(auto res = it->second.lock()) {
+					CARL_LOG_TRACE("carl.thom.cache", "found cache for " << zeroSet);
+					return res;
+				}
+			}
+		}
+		auto res = std::make_shared<ThomCache<Number>>(zeroSet, variables, point);
+#ifdef THREAD_SAFE
+		std::lock_guard<std::mutex> lock(registryMutex());
+#endif
+		// drop caches that are not used anymore
+		for(auto it = registry().begin(); it != registry().end(); ) {
+			if(it->second.expired()) it = registry().erase(it);
+			else it++;
+		}
+		registry()[key] = res;
+		return res;
+	}
+
+	/*
+	 * Number of caches that are currently in use.
+	 */
+	static std::size_t size() {
+#ifdef THREAD_SAFE
+		std::lock_guard<std::mutex> lock(registryMutex());
+#endif
+		std::size_t res = 0;
+		for(const auto& entry : registry()) {
+			if(!entry.second.expired()) res++;
+		}
+		return res;
+	}
+
+	const Polynomial& polynomial() const { return mZeroSet.front(); }
+	const std::vector<Polynomial>& zeroSet() const { return mZeroSet; }
+	Variable::Arg mainVar() const { return mVariables.front(); }
+	/*
+	 * A copy of the sign determination object.
+	 */
+	SignDetermination<Number> sd() const {
+		THOMCACHE_LOCK_GUARD
+		return *mSd;
+	}
+	/*
+	 * Sign conditions realized by the derivatives processed so far and p on the zero set, see SignDetermination::getSigns().
+	 */
+	std::list<SignCondition> getSigns(const Polynomial& p) const {
+		THOMCACHE_LOCK_GUARD
+		return mSd->getSigns(p);
+	}
+	/*
+	 * The polynomials processed by the sign determination.
+	 */
+	std::list<Polynomial> processedPolynomials() const {
+		THOMCACHE_LOCK_GUARD
+		return mSd->processedPolynomials();
+	}
+	const std::list<SignCondition>& signs() const { return mSigns; }
+	uint relevant() const { return mRelevant; }
+
+	/*
+	 * the n'th derivative of the polynomial w.r.t. the main variable
+	 */
+	const Polynomial& derivative(uint n) const {
+		assert(n < mDerivatives.size());
+		return mDerivatives[n];
+	}
+
+	/*
+	 * list of derivatives p^(from), ..., p^(upto), as computed by der()
+	 */
+	std::list<Polynomial> derivatives(uint from, uint upto) const {
+		assert(upto < mDerivatives.size());
+		if(from > upto) return {};
+		return std::list<Polynomial>(mDerivatives.begin() + from, mDerivatives.begin() + upto + 1);
+	}
+
+}; // class ThomCache
+
+#undef THOMCACHE_LOCK_GUARD
+
+} // namespace carl
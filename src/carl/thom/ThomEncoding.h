@@ -8,6 +8,7 @@
 #pragma once
 
 #include "SignDetermination/SignDetermination.h"
+#include "ThomCache.h"
 #include "ThomRootFinder.h"
 
 // some settings
@@ -26,7 +27,8 @@ class ThomEncoding {
 	Variable mMainVar;
 	
 	std::shared_ptr<ThomEncoding<Number>> mPoint;
-	mutable std::shared_ptr<SignDetermination<Number>> mSd;
+	// shared by all encodings of roots of mP over the same point
+	std::shared_ptr<ThomCache<Number>> mCache;
 	
 	uint mRelevant;
 	
@@ -37,14 +39,14 @@ public:
 		const Polynomial& p,
 		Variable mainVar,
 		std::shared_ptr<ThomEncoding<Number>> point, 
-		std::shared_ptr<SignDetermination<Number>> sd,
+		std::shared_ptr<ThomCache<Number>> cache,
 		uint mRelevant
 	):
 		mSc(std::move(sc)),
 		mP(p),
 		mMainVar(mainVar),
 		mPoint(std::move(point)),
-		mSd(std::move(sd)),
+		mCache(std::move(cache)),
 		mRelevant(mRelevant)
 	{}
 		
@@ -60,7 +62,7 @@ public:
 		CARL_LOG_ASSERT("carl.thom", roots.size() == 1, "");
 		mSc = roots.front().mSc;
 		mP = roots.front().mP;
-		mSd = roots.front().mSd;
+		mCache = roots.front().mCache;
 		mRelevant = roots.front().mRelevant;      
 	}
 	
@@ -79,7 +81,7 @@ public:
 				mP = r.mP;
 				mMainVar = r.mMainVar;
 				mPoint = r.mPoint;
-				mSd = r.mSd;
+				mCache = r.mCache;
 				mRelevant = r.mRelevant;
 				return;
 			}
@@ -112,13 +114,12 @@ public:
 	inline Variable::Arg mainVar() const { return mMainVar; }
 	inline const Polynomial& polynomial() const { return mP; } 
 	inline const ThomEncoding<Number>& point() const {assert(mPoint); return *mPoint; }
-	inline SignDetermination<Number> sd() const {assert(mSd); return *mSd; }
+	inline SignDetermination<Number> sd() const {assert(mCache); return mCache->sd(); }
+	inline const ThomCache<Number>& cache() const {assert(mCache); return *mCache; }
 	
 	std::list<Polynomial> relevantDerivatives() const {
-		std::list<Polynomial> derivatives = der(mP, mMainVar, 0, mP.degree(mMainVar));
-		std::reverse(derivatives.begin(), derivatives.end());
-		derivatives.resize(mRelevant);
-		std::reverse(derivatives.begin(), derivatives.end());
+		uint deg = mP.degree(mMainVar);
+		std::list<Polynomial> derivatives = mCache->derivatives(deg + 1 - mRelevant, deg);
 		assert(derivatives.size() == mRelevant);
 		return derivatives;
 	}
@@ -166,7 +167,7 @@ public:
 		CARL_LOG_ASSERT("carl.thom", p.gatherVariables().size() <= this->dimension(), "\np = " << p << "\nthis = " << *this);
 		if(carl::isZero(p)) return Sign(0);
 		if(p.isConstant()) return Sign(carl::sgn(p.lcoeff()));
-		std::list<SignCondition> signs = mSd->getSigns(p);
+		std::list<SignCondition> signs = mCache->getSigns(p);
 		SignCondition relevant = accumulateRelevantSigns();
 		for(const auto& sigma : signs) {
 			if(relevant.isSuffixOf(sigma)) return sigma.front();
@@ -195,7 +196,7 @@ public:
 			mSc.push_front(Sign::ZERO);
 			return;
 		}
-		Polynomial derivative = der(mP, mMainVar, 1, mP.degree(mMainVar) - mSc.size()).back();
+		const Polynomial& derivative = mCache->derivative(mP.degree(mMainVar) - mSc.size());
 		mSc.push_front(this->signOnPolynomial(derivative));
 	}
 
@@ -543,7 +544,7 @@ public:
 		os << "polynomial:\t\t\t" << mP << std::endl;
 		os << "main variable: \t\t\t" << mMainVar  << std::endl;
 		os << "point below:\t\t\t" << mPoint << std::endl;
-		os << "sign determination obejct:\t" << mSd << std::endl;
+		os << "cache:\t\t\t\t" << mCache << std::endl;
 		os << "dimension:\t\t\t" << dimension() << std::endl;
 		os << "---------------------------------------------------" << std::endl;
 	}
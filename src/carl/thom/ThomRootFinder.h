@@ -126,28 +126,14 @@ std::list<ThomEncoding<Number>> realRootsThom(
         
         
         if(point_ptr == nullptr) {
-                std::list<Polynomial> derivatives = der(p, mainVar, 1, p.degree(mainVar));
-                
-                std::vector<Polynomial> zeroSet = {p};
-                SignDetermination<Number> sd(zeroSet.begin(), zeroSet.end());
-                
-                uint numOfRoots = sd.sizeOfZeroSet();
-                if(numOfRoots == 0) return {};
-                
-                std::list<SignCondition> signs = {};
-                auto it = derivatives.rbegin();
-                while(signs.size() < numOfRoots) {
-                        signs = sd.getSignsAndAdd(*it);
-                        it++;
-                }
-                std::shared_ptr<SignDetermination<Number>> sd_ptr = std::make_shared<SignDetermination<Number>>(sd);
-                for(const auto& sigma : signs) {
+                std::shared_ptr<ThomCache<Number>> cache = ThomCache<Number>::get({p}, {mainVar});
+                for(const auto& sigma : cache->signs()) {
                         ThomEncoding<Number> newEncoding(
                                 sigma,
                                 p,
                                 mainVar,
                                 nullptr,
-                                sd_ptr,
+                                cache,
                                 sigma.size());
                         result.push_back(newEncoding);
                 }
@@ -161,28 +147,17 @@ std::list<ThomEncoding<Number>> realRootsThom(
                 
                 std::list<Polynomial> zeroSet = point_ptr->accumulatePolynomials();
                 zeroSet.push_front(p);
+                std::list<Variable> vars = point_ptr->accumulateVariables();
+                vars.push_front(mainVar);
 
-                SignDetermination<Number> sd(zeroSet.begin(), zeroSet.end());
-                uint numOfRoots = sd.sizeOfZeroSet();
-                if(numOfRoots == 0) return {};
-                
-                std::list<Polynomial> pointDerivatives = point_ptr->sd().processedPolynomials();
-                sd.getSignsAndAddAll(pointDerivatives.rbegin(), pointDerivatives.rend());
-                
-                std::list<Polynomial> pDerivatives = der(p, mainVar, 1, p.degree(mainVar));
-                
-                std::list<SignCondition> signs = {};
-                uint relevant = 0;
-                auto it = pDerivatives.rbegin();
-                while(signs.size() < numOfRoots) {
-                        signs = sd.getSignsAndAdd(*it);
-                        it++;
-                        relevant++;
-                }
+                std::shared_ptr<ThomCache<Number>> cache = ThomCache<Number>::get(
+                        std::vector<Polynomial>(zeroSet.begin(), zeroSet.end()),
+                        std::vector<Variable>(vars.begin(), vars.end()),
+                        point_ptr.get());
+                uint relevant = cache->relevant();
                 
-                std::shared_ptr<SignDetermination<Number>> sd_ptr = std::make_shared<SignDetermination<Number>>(sd);
                 SignCondition pointSigns = point_ptr->accumulateRelevantSigns();
-                for(const auto& sigma : signs) {
+                for(const auto& sigma : cache->signs()) {
                         CARL_LOG_ASSERT("carl.thom.rootfinder", sigma.size() == pointSigns.size() + relevant, "");
                         if(pointSigns.isSuffixOf(sigma)) {
                                 SignCondition newSigma(sigma);
@@ -192,7 +167,7 @@ std::list<ThomEncoding<Number>> realRootsThom(
                                         p,
                                         mainVar,
                                         point_ptr,
-                                        sd_ptr,
+                                        cache,
                                         relevant
                                 );
                                 result.push_back(newEncoding);
@@ -8,11 +8,17 @@
 #pragma once
 
 #include "Common.h"
+#include "../config.h"
 
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <cstdint>
 #include <limits>
 #include <mutex>
+#include <shared_mutex>
 #include <stack>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -43,6 +49,27 @@ namespace carl
     template<typename T>
     void doNothing( const T& /*unused*/, const T& /*unused*/) {}
    
+    /**
+     * A cache storing objects of type T, which are referenced from outside by a Ref.
+     * 
+     * T must provide the methods getHash() and rehash(), an equality operator and an output operator.
+     * If a memory limit is given, T must also provide
+     *  - std::size_t memoryUsage() const: an estimate of the memory used by the object in bytes,
+     *  - std::size_t releaseMemory() const: releases data of the object which can be recomputed, and returns the estimated number of bytes released,
+     *  - bool referencesItself() const: whether the object itself uses its own entry once, as a polynomial which is its own factor, and
+     *  - void releaseSelfReference() const: removes this usage before the entry is removed.
+     * 
+     * If the estimated memory of all entries exceeds the memory limit when an object is cached, entries are evicted by the CLOCK algorithm:
+     * Every entry has a reference bit, which is set whenever the entry is cached, registered or strengthened.
+     * The clock hand sweeps over the entries and clears set reference bits. Entries whose bit is already cleared are cold:
+     * they are removed if they are not used except by themselves, otherwise releaseMemory() is called on them.
+     * The sweep stops as soon as the memory usage is below (1 - cacheReductionAmount) times the memory limit,
+     * or after two rounds if the memory is mostly used by data which can not be released.
+     * Note that objects obtained by get() may hence release some of their data when another object is cached.
+     * 
+     * If carl is built with THREAD_SAFE, inserting, rehashing and removing entries locks the whole cache. Registering, deregistering and strengthening 
+     * entries only locks it shared and additionally locks one of several stripes, such that these operations do not serialise if they are applied concurrently.
+     */
     template<typename T>
     class Cache {
         
@@ -66,14 +93,40 @@ namespace carl
              * is involved in computations in the recent past.
              */
             double activity;
+            
+            /**
+             * The reference bit of the CLOCK eviction, which states whether the entry has been accessed since the clock hand passed it.
+             */
+            bool referenced;
+            
+            /**
+             * The estimated memory in bytes of the entry, as it is accounted in the memory usage of the cache.
+             */
+            std::size_t memory;
 
             explicit Info( double _activity ):
                 usageCount(0),
                 refStoragePositions(),
-                activity(_activity)
+                activity(_activity),
+                referenced(true),
+                memory(0)
             {}
         };
         
+        /**
+         * Counters of the operations of the cache.
+         */
+        struct Statistics {
+            /// The number of objects to cache, for which an equal object has already been cached.
+            std::size_t hits = 0;
+            /// The number of objects to cache, which have been newly cached.
+            std::size_t misses = 0;
+            /// The number of entries which have been removed from the cache.
+            std::size_t evictions = 0;
+            /// The number of times an entry which is still used released memory.
+            std::size_t releases = 0;
+        };
+        
         using Container = std::unordered_set<TypeInfoPair<T,Info>*, pointerHash<TypeInfoPair<T,Info>>, pointerEqual<TypeInfoPair<T,Info>>>;
         
     private:
@@ -87,7 +140,7 @@ namespace carl
         /**
          * The current number of entries in the cache, which are not used.
          */
-        std::size_t mNumOfUnusedEntries = 0;
+        std::atomic<std::size_t> mNumOfUnusedEntries;
         
         /**
          * The percentage of the cache, which shall be removed at best, if the cache size exceeds the threshold. (NOT YET USED)
@@ -97,7 +150,7 @@ namespace carl
         /**
          * The threshold for the maximum activity. In case it is exceeded, all activities are rescaled.
          */
-        double mMaxActivity = 0.0;
+        std::atomic<double> mMaxActivity;
         
         /**
          * The reciprocal of the factor to multiply an activity with in order to increase it. 
@@ -122,9 +175,96 @@ namespace carl
         double mActivityDecrementFactor = 1e-100;
         
         /**
-         * A mutex for situation where any member is changed. TODO: Refine the locking-situations. 
+         * The threshold for the estimated memory of all entries in bytes, which should not be exceeded. Zero means no threshold.
+         */
+        std::size_t mMaxMemory;
+        
+        /**
+         * The estimated memory of all entries in bytes.
+         */
+        std::size_t mMemoryUsage = 0;
+        
+        /**
+         * The reference at which the clock hand of the CLOCK eviction currently points.
+         */
+        Ref mClockHand = 0;
+        
+        /**
+         * The counters of the operations of this cache.
+         */
+        Statistics mStatistics;
+        
+        #ifdef THREAD_SAFE
+        /**
+         * Lock of the structure of the cache, that is of all members except of the usage counters, the activities and the reference bits of the entries.
+         * It can be locked exclusively or shared. The exclusive lock is recursive, as removing an entry deletes its object, which can deregister other entries.
+         * A thread holding the exclusive lock also obtains the shared lock immediately.
+         */
+        class StructureMutex {
+            std::shared_mutex mMutex;
+            std::atomic<std::thread::id> mOwner{ std::thread::id() };
+            std::size_t mDepth = 0;
+        public:
+            bool ownedByThisThread() const {
+                return mOwner.load( std::memory_order_relaxed ) == std::this_thread::get_id();
+            }
+            void lock() {
+                if( !ownedByThisThread() )
+                {
+                    mMutex.lock();
+                    mOwner.store( std::this_thread::get_id(), std::memory_order_relaxed );
+                }
+                ++mDepth;
+            }
+            void unlock() {
+                assert( ownedByThisThread() && mDepth > 0 );
+                if( --mDepth == 0 )
+                {
+                    mOwner.store( std::thread::id(), std::memory_order_relaxed );
+                    mMutex.unlock();
+                }
+            }
+            void lock_shared() {
+                if( ownedByThisThread() )
+                    ++mDepth;
+                else
+                    mMutex.lock_shared();
+            }
+            void unlock_shared() {
+                if( ownedByThisThread() )
+                    unlock();
+                else
+                    mMutex.unlock_shared();
+            }
+        };
+        
+        /**
+         * The lock of the structure of the cache.
+         */
+        mutable StructureMutex mMutex;
+        
+        /**
+         * The number of stripes locking the usage counters, the activities and the reference bits of the entries.
+         */
+        static constexpr std::size_t NUM_STRIPES = 16;
+        
+        struct alignas(64) Stripe {
+            std::mutex mMutex;
+        };
+        
+        /**
+         * The stripes, where the stripe of an entry is determined by its address.
          */
-        std::recursive_mutex mMutex;
+        mutable std::array<Stripe, NUM_STRIPES> mStripes;
+        
+        #define CACHE_LOCK_GUARD std::lock_guard<StructureMutex> lock( mMutex );
+        #define CACHE_SHARED_LOCK_GUARD std::shared_lock<StructureMutex> lock( mMutex );
+        #define CACHE_STRIPE_LOCK_GUARD(entry) std::lock_guard<std::mutex> stripeLock( stripe( entry ) );
+        #else
+        #define CACHE_LOCK_GUARD
+        #define CACHE_SHARED_LOCK_GUARD
+        #define CACHE_STRIPE_LOCK_GUARD(entry)
+        #endif
         
         /**
          *  The container storing all cached entries. It maps the objects to store to cache information, which cover a usage counter, 
@@ -144,8 +284,14 @@ namespace carl
 
         static const Ref NO_REF;
 
-        // The constructor.
-        explicit Cache( size_t _maxCacheSize = 10000, double _cacheReductionAmount = 0.2, double _decay = 0.98 );
+        /**
+         * The constructor.
+         * @param _maxCacheSize The threshold for the number of entries.
+         * @param _cacheReductionAmount The part of the memory limit, which is freed when the memory limit is exceeded.
+         * @param _decay The decay of the activities.
+         * @param _maxMemory The threshold for the estimated memory of all entries in bytes. Zero means no threshold.
+         */
+        explicit Cache( size_t _maxCacheSize = 10000, double _cacheReductionAmount = 0.2, double _decay = 0.98, std::size_t _maxMemory = 0 );
         Cache( const Cache& ) = delete; // no implementation
         Cache& operator=( const Cache& ) = delete; // no implementation
 
@@ -162,6 +308,19 @@ namespace carl
          */
         std::pair<Ref,bool> cache( T* _toCache, bool (*_canBeUpdated)( const T&, const T& ) = &returnFalse<T>, void (*_update)( const T&, const T& ) = &doNothing<T> );
         
+        /**
+         * Caches the given object and registers its entry, such that the entry cannot be removed by another thread in between.
+         * @param _toCache The object to cache.
+         * @return The reference of the entry and whether the entry is new, as returned by cache().
+         */
+        std::pair<Ref,bool> cacheAndReg( T* _toCache )
+        {
+            CACHE_LOCK_GUARD
+            auto ret = cache( _toCache );
+            reg( ret.first );
+            return ret;
+        }
+        
         /**
          * Registers the entry to the given reference. It mainly increases the usage counter of this entry in the cache.
          * @param _refStoragePos The reference of the entry to register.
@@ -198,12 +357,39 @@ namespace carl
          */
         void print( std::ostream& _out = std::cout ) const;
         
+        /**
+         * @return The counters of the operations of this cache.
+         */
+        Statistics statistics() const
+        {
+            CACHE_LOCK_GUARD
+            return mStatistics;
+        }
+        
+        /**
+         * @return The estimated memory of all entries in bytes.
+         */
+        std::size_t memoryUsage() const
+        {
+            CACHE_LOCK_GUARD
+            return mMemoryUsage;
+        }
+        
+        /**
+         * @return The threshold for the estimated memory of all entries in bytes. Zero means no threshold.
+         */
+        std::size_t maxMemory() const
+        {
+            return mMaxMemory;
+        }
+        
         /**
          * @param _refStoragePos The reference of the entry to obtain the object from. 
          * @return The object in the entry with the given reference.
          */
         const T& get( Ref _refStoragePos ) const
         {
+            CACHE_SHARED_LOCK_GUARD
             assert( _refStoragePos < mCacheRefs.size() );
             assert( mCacheRefs[_refStoragePos] != nullptr );
             assert( mCacheRefs[_refStoragePos]->second.usageCount > 0 );
@@ -217,6 +403,37 @@ namespace carl
          */
         void clean();
         
+        /**
+         * Evicts cold entries by the CLOCK algorithm until the memory usage is sufficiently below the memory limit.
+         * Must be called while holding the exclusive lock.
+         */
+        void evict();
+        
+        #ifdef THREAD_SAFE
+        /**
+         * @param _entry An entry of the cache.
+         * @return The mutex of the stripe of the given entry.
+         */
+        std::mutex& stripe( const TypeInfoPair<T,Info>* _entry ) const
+        {
+            return mStripes[(reinterpret_cast<std::uintptr_t>( _entry ) / sizeof( TypeInfoPair<T,Info> )) % NUM_STRIPES].mMutex;
+        }
+        #endif
+        
+        /**
+         * Updates the estimated memory of the given entry and of the cache.
+         * Must be called while holding the exclusive lock, if a memory limit is given.
+         * @param _entry The entry to update the memory for.
+         */
+        void updateMemory( TypeInfoPair<T,Info>* _entry )
+        {
+            if( mMaxMemory == 0 )
+                return;
+            std::size_t memory = _entry->first->memoryUsage();
+            mMemoryUsage = mMemoryUsage - _entry->second.memory + memory;
+            _entry->second.memory = memory;
+        }
+        
         /**
          * Removes the entry at the given position in the cache.
          * @param _toRemove The position to the entry to remove from the cache.
@@ -225,8 +442,11 @@ namespace carl
         std::size_t erase( TypeInfoPair<T,Info>* _toRemove )
         {
             assert( checkNumOfUnusedEntries() );
-            std::lock_guard<std::recursive_mutex> lock( mMutex );
+            CACHE_LOCK_GUARD
             assert( _toRemove->second.usageCount == 0 );
+            assert( mMemoryUsage >= _toRemove->second.memory );
+            mMemoryUsage -= _toRemove->second.memory;
+            ++mStatistics.evictions;
             for( const Ref& ref : _toRemove->second.refStoragePositions )
             {
                 mCacheRefs[ref] = nullptr;
@@ -252,8 +472,11 @@ namespace carl
         typename Container::iterator erase( typename Container::iterator _toRemove )
         {
             assert( checkNumOfUnusedEntries() );
-            std::lock_guard<std::recursive_mutex> lock( mMutex );
+            CACHE_LOCK_GUARD
             assert( (*_toRemove)->second.usageCount == 0 );
+            assert( mMemoryUsage >= (*_toRemove)->second.memory );
+            mMemoryUsage -= (*_toRemove)->second.memory;
+            ++mStatistics.evictions;
             for( const Ref& ref : (*_toRemove)->second.refStoragePositions )
             {
                 mCacheRefs[ref] = nullptr;
@@ -16,10 +16,13 @@ namespace carl
     const typename Cache<T>::Ref Cache<T>::NO_REF = 0;
 
     template<typename T>
-    Cache<T>::Cache( size_t _maxCacheSize, double _cacheReductionAmount, double _decay ):
+    Cache<T>::Cache( size_t _maxCacheSize, double _cacheReductionAmount, double _decay, std::size_t _maxMemory ):
         mMaxCacheSize( _maxCacheSize ),
-        mCacheReductionAmount( _cacheReductionAmount ), // TODO: use it, but without the effort of quick select
+        mNumOfUnusedEntries( 0 ),
+        mCacheReductionAmount( _cacheReductionAmount ), // TODO: use it for clean(), but without the effort of quick select
+        mMaxActivity( 0.0 ),
         mDecay( _decay ),
+        mMaxMemory( _maxMemory ),
         mCache(),
         mCacheRefs(),
         mUnusedPositionsInCacheRefs()
@@ -48,16 +51,22 @@ namespace carl
     template<typename T>
     std::pair<typename Cache<T>::Ref,bool> Cache<T>::cache( T* _toCache, bool (*_canBeUpdated)( const T&, const T& ), void (*_update)( const T&, const T& ) )
     {
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
+        CACHE_LOCK_GUARD
         if( mCache.size() >= mMaxCacheSize ) // Clean, if the number of elements in the cache exceeds the threshold.
         {
             clean();
         }
-        auto newElement = new TypeInfoPair<T,Info>(_toCache, Info(mMaxActivity));
+        if( mMaxMemory > 0 && mMemoryUsage > mMaxMemory ) // Evict, if the memory of the cache exceeds the threshold.
+        {
+            evict();
+        }
+        auto newElement = new TypeInfoPair<T,Info>(_toCache, Info(mMaxActivity.load()));
         auto ret = mCache.insert( newElement );
         
         if( !ret.second ) // There is already an equal object in the cache.
         {
+            ++mStatistics.hits;
+            (*ret.first)->second.referenced = true;
             // Try to update the entry in the cache by the information in the given object.
             if( (*_canBeUpdated)( *((*ret.first)->first), *_toCache ) )
             {
@@ -65,6 +74,7 @@ namespace carl
                 (*_update)( *element->first, *_toCache );
                 mCache.erase( ret.first );
                 element->first->rehash();
+                updateMemory( element );
                 auto retB = mCache.insert( element );
                 assert( retB.second );
                 for( const Ref& ref : element->second.refStoragePositions )
@@ -81,6 +91,8 @@ namespace carl
         }
         else // Create a new entry in the cache.
         {
+            ++mStatistics.misses;
+            updateMemory( newElement );
             if( mUnusedPositionsInCacheRefs.empty() ) // Get a brand new reference.
             {
                 assert( mCacheRefs.size() > 0);
@@ -107,10 +119,12 @@ namespace carl
     template<typename T>
     void Cache<T>::reg( Ref _refStoragePos )
     {
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
+        CACHE_SHARED_LOCK_GUARD
         assert( _refStoragePos < mCacheRefs.size() );
         TypeInfoPair<T,Info>* cacheRef = mCacheRefs[_refStoragePos];
         assert( cacheRef != nullptr );
+        CACHE_STRIPE_LOCK_GUARD( cacheRef )
+        cacheRef->second.referenced = true;
         if( cacheRef->second.usageCount == 0 )
         {
             assert( mNumOfUnusedEntries > 0 );
@@ -123,20 +137,33 @@ namespace carl
     template<typename T>
     void Cache<T>::dereg( Ref _refStoragePos )
     {
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
-        assert( _refStoragePos < mCacheRefs.size() );
-        TypeInfoPair<T,Info>* cacheRef = mCacheRefs[_refStoragePos];
-        assert( cacheRef != nullptr );
-        assert( cacheRef->second.usageCount > 0 );
-        --cacheRef->second.usageCount;
-        if( cacheRef->second.usageCount == 0 ) // no more usage
+        TypeInfoPair<T,Info>* toRemove = nullptr;
         {
-            assert( mNumOfUnusedEntries < std::numeric_limits<ContentType>::max() );
-            ++mNumOfUnusedEntries;
-            // If the cache contains more used elements than the maximum desired cache size, remove this entry directly.
-            if( mCache.size() - mNumOfUnusedEntries >= mMaxCacheSize )
+            CACHE_SHARED_LOCK_GUARD
+            assert( _refStoragePos < mCacheRefs.size() );
+            TypeInfoPair<T,Info>* cacheRef = mCacheRefs[_refStoragePos];
+            assert( cacheRef != nullptr );
+            CACHE_STRIPE_LOCK_GUARD( cacheRef )
+            assert( cacheRef->second.usageCount > 0 );
+            --cacheRef->second.usageCount;
+            if( cacheRef->second.usageCount == 0 ) // no more usage
+            {
+                assert( mNumOfUnusedEntries < std::numeric_limits<ContentType>::max() );
+                ++mNumOfUnusedEntries;
+                // If the cache contains more used elements than the maximum desired cache size, remove this entry directly.
+                if( mCache.size() - mNumOfUnusedEntries >= mMaxCacheSize )
+                {
+                    toRemove = cacheRef;
+                }
+            }
+        }
+        if( toRemove != nullptr )
+        {
+            // Removing needs the exclusive lock, meanwhile the entry might have been used or removed by another thread.
+            CACHE_LOCK_GUARD
+            if( mCacheRefs[_refStoragePos] == toRemove && toRemove->second.usageCount == 0 && mCache.size() - mNumOfUnusedEntries >= mMaxCacheSize )
             {
-                erase( cacheRef );
+                erase( toRemove );
             }
         }
     }
@@ -144,16 +171,19 @@ namespace carl
     template<typename T>
     void Cache<T>::rehash( Ref _refStoragePos )
     {
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
+        CACHE_LOCK_GUARD
         assert( _refStoragePos < mCacheRefs.size() );
         TypeInfoPair<T,Info>* cacheRef = mCacheRefs[_refStoragePos];
         assert( cacheRef != nullptr );
         mCache.erase( cacheRef );
         cacheRef->first->rehash();
+        updateMemory( cacheRef );
         const Info& infoB = cacheRef->second;
         auto ret = mCache.insert( cacheRef );
         if( !ret.second )
         {
+            assert( mMemoryUsage >= infoB.memory );
+            mMemoryUsage -= infoB.memory;
             Info& info = (*ret.first)->second;
             if( infoB.usageCount == 0 )
             {
@@ -228,33 +258,95 @@ namespace carl
         }
     }
     
+    template<typename T>
+    void Cache<T>::evict()
+    {
+        CARL_LOG_TRACE( "carl.util.cache", "Evicting cold entries..." );
+        #ifdef THREAD_SAFE
+        assert( mMutex.ownedByThisThread() );
+        #endif
+        if( mCacheRefs.size() <= 1 )
+            return;
+        std::size_t target = std::size_t( double(mMaxMemory) * (1.0 - mCacheReductionAmount) );
+        // Two rounds of the clock hand visit every entry with a cleared reference bit at least once.
+        std::size_t steps = 2 * mCacheRefs.size();
+        for( ; steps > 0 && mMemoryUsage > target; --steps )
+        {
+            if( ++mClockHand >= mCacheRefs.size() )
+                mClockHand = 1;
+            TypeInfoPair<T,Info>* entry = mCacheRefs[mClockHand];
+            // Visit every entry only at its first reference.
+            if( entry == nullptr || entry->second.refStoragePositions.front() != mClockHand )
+                continue;
+            Info& info = entry->second;
+            if( info.referenced )
+            {
+                info.referenced = false;
+                continue;
+            }
+            if( info.usageCount == 1 && entry->first->referencesItself() )
+            {
+                // Releasing the self reference deregisters the entry, which might remove it right away.
+                entry->first->releaseSelfReference();
+                if( mCacheRefs[mClockHand] == entry && entry->second.usageCount == 0 )
+                    erase( entry );
+            }
+            else if( info.usageCount == 0 )
+            {
+                erase( entry );
+            }
+            else
+            {
+                // The memory might have changed without a rehash.
+                updateMemory( entry );
+                std::size_t released = std::min( entry->first->releaseMemory(), info.memory );
+                if( released > 0 )
+                {
+                    info.memory -= released;
+                    mMemoryUsage -= released;
+                    ++mStatistics.releases;
+                }
+            }
+        }
+    }
+    
     template<typename T>
     void Cache<T>::decayActivity()
     {
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
+        CACHE_LOCK_GUARD
         mActivityIncrement *= (1 / mDecay);
     }
     
     template<typename T>
     void Cache<T>::strengthenActivity( Ref _refStoragePos )
     {
-        assert( _refStoragePos < mCacheRefs.size() );
-        TypeInfoPair<T,Info>* cacheRef = mCacheRefs[_refStoragePos];
-        assert( cacheRef != nullptr );
-        // update the activity of the cache entry at the given position
-        if( (cacheRef->second.activity += mActivityIncrement) > mActivityThreshold )
+        bool rescale = false;
         {
-            std::lock_guard<std::recursive_mutex> lock( mMutex );
-            // rescale if the threshold for the maximum activity has been exceeded
-            for( auto iter = mCache.begin(); iter != mCache.end(); ++iter )
-                (*iter)->second.activity *= mActivityDecrementFactor;
-            mActivityIncrement *= mActivityDecrementFactor;
-            mMaxActivity *= mActivityDecrementFactor;
+            CACHE_SHARED_LOCK_GUARD
+            assert( _refStoragePos < mCacheRefs.size() );
+            TypeInfoPair<T,Info>* cacheRef = mCacheRefs[_refStoragePos];
+            assert( cacheRef != nullptr );
+            CACHE_STRIPE_LOCK_GUARD( cacheRef )
+            cacheRef->second.referenced = true;
+            // update the activity of the cache entry at the given position
+            double activity = (cacheRef->second.activity += mActivityIncrement);
+            rescale = activity > mActivityThreshold;
+            // update the maximum activity
+            double maxActivity = mMaxActivity.load();
+            while( maxActivity < activity && !mMaxActivity.compare_exchange_weak( maxActivity, activity ) );
+        }
+        if( rescale )
+        {
+            CACHE_LOCK_GUARD
+            // rescale if the threshold for the maximum activity has been exceeded, unless another thread already did
+            if( mMaxActivity.load() > mActivityThreshold )
+            {
+                for( auto iter = mCache.begin(); iter != mCache.end(); ++iter )
+                    (*iter)->second.activity *= mActivityDecrementFactor;
+                mActivityIncrement *= mActivityDecrementFactor;
+                mMaxActivity = mMaxActivity.load() * mActivityDecrementFactor;
+            }
         }
-        // update the maximum activity
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
-        if( mMaxActivity < cacheRef->second.activity )
-            mMaxActivity = cacheRef->second.activity;
     }
     
     template<typename T>
@@ -263,6 +355,10 @@ namespace carl
         _out << "General cache information:" << std::endl;
         _out << "   desired maximum cache size                                 : "  << mMaxCacheSize << std::endl;
         _out << "   number of unused entries                                   : "  << mNumOfUnusedEntries << std::endl;
+        _out << "   desired maximum memory in bytes (0 for no limit)           : "  << mMaxMemory << std::endl;
+        _out << "   estimated memory in bytes                                  : "  << mMemoryUsage << std::endl;
+        _out << "   number of hits / misses                                    : "  << mStatistics.hits << " / " << mStatistics.misses << std::endl;
+        _out << "   number of evicted entries / released entries               : "  << mStatistics.evictions << " / " << mStatistics.releases << std::endl;
         _out << "   desired reduction amount when cleaning the cache (not used): "  << mCacheReductionAmount << std::endl;
         _out << "   maximum of all activities                                  : "  << mMaxActivity << std::endl;
         _out << "   the current value of the activity increment                : "  << mActivityIncrement << std::endl;
@@ -4,6 +4,7 @@
  * http://www.broune.com/papers/issac2012.html
  * Currently, it is distributed under LGPL v2  from 
  * http://www.broune.com/papers/issac2012.html
+ * Local changes are marked with "carl patch".
  */
 
 
@@ -48,7 +49,15 @@ namespace carl
             CompactTree( const CompactTree& tree, std::size_t minCapacity = 0 );
             ~CompactTree()
             {
+                // carl patch: GCC does not see that _array + 1 is the allocated pointer and reports -Wfree-nonheap-object.
+#if defined __GNUC__ && !defined __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfree-nonheap-object"
+#endif
                 delete[] (_array + 1);
+#if defined __GNUC__ && !defined __clang__
+#pragma GCC diagnostic pop
+#endif
             }
 
             Entry& operator []( Node n );
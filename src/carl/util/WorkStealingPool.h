@@ -0,0 +1,178 @@
+/**
+ * @file WorkStealingPool.h
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A fixed-size thread pool where every worker owns a task queue.
+ *
+ * Workers take tasks from the back of their own queue and steal from the front of other queues once their own queue is empty.
+ * The thread calling parallelFor() executes tasks as well until all of its tasks are finished, hence parallelFor() may be called from within a task.
+ * Usually, a single pool is used for the whole process, see shared(), and every call of parallelFor() limits the number of threads it uses.
+ *
+ * Note that most of carl is only safe to use from multiple threads if it was built with THREAD_SAFE.
+ */
+class WorkStealingPool {
+	using Task = std::function<void()>;
+	struct Queue {
+		std::mutex mutex;
+		std::deque<Task> tasks;
+	};
+	std::vector<std::unique_ptr<Queue>> mQueues;
+	std::vector<std::thread> mWorkers;
+	std::mutex mMutex;
+	std::condition_variable mWakeup;
+	std::atomic<std::size_t> mQueued{0};
+	std::atomic<std::size_t> mNextQueue{0};
+	bool mStop = false;
+
+	bool pop(std::size_t id, Task& task) {
+		Queue& q = *mQueues[id];
+		std::lock_guard<std::mutex> guard(q.mutex);
+		if (q.tasks.empty()) return false;
+		task = std::move(q.tasks.back());
+		q.tasks.pop_back();
+		--mQueued;
+		return true;
+	}
+	bool steal(std::size_t id, Task& task) {
+		for (std::size_t i = 1; i < mQueues.size(); ++i) {
+			Queue& q = *mQueues[(id + i) % mQueues.size()];
+			std::lock_guard<std::mutex> guard(q.mutex);
+			if (q.tasks.empty()) continue;
+			task = std::move(q.tasks.front());
+			q.tasks.pop_front();
+			--mQueued;
+			return true;
+		}
+		return false;
+	}
+	/// Executes a single task from the given queue or from another one, if any.
+	bool runTask(std::size_t id) {
+		Task task;
+		if (!pop(id, task) && !steal(id, task)) return false;
+		task();
+		return true;
+	}
+	void work(std::size_t id) {
+		while (true) {
+			if (runTask(id)) continue;
+			std::unique_lock<std::mutex> lock(mMutex);
+			mWakeup.wait(lock, [this](){ return mStop || mQueued > 0; });
+			if (mStop && mQueued == 0) return;
+		}
+	}
+public:
+	/**
+	 * Starts the given number of worker threads.
+	 * With zero workers, all tasks are executed by the calling thread.
+	 */
+	explicit WorkStealingPool(std::size_t workers) {
+		for (std::size_t i = 0; i < std::max<std::size_t>(workers, 1); ++i) {
+			mQueues.emplace_back(std::make_unique<Queue>());
+		}
+		for (std::size_t i = 0; i < workers; ++i) {
+			mWorkers.emplace_back(&WorkStealingPool::work, this, i);
+		}
+	}
+	WorkStealingPool(const WorkStealingPool&) = delete;
+	WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+	~WorkStealingPool() {
+		{
+			std::lock_guard<std::mutex> guard(mMutex);
+			mStop = true;
+		}
+		mWakeup.notify_all();
+		for (auto& w: mWorkers) w.join();
+	}
+
+	/// Returns the number of worker threads.
+	std::size_t size() const {
+		return mWorkers.size();
+	}
+
+	/**
+	 * Calls f(i) for all i in [0, n) and returns once all calls are finished.
+	 * The calls are executed by the calling thread and at most threads - 1 workers, which take the next index from a common counter.
+	 * The tasks of these workers are distributed over the queues and the calling thread participates in their execution.
+	 * If some call throws, one of the exceptions is rethrown after all calls are finished.
+	 * @param n Number of calls.
+	 * @param f Function to call.
+	 * @param threads Maximal number of threads executing the calls, including the calling thread.
+	 */
+	template<typename F>
+	void parallelFor(std::size_t n, F&& f, std::size_t threads) {
+		std::size_t helpers = std::min({threads, mWorkers.size() + 1, n});
+		if (helpers < 2) {
+			for (std::size_t i = 0; i < n; ++i) f(i);
+			return;
+		}
+		--helpers;
+		std::atomic<std::size_t> next(0);
+		std::atomic<std::size_t> running(helpers);
+		std::exception_ptr error;
+		std::mutex errorMutex;
+		auto run = [&f,&next,&error,&errorMutex,n](){
+			for (std::size_t i = next++; i < n; i = next++) {
+				try {
+					f(i);
+				} catch (...) {
+					std::lock_guard<std::mutex> guard(errorMutex);
+					if (!error) error = std::current_exception();
+				}
+			}
+		};
+		for (std::size_t i = 0; i < helpers; ++i) {
+			Queue& q = *mQueues[mNextQueue++ % mQueues.size()];
+			std::lock_guard<std::mutex> guard(q.mutex);
+			q.tasks.emplace_back([&run,&running](){
+				run();
+				--running;
+			});
+			++mQueued;
+		}
+		{
+			// Workers check mQueued while holding mMutex, hence no wakeup is lost.
+			std::lock_guard<std::mutex> guard(mMutex);
+		}
+		mWakeup.notify_all();
+		run();
+		// Tasks that are not started yet finish immediately, hence the calling thread may run them as well.
+		std::size_t id = mNextQueue % mQueues.size();
+		while (running > 0) {
+			if (!runTask(id)) std::this_thread::yield();
+		}
+		if (error) std::rethrow_exception(error);
+	}
+	/// Calls f(i) for all i in [0, n) using all workers, see parallelFor(std::size_t, F&&, std::size_t).
+	template<typename F>
+	void parallelFor(std::size_t n, F&& f) {
+		parallelFor(n, std::forward<F>(f), mWorkers.size() + 1);
+	}
+
+	/**
+	 * Returns the pool that is shared by the whole process.
+	 * It is created on first use with one worker less than the number of hardware threads, as the calling thread participates in parallelFor().
+	 * Callers limit the number of threads per call of parallelFor().
+	 */
+	static WorkStealingPool& shared() {
+		static WorkStealingPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+		return pool;
+	}
+};
+
+}
@@ -3,6 +3,9 @@
 #include "hash.h"
 
 #include <boost/dynamic_bitset.hpp>
+#include <boost/version.hpp>
+
+#if BOOST_VERSION < 107100
 
 namespace std {
 
@@ -15,4 +18,6 @@ struct hash<boost::dynamic_bitset<Block,Allocator>> {
 	}
 };
 
-}
\ No newline at end of file
+}
+
+#endif
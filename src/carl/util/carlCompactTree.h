@@ -0,0 +1,710 @@
+/**
+ * @file carlCompactTree.h
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace carl {
+
+template<typename T, typename Hash = std::hash<T>>
+class compact_tree;
+
+namespace compact_tree_detail {
+
+/// Type of node indices and value handles.
+using index = std::uint32_t;
+constexpr index NONE = std::numeric_limits<index>::max();
+
+/**
+ * Stores values of type T such that equal values are stored only once.
+ * Every value is identified by a handle, that is its index in the store.
+ * Values are reference counted: intern() and acquire() add a reference, release() removes one.
+ * A value without references is removed from the store and its handle is reused.
+ *
+ * Only values with the same hash are compared, hence Hash should separate different values well.
+ * It may map equal values to different hashes, at the cost of storing them more than once.
+ */
+template<typename T, typename Hash = std::hash<T>>
+class InternStore {
+	std::vector<T> mValues;
+	/// Number of references of every handle, zero for free handles.
+	std::vector<index> mReferences;
+	/// Maps hash values to the handles of all values with this hash.
+	std::unordered_multimap<std::size_t, index> mHandles;
+	/// Handles that are not used and can be reused.
+	std::vector<index> mFreeHandles;
+public:
+	/**
+	 * Returns the handle of the given value, inserting the value if it is not yet contained.
+	 * Adds a reference to the handle.
+	 * @param value Value.
+	 * @return Handle of value.
+	 */
+	index intern(const T& value) {
+		std::size_t hash = Hash()(value);
+		auto range = mHandles.equal_range(hash);
+		for (auto it = range.first; it != range.second; ++it) {
+			if (mValues[it->second] == value) return acquire(it->second);
+		}
+		index res;
+		if (mFreeHandles.empty()) {
+			assert(mValues.size() < NONE);
+			res = index(mValues.size());
+			mValues.push_back(value);
+			mReferences.push_back(0);
+		} else {
+			res = mFreeHandles.back();
+			mFreeHandles.pop_back();
+			mValues[res] = value;
+		}
+		mHandles.emplace(hash, res);
+		return acquire(res);
+	}
+	/**
+	 * Adds a reference to the given handle.
+	 * @param handle Handle.
+	 * @return handle.
+	 */
+	index acquire(index handle) {
+		assert(handle < mValues.size());
+		++mReferences[handle];
+		return handle;
+	}
+	/**
+	 * Removes a reference from the given handle and removes the value if it has no references left.
+	 * @param handle Handle.
+	 */
+	void release(index handle) {
+		assert(handle < mValues.size() && mReferences[handle] > 0);
+		if (--mReferences[handle] > 0) return;
+		auto range = mHandles.equal_range(Hash()(mValues[handle]));
+		for (auto it = range.first; it != range.second; ++it) {
+			if (it->second == handle) {
+				mHandles.erase(it);
+				break;
+			}
+		}
+		mValues[handle] = T();
+		mFreeHandles.push_back(handle);
+	}
+	const T& operator[](index handle) const {
+		assert(handle < mValues.size() && mReferences[handle] > 0);
+		return mValues[handle];
+	}
+	/// Returns the number of values.
+	std::size_t size() const {
+		return mValues.size() - mFreeHandles.size();
+	}
+	/// Returns an upper bound for all handles.
+	std::size_t handle_bound() const {
+		return mValues.size();
+	}
+	void clear() {
+		mValues.clear();
+		mReferences.clear();
+		mHandles.clear();
+		mFreeHandles.clear();
+	}
+	/**
+	 * Estimates the memory used by this store, not including memory owned by the values themselves.
+	 * @return Number of bytes.
+	 */
+	std::size_t memory_usage() const {
+		// every entry of the hash map is a separately allocated node with a next pointer and the cached hash
+		std::size_t node = sizeof(std::pair<const std::size_t, index>) + 2 * sizeof(void*);
+		std::size_t handles = (mReferences.capacity() + mFreeHandles.capacity()) * sizeof(index);
+		return mValues.capacity() * sizeof(T) + handles + mHandles.size() * node + mHandles.bucket_count() * sizeof(void*);
+	}
+};
+
+/// Traversal orders supported by compact_tree::Iterator.
+enum class Order { Preorder, Leaf, Depth, Children, Path };
+
+/**
+ * Forward iterator over the nodes of a compact_tree in the given order.
+ * It only consists of a pointer to the tree, the current node and the depth for Order::Depth.
+ */
+template<typename T, typename Hash, Order order>
+struct Iterator {
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = T;
+	using difference_type = std::ptrdiff_t;
+	using pointer = const T*;
+	using reference = const T&;
+
+	const compact_tree<T,Hash>* mTree = nullptr;
+	index current = NONE;
+	std::uint32_t mDepth = 0;
+
+	Iterator() = default;
+	Iterator(const compact_tree<T,Hash>* t, index cur, std::uint32_t depth = 0): mTree(t), current(cur), mDepth(depth) {}
+	/// Converts an iterator of another order to this order, starting at the same node, as carl::tree does.
+	template<Order o>
+	Iterator(const Iterator<T,Hash,o>& it): mTree(it.mTree), current(it.current), mDepth(it.mDepth) {}
+
+	index id() const {
+		assert(current != NONE);
+		return current;
+	}
+	std::uint32_t depth() const {
+		return mTree->depth(current);
+	}
+	bool isRoot() const {
+		return current == 0;
+	}
+	reference operator*() const {
+		return (*mTree)[current];
+	}
+	pointer operator->() const {
+		return &(*mTree)[current];
+	}
+	Iterator& operator++() {
+		switch (order) {
+			case Order::Preorder: current = mTree->nextPreorder(current, false); break;
+			case Order::Leaf: current = mTree->nextLeaf(current); break;
+			case Order::Depth: current = mTree->nextAtDepth(current, mDepth); break;
+			case Order::Children: current = mTree->nextSibling(current); break;
+			case Order::Path: current = mTree->parent(current); break;
+		}
+		return *this;
+	}
+	Iterator operator++(int) {
+		Iterator res(*this);
+		++(*this);
+		return res;
+	}
+	/**
+	 * Advances the iterator without visiting the subtree of the current node.
+	 * Only differs from the increment operator for Order::Preorder.
+	 */
+	Iterator& skipChildren() {
+		if (order == Order::Preorder) current = mTree->nextPreorder(current, true);
+		else ++(*this);
+		return *this;
+	}
+};
+template<typename T, typename Hash, Order o1, Order o2>
+bool operator==(const Iterator<T,Hash,o1>& lhs, const Iterator<T,Hash,o2>& rhs) {
+	return lhs.current == rhs.current;
+}
+template<typename T, typename Hash, Order o1, Order o2>
+bool operator!=(const Iterator<T,Hash,o1>& lhs, const Iterator<T,Hash,o2>& rhs) {
+	return lhs.current != rhs.current;
+}
+
+/// Writes value as a variable length integer, seven bits per byte.
+inline void writeVarint(std::ostream& os, std::uint64_t value) {
+	while (value >= 0x80) {
+		os.put(char((value & 0x7f) | 0x80));
+		value >>= 7;
+	}
+	os.put(char(value));
+}
+/// Reads a variable length integer written by writeVarint().
+inline std::uint64_t readVarint(std::istream& is) {
+	std::uint64_t res = 0;
+	for (unsigned shift = 0; shift < 64; shift += 7) {
+		int c = is.get();
+		if (c == std::char_traits<char>::eof()) break;
+		res |= std::uint64_t(c & 0x7f) << shift;
+		if ((c & 0x80) == 0) break;
+	}
+	return res;
+}
+
+}
+
+/**
+ * A tree with the same structure as carl::tree that is optimized for memory footprint and traversal speed.
+ *
+ * The nodes are identified by 32-bit indices and the links between them are stored as a structure of arrays, one array per link type.
+ * Walking along siblings, parents or depths hence only touches the (densely packed) arrays involved.
+ * The values are not stored within the nodes, but interned in a separate store and referred to by handles.
+ * This requires a hash function for T, std::hash<T> by default, and an equality operator for T, and makes the values immutable: a value can only be replaced as a whole.
+ * As the interface matches carl::tree, it can be used as the sample tree of a CAD, see CAD::Tree.
+ *
+ * Erased nodes are kept in a free list and reused, values that are no longer used by any node are removed from the store.
+ * The tree can be written to a stream in a compact binary format using serialize().
+ */
+template<typename T, typename Hash>
+class compact_tree {
+public:
+	using value_type = T;
+	using index = compact_tree_detail::index;
+	static constexpr index NONE = compact_tree_detail::NONE;
+	using Order = compact_tree_detail::Order;
+
+	using PreorderIterator = compact_tree_detail::Iterator<T, Hash, Order::Preorder>;
+	using LeafIterator = compact_tree_detail::Iterator<T, Hash, Order::Leaf>;
+	using DepthIterator = compact_tree_detail::Iterator<T, Hash, Order::Depth>;
+	using ChildrenIterator = compact_tree_detail::Iterator<T, Hash, Order::Children>;
+	using PathIterator = compact_tree_detail::Iterator<T, Hash, Order::Path>;
+	using iterator = PreorderIterator;
+private:
+	template<typename TT, typename H, Order o>
+	friend struct compact_tree_detail::Iterator;
+
+	std::vector<index> mParent;
+	std::vector<index> mPreviousSibling;
+	/// Next sibling of every node, or the next free node for erased nodes.
+	std::vector<index> mNextSibling;
+	std::vector<index> mFirstChild;
+	std::vector<index> mLastChild;
+	/// Depth of every node, NONE for erased nodes.
+	std::vector<std::uint32_t> mDepth;
+	/// Handle of the value of every node.
+	std::vector<index> mValue;
+	compact_tree_detail::InternStore<T,Hash> mStore;
+	index mFreeNodes = NONE;
+	std::size_t mSize = 0;
+
+	index newNode(index value, index parent, std::uint32_t depth) {
+		index id = mFreeNodes;
+		if (id == NONE) {
+			assert(mDepth.size() < NONE);
+			id = index(mDepth.size());
+			mParent.push_back(parent);
+			mPreviousSibling.push_back(NONE);
+			mNextSibling.push_back(NONE);
+			mFirstChild.push_back(NONE);
+			mLastChild.push_back(NONE);
+			mDepth.push_back(depth);
+			mValue.push_back(value);
+		} else {
+			mFreeNodes = mNextSibling[id];
+			mParent[id] = parent;
+			mPreviousSibling[id] = NONE;
+			mNextSibling[id] = NONE;
+			mFirstChild[id] = NONE;
+			mLastChild[id] = NONE;
+			mDepth[id] = depth;
+			mValue[id] = value;
+		}
+		++mSize;
+		return id;
+	}
+	void eraseNode(index id) {
+		eraseChildren(id);
+		mStore.release(mValue[id]);
+		mNextSibling[id] = mFreeNodes;
+		mPreviousSibling[id] = NONE;
+		mDepth[id] = NONE;
+		mFreeNodes = id;
+		--mSize;
+	}
+	/// Sets the value of the given node to a handle that is already referenced for this node.
+	void setHandle(index id, index value) {
+		mStore.release(mValue[id]);
+		mValue[id] = value;
+	}
+	index appendHandle(index parent, index value) {
+		assert(is_valid(parent));
+		index id = newNode(value, parent, mDepth[parent] + 1);
+		if (mLastChild[parent] == NONE) {
+			mFirstChild[parent] = id;
+		} else {
+			mNextSibling[mLastChild[parent]] = id;
+			mPreviousSibling[id] = mLastChild[parent];
+		}
+		mLastChild[parent] = id;
+		return id;
+	}
+	void eraseChildren(index id) {
+		index cur = mFirstChild[id];
+		while (cur != NONE) {
+			index tmp = cur;
+			cur = mNextSibling[cur];
+			eraseNode(tmp);
+		}
+		mFirstChild[id] = NONE;
+		mLastChild[id] = NONE;
+	}
+
+	index nextPreorder(index cur, bool skipChildren) const {
+		if (!skipChildren && mFirstChild[cur] != NONE) return mFirstChild[cur];
+		while (mNextSibling[cur] == NONE) {
+			cur = mParent[cur];
+			if (cur == NONE) return NONE;
+		}
+		return mNextSibling[cur];
+	}
+	index firstLeaf(index cur) const {
+		while (mFirstChild[cur] != NONE) cur = mFirstChild[cur];
+		return cur;
+	}
+	index nextLeaf(index cur) const {
+		cur = nextPreorder(cur, true);
+		if (cur == NONE) return NONE;
+		return firstLeaf(cur);
+	}
+	/// Returns the first node at the given depth in preorder starting with cur.
+	index firstAtDepth(index cur, std::uint32_t depth) const {
+		while (mDepth[cur] < depth && mFirstChild[cur] != NONE) cur = mFirstChild[cur];
+		if (mDepth[cur] == depth) return cur;
+		return nextAtDepth(cur, depth);
+	}
+	/// Returns the next node at the given depth in preorder after the subtree of cur.
+	index nextAtDepth(index cur, std::uint32_t depth) const {
+		while (true) {
+			cur = nextPreorder(cur, true);
+			if (cur == NONE) return NONE;
+			while (mDepth[cur] < depth && mFirstChild[cur] != NONE) cur = mFirstChild[cur];
+			if (mDepth[cur] == depth) return cur;
+		}
+	}
+	index nextSibling(index cur) const {
+		return mNextSibling[cur];
+	}
+	index parent(index cur) const {
+		return mParent[cur];
+	}
+	std::uint32_t depth(index cur) const {
+		assert(cur < mDepth.size());
+		return mDepth[cur];
+	}
+public:
+	compact_tree() = default;
+	compact_tree(const compact_tree&) = default;
+	compact_tree(compact_tree&&) noexcept = default;
+	compact_tree& operator=(const compact_tree&) = default;
+	compact_tree& operator=(compact_tree&&) noexcept = default;
+
+	/**
+	 * Converts a tree like carl::tree to a compact_tree, preserving the order of the children.
+	 * The source tree must provide begin_preorder(), end_preorder() and a depth() method of its iterators.
+	 * @param t Source tree.
+	 */
+	template<typename Tree>
+	static compact_tree from(const Tree& t) {
+		compact_tree res;
+		// the nodes on the path from the root to the last node
+		std::vector<index> path;
+		for (auto it = t.begin_preorder(); it != t.end_preorder(); ++it) {
+			std::size_t d = it.depth();
+			path.resize(d);
+			if (d == 0) path.push_back(res.setRoot(*it).current);
+			else path.push_back(res.append(path[d - 1], *it));
+		}
+		return res;
+	}
+
+	const T& operator[](index id) const {
+		assert(is_valid(id));
+		return mStore[mValue[id]];
+	}
+	/// Returns the handle of the value of the given node.
+	index handle(index id) const {
+		assert(is_valid(id));
+		return mValue[id];
+	}
+	/// Returns the store of the values.
+	const compact_tree_detail::InternStore<T,Hash>& store() const {
+		return mStore;
+	}
+
+	/// Returns the number of nodes.
+	std::size_t size() const {
+		return mSize;
+	}
+	bool empty() const {
+		return mSize == 0;
+	}
+
+	PreorderIterator begin() const {
+		return begin_preorder();
+	}
+	PreorderIterator end() const {
+		return end_preorder();
+	}
+	PreorderIterator begin_preorder() const {
+		return PreorderIterator(this, empty() ? NONE : 0);
+	}
+	PreorderIterator end_preorder() const {
+		return PreorderIterator(this, NONE);
+	}
+	LeafIterator begin_leaf() const {
+		return LeafIterator(this, empty() ? NONE : firstLeaf(0));
+	}
+	LeafIterator end_leaf() const {
+		return LeafIterator(this, NONE);
+	}
+	DepthIterator begin_depth(std::uint32_t depth) const {
+		return DepthIterator(this, empty() ? NONE : firstAtDepth(0, depth), depth);
+	}
+	DepthIterator end_depth() const {
+		return DepthIterator(this, NONE);
+	}
+	template<typename Iterator>
+	ChildrenIterator begin_children(const Iterator& it) const {
+		return ChildrenIterator(this, mFirstChild[it.current]);
+	}
+	template<typename Iterator>
+	ChildrenIterator end_children(const Iterator&) const {
+		return ChildrenIterator(this, NONE);
+	}
+	template<typename Iterator>
+	PathIterator begin_path(const Iterator& it) const {
+		return PathIterator(this, it.current);
+	}
+	PathIterator end_path() const {
+		return PathIterator(this, NONE);
+	}
+
+	/**
+	 * Retrieves the maximum depth of all nodes.
+	 * @return Maximum depth.
+	 */
+	std::uint32_t max_depth() const {
+		std::uint32_t max = 0;
+		for (index id = 0; id < mDepth.size(); ++id) {
+			if (mDepth[id] != NONE && mDepth[id] > max) max = mDepth[id];
+		}
+		return max;
+	}
+	/**
+	 * Retrieves the maximum depth of the subtree of the given node, relative to this node.
+	 * @param it Node.
+	 * @return Maximum depth.
+	 */
+	template<typename Iterator>
+	std::uint32_t max_depth(const Iterator& it) const {
+		std::uint32_t max = 0;
+		// the subtree ends with the first node in preorder that is not deeper than it
+		for (index cur = mFirstChild[it.current]; cur != NONE && mDepth[cur] > mDepth[it.current]; cur = nextPreorder(cur, false)) {
+			if (mDepth[cur] - mDepth[it.current] > max) max = mDepth[cur] - mDepth[it.current];
+		}
+		return max;
+	}
+	template<typename Iterator>
+	bool is_leaf(const Iterator& it) const {
+		return mFirstChild[it.current] == NONE;
+	}
+	bool is_valid(index id) const {
+		return id < mDepth.size() && mDepth[id] != NONE;
+	}
+	template<typename Iterator>
+	bool is_valid(const Iterator& it) const {
+		return is_valid(it.current);
+	}
+	template<typename Iterator>
+	Iterator get_parent(const Iterator& it) const {
+		Iterator res(it);
+		res.current = mParent[it.current];
+		return res;
+	}
+
+	/**
+	 * Sets the value of the root.
+	 * @param data Value.
+	 * @return Iterator to the root.
+	 */
+	PreorderIterator setRoot(const T& data) {
+		if (empty()) newNode(mStore.intern(data), NONE, 0);
+		else setHandle(0, mStore.intern(data));
+		return PreorderIterator(this, 0);
+	}
+	/**
+	 * Adds the given value as last child of the given node.
+	 * @param parent Parent node.
+	 * @param data Value.
+	 * @return Index of the new node.
+	 */
+	index append(index parent, const T& data) {
+		return appendHandle(parent, mStore.intern(data));
+	}
+	template<typename Iterator>
+	Iterator append(const Iterator& parent, const T& data) {
+		return Iterator(this, append(parent.current, data));
+	}
+	/**
+	 * Inserts the given value as sibling before the given node.
+	 * @param position Node to insert before.
+	 * @param data Value.
+	 * @return Iterator to the new node.
+	 */
+	template<typename Iterator>
+	Iterator insert(const Iterator& position, const T& data) {
+		index next = position.current;
+		assert(is_valid(next) && next != 0);
+		index parent = mParent[next];
+		index id = newNode(mStore.intern(data), parent, mDepth[next]);
+		index prev = mPreviousSibling[next];
+		mPreviousSibling[id] = prev;
+		mNextSibling[id] = next;
+		mPreviousSibling[next] = id;
+		if (prev == NONE) mFirstChild[parent] = id;
+		else mNextSibling[prev] = id;
+		return Iterator(this, id, position.mDepth);
+	}
+	/**
+	 * Replaces the value of the given node.
+	 * @param position Node.
+	 * @param data Value.
+	 * @return position.
+	 */
+	template<typename Iterator>
+	const Iterator& replace(const Iterator& position, const T& data) {
+		assert(is_valid(position));
+		setHandle(position.current, mStore.intern(data));
+		return position;
+	}
+	/**
+	 * Erases the given node and its subtree.
+	 * @param position Node.
+	 * @return Iterator to the next node of the same traversal order that is not within the erased subtree.
+	 */
+	template<typename Iterator>
+	Iterator erase(Iterator position) {
+		index id = position.current;
+		assert(is_valid(id));
+		if (id == 0) {
+			clear();
+			return Iterator(this, NONE);
+		}
+		position.skipChildren();
+		index prev = mPreviousSibling[id];
+		index next = mNextSibling[id];
+		index parent = mParent[id];
+		if (next == NONE) mLastChild[parent] = prev;
+		else mPreviousSibling[next] = prev;
+		if (prev == NONE) mFirstChild[parent] = next;
+		else mNextSibling[prev] = next;
+		eraseNode(id);
+		return position;
+	}
+	/**
+	 * Erases all children of the given node.
+	 * @param position Node.
+	 */
+	template<typename Iterator>
+	void eraseChildren(const Iterator& position) {
+		eraseChildren(position.current);
+	}
+	/**
+	 * Removes all nodes and all values.
+	 */
+	void clear() {
+		mParent.clear();
+		mPreviousSibling.clear();
+		mNextSibling.clear();
+		mFirstChild.clear();
+		mLastChild.clear();
+		mDepth.clear();
+		mValue.clear();
+		mStore.clear();
+		mFreeNodes = NONE;
+		mSize = 0;
+	}
+
+	/**
+	 * Estimates the memory used by this tree, not including memory owned by the values themselves.
+	 * @return Number of bytes.
+	 */
+	std::size_t memory_usage() const {
+		std::size_t res = sizeof(*this) + mStore.memory_usage();
+		for (const auto* v: {&mParent, &mPreviousSibling, &mNextSibling, &mFirstChild, &mLastChild, &mValue}) {
+			res += v->capacity() * sizeof(index);
+		}
+		return res + mDepth.capacity() * sizeof(std::uint32_t);
+	}
+
+	/**
+	 * Writes the tree to the given stream in a compact binary format.
+	 * All values that are used by some node are written once using writeValue, the nodes are written in preorder as pairs of variable length integers: the number of children and the handle of the value.
+	 * Handles are renumbered in the order of their first use.
+	 * @param os Output stream.
+	 * @param writeValue Function writing a single value to os.
+	 */
+	template<typename Writer>
+	void serialize(std::ostream& os, Writer&& writeValue) const {
+		std::vector<index> handles(mStore.handle_bound(), NONE);
+		std::vector<index> used;
+		for (auto it = begin_preorder(); it != end_preorder(); ++it) {
+			index& h = handles[mValue[it.current]];
+			if (h == NONE) {
+				h = index(used.size());
+				used.push_back(mValue[it.current]);
+			}
+		}
+		compact_tree_detail::writeVarint(os, used.size());
+		for (index h: used) writeValue(os, mStore[h]);
+		compact_tree_detail::writeVarint(os, mSize);
+		for (auto it = begin_preorder(); it != end_preorder(); ++it) {
+			std::size_t children = 0;
+			for (index c = mFirstChild[it.current]; c != NONE; c = mNextSibling[c]) ++children;
+			compact_tree_detail::writeVarint(os, children);
+			compact_tree_detail::writeVarint(os, handles[mValue[it.current]]);
+		}
+	}
+	/**
+	 * Reads a tree written by serialize().
+	 * @param is Input stream.
+	 * @param readValue Function reading a single value from is, inverse to the writer given to serialize().
+	 * @return The tree.
+	 */
+	template<typename Reader>
+	static compact_tree deserialize(std::istream& is, Reader&& readValue) {
+		compact_tree res;
+		std::size_t values = compact_tree_detail::readVarint(is);
+		std::vector<index> handles;
+		handles.reserve(values);
+		for (std::size_t i = 0; i < values; ++i) handles.push_back(res.mStore.intern(readValue(is)));
+		std::size_t nodes = compact_tree_detail::readVarint(is);
+		// stack of the nodes whose children are not yet complete, with the number of missing children
+		std::vector<std::pair<index,std::size_t>> open;
+		for (std::size_t i = 0; i < nodes && is; ++i) {
+			std::size_t children = compact_tree_detail::readVarint(is);
+			std::size_t h = compact_tree_detail::readVarint(is);
+			assert(h < handles.size());
+			index id = 0;
+			if (open.empty()) {
+				id = res.newNode(res.mStore.acquire(handles[h]), NONE, 0);
+			} else {
+				id = res.appendHandle(open.back().first, res.mStore.acquire(handles[h]));
+				if (--open.back().second == 0) open.pop_back();
+			}
+			if (children > 0) open.emplace_back(id, children);
+		}
+		assert(open.empty());
+		// only keep the values that are used by some node
+		for (index h: handles) res.mStore.release(h);
+		return res;
+	}
+
+	bool isConsistent() const {
+		for (auto it = begin_preorder(); it != end_preorder(); ++it) {
+			index prev = NONE;
+			for (index c = mFirstChild[it.current]; c != NONE; c = mNextSibling[c]) {
+				assert(mParent[c] == it.current);
+				assert(mPreviousSibling[c] == prev);
+				assert(mDepth[c] == mDepth[it.current] + 1);
+				prev = c;
+			}
+			assert(prev == mLastChild[it.current]);
+		}
+		return true;
+	}
+};
+
+template<typename T, typename Hash>
+constexpr typename compact_tree<T,Hash>::index compact_tree<T,Hash>::NONE;
+
+template<typename T, typename Hash>
+std::ostream& operator<<(std::ostream& os, const compact_tree<T,Hash>& tree) {
+	for (auto it = tree.begin_preorder(); it != tree.end_preorder(); ++it) {
+		os << std::string(it.depth(), '\t') << *it << std::endl;
+	}
+	return os;
+}
+
+}
@@ -251,6 +251,215 @@ TEST_F(CADTest, Check9)
 	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, cad.getVariables()));
 }
 
+TEST_F(CADTest, ParallelElimination)
+{
+	cad::CADSettings setting = cad::CADSettings::getSettings();
+	setting.eliminationThreads = 4;
+	carl::CAD<Rational> parallel(setting);
+	for (std::size_t i: {0, 3, 5, 8}) {
+		this->cad.addPolynomial(this->p[i], {x, y, z});
+		parallel.addPolynomial(this->p[i], {x, y, z});
+	}
+	this->cad.completeElimination();
+	parallel.completeElimination();
+	ASSERT_EQ(this->cad.getEliminationSets().size(), parallel.getEliminationSets().size());
+	for (std::size_t level = 0; level < parallel.getEliminationSets().size(); level++) {
+		const auto& expected = this->cad.getEliminationSet(level).getPolynomials();
+		const auto& actual = parallel.getEliminationSet(level).getPolynomials();
+		EXPECT_EQ(expected.size(), actual.size());
+		for (auto poly: actual) EXPECT_TRUE(expected.count(poly) == 1);
+	}
+}
+
+TEST_F(CADTest, ModularElimination)
+{
+	cad::CADSettings setting = cad::CADSettings::getSettings();
+	setting.subresultantStrategy = SubresultantStrategy::Modular;
+	carl::CAD<Rational> modular(setting);
+	for (std::size_t i: {0, 3, 5, 6, 8}) {
+		this->cad.addPolynomial(this->p[i], {x, y, z});
+		modular.addPolynomial(this->p[i], {x, y, z});
+	}
+	this->cad.completeElimination();
+	modular.completeElimination();
+	ASSERT_EQ(this->cad.getEliminationSets().size(), modular.getEliminationSets().size());
+	for (std::size_t level = 0; level < modular.getEliminationSets().size(); level++) {
+		const auto& expected = this->cad.getEliminationSet(level).getPolynomials();
+		const auto& actual = modular.getEliminationSet(level).getPolynomials();
+		EXPECT_EQ(expected.size(), actual.size());
+		for (auto poly: actual) EXPECT_TRUE(expected.count(poly) == 1);
+	}
+}
+
+TEST_F(CADTest, ParallelLifting)
+{
+	cad::CADSettings setting = cad::CADSettings::getSettings();
+	setting.liftingThreads = 4;
+	std::vector<std::vector<Constraint>> problems({
+		{ Constraint(this->p[0], Sign::ZERO, {x,y,z}), Constraint(this->p[1], Sign::ZERO, {x,y,z}) },
+		{ Constraint(this->p[0], Sign::NEGATIVE, {x,y,z}), Constraint(this->p[2], Sign::POSITIVE, {x,y,z}) },
+		{ Constraint(this->p[3], Sign::NEGATIVE, {x,y,z}), Constraint(this->p[4], Sign::POSITIVE, {x,y,z}), Constraint(this->p[5], Sign::POSITIVE, {x,y,z}) },
+		{ Constraint(this->p[3], Sign::ZERO, {x,y,z}), Constraint(this->p[8], Sign::POSITIVE, {x,y,z}) },
+		{ Constraint(this->p[4], Sign::NEGATIVE, {x,y,z}), Constraint(this->p[5], Sign::ZERO, {x,y,z}) },
+		{ Constraint(this->p[0], Sign::ZERO, {x,y,z}), Constraint(this->p[2], Sign::ZERO, {x,y,z}), Constraint(this->p[5], Sign::NEGATIVE, {x,y,z}) },
+	});
+	for (auto& cons: problems) {
+		std::vector<RealAlgebraicPoint<Rational>> points;
+		std::vector<carl::cad::Answer> answers;
+		for (bool deterministic: {false, true, true}) {
+			setting.deterministicLifting = deterministic;
+			carl::CAD<Rational> parallel(setting);
+			for (const auto& c: cons) parallel.addPolynomial(c.getPolynomial(), {x, y, z});
+			parallel.prepareElimination();
+			RealAlgebraicPoint<Rational> r;
+			answers.push_back(parallel.check(cons, r, this->bounds));
+			if (answers.back() == carl::cad::Answer::True) {
+				for (const auto& c: cons) EXPECT_TRUE(c.satisfiedBy(r, parallel.getVariables()));
+			}
+			points.push_back(r);
+			// the samples are kept in the sample tree and reused by the next check
+			auto samples = parallel.samples();
+			EXPECT_FALSE(samples.empty());
+			RealAlgebraicPoint<Rational> r2;
+			EXPECT_EQ(answers.back(), parallel.check(cons, r2, this->bounds));
+			if (answers.back() == carl::cad::Answer::False) {
+				EXPECT_EQ(samples.size(), parallel.samples().size());
+			}
+		}
+		carl::CAD<Rational> sequential;
+		for (const auto& c: cons) sequential.addPolynomial(c.getPolynomial(), {x, y, z});
+		sequential.prepareElimination();
+		RealAlgebraicPoint<Rational> r;
+		carl::cad::Answer expected = sequential.check(cons, r, this->bounds);
+		for (auto answer: answers) EXPECT_EQ(expected, answer);
+		if (expected == carl::cad::Answer::True) {
+			ASSERT_EQ(points[1].dim(), points[2].dim());
+			for (std::size_t i = 0; i < points[1].dim(); i++) EXPECT_EQ(points[1][i], points[2][i]);
+		}
+	}
+}
+
+TEST_F(CADTest, CompactSampleTree)
+{
+	using CompactCAD = carl::CAD<Rational, carl::compact_tree<RealAlgebraicNumber<Rational>, carl::RealAlgebraicNumberRepresentationHash<Rational>>>;
+	std::vector<std::vector<Constraint>> problems({
+		{ Constraint(this->p[0], Sign::ZERO, {x,y,z}), Constraint(this->p[1], Sign::ZERO, {x,y,z}) },
+		{ Constraint(this->p[3], Sign::NEGATIVE, {x,y,z}), Constraint(this->p[4], Sign::POSITIVE, {x,y,z}), Constraint(this->p[5], Sign::POSITIVE, {x,y,z}) },
+		{ Constraint(this->p[0], Sign::ZERO, {x,y,z}), Constraint(this->p[2], Sign::ZERO, {x,y,z}), Constraint(this->p[5], Sign::NEGATIVE, {x,y,z}) },
+	});
+	for (auto& cons: problems) {
+		carl::CAD<Rational> cad;
+		CompactCAD compact;
+		for (const auto& c: cons) {
+			cad.addPolynomial(c.getPolynomial(), {x, y, z});
+			compact.addPolynomial(c.getPolynomial(), {x, y, z});
+		}
+		RealAlgebraicPoint<Rational> r;
+		RealAlgebraicPoint<Rational> rc;
+		auto answer = cad.check(cons, r, this->bounds);
+		EXPECT_EQ(answer, compact.check(cons, rc, this->bounds));
+		if (answer == carl::cad::Answer::True) {
+			ASSERT_EQ(r.dim(), rc.dim());
+			for (std::size_t i = 0; i < r.dim(); i++) EXPECT_EQ(r[i], rc[i]);
+		}
+		EXPECT_EQ(cad.samples().size(), compact.samples().size());
+	}
+	// the roots of one polynomial are told apart by their isolating intervals without refining them
+	auto roots = carl::rootfinder::realRoots(UnivariatePolynomial<Rational>(x, {-2, 0, 1}));
+	ASSERT_EQ(std::size_t(2), roots.size());
+	carl::RealAlgebraicNumberRepresentationHash<Rational> hash;
+	EXPECT_NE(hash(roots[0]), hash(roots[1]));
+	EXPECT_EQ(hash(roots[0]), hash(RealAlgebraicNumber<Rational>(roots[0])));
+}
+
+TEST_F(CADTest, PushPop)
+{
+	RealAlgebraicPoint<Rational> r;
+	auto sizes = [this](){
+		this->cad.completeElimination();
+		std::vector<std::size_t> res;
+		for (const auto& es: this->cad.getEliminationSets()) res.push_back(es.size());
+		return res;
+	};
+	std::vector<Constraint> cons({
+		Constraint(this->p[0], Sign::ZERO, {x,y}),
+		Constraint(this->p[2], Sign::ZERO, {x,y})
+	});
+	this->cad.addPolynomial(this->p[0], {x, y});
+	this->cad.addPolynomial(this->p[2], {x, y});
+	EXPECT_EQ(carl::cad::Answer::True, cad.check(cons, r, this->bounds));
+	auto initial = sizes();
+
+	this->cad.push();
+	this->cad.addPolynomial(this->p[1], {x, y});
+	std::vector<Constraint> cons2(cons);
+	cons2.emplace_back(this->p[1], Sign::ZERO, std::vector<carl::Variable>({x,y}));
+	EXPECT_EQ(carl::cad::Answer::False, cad.check(cons2, r, this->bounds));
+	this->cad.pop();
+	EXPECT_EQ(initial, sizes());
+	EXPECT_EQ(carl::cad::Answer::True, cad.check(cons, r, this->bounds));
+	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, cad.getVariables()));
+
+	this->cad.push();
+	this->cad.removePolynomial(this->p[2]);
+	std::vector<Constraint> cons3({ Constraint(this->p[0], Sign::NEGATIVE, {x,y}) });
+	EXPECT_EQ(carl::cad::Answer::True, cad.check(cons3, r, this->bounds));
+	this->cad.push();
+	this->cad.removePolynomial(this->p[0]);
+	this->cad.addPolynomial(this->p[1], {x, y});
+	EXPECT_EQ(2, this->cad.checkpoints());
+	this->cad.pop();
+	this->cad.pop();
+	EXPECT_EQ(0, this->cad.checkpoints());
+	EXPECT_EQ(initial, sizes());
+	EXPECT_EQ(carl::cad::Answer::True, cad.check(cons, r, this->bounds));
+	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, cad.getVariables()));
+}
+
+TEST_F(CADTest, PushPopSamples)
+{
+	RealAlgebraicPoint<Rational> r;
+	std::vector<Constraint> cons({ Constraint(this->p[0], Sign::ZERO, {x,y}) });
+	this->cad.addPolynomial(this->p[0], {x, y});
+	EXPECT_EQ(carl::cad::Answer::True, cad.check(cons, r, this->bounds));
+	auto variables = this->cad.getVariables();
+	auto samples = this->cad.samples().size();
+
+	// variables introduced after the checkpoint are removed with their samples
+	this->cad.push();
+	this->cad.addPolynomial(this->p[11], {z});
+	std::vector<Constraint> cons2(cons);
+	cons2.emplace_back(this->p[11], Sign::ZERO, std::vector<carl::Variable>({z}));
+	EXPECT_EQ(carl::cad::Answer::True, cad.check(cons2, r, this->bounds));
+	EXPECT_EQ(variables.size() + 1, this->cad.getVariables().size());
+	this->cad.pop();
+	EXPECT_EQ(variables, this->cad.getVariables());
+	EXPECT_EQ(samples, this->cad.samples().size());
+
+	// samples erased by a removal are restored
+	this->cad.push();
+	this->cad.removePolynomial(this->p[0]);
+	EXPECT_TRUE(this->cad.samples().empty());
+	this->cad.pop();
+	EXPECT_EQ(samples, this->cad.samples().size());
+	EXPECT_EQ(carl::cad::Answer::True, cad.check(cons, r, this->bounds));
+	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, cad.getVariables()));
+
+	// samples computed after the removal are merged with the restored ones
+	this->cad.push();
+	this->cad.removePolynomial(this->p[0]);
+	this->cad.addPolynomial(this->p[2], {x, y});
+	std::vector<Constraint> cons3({ Constraint(this->p[2], Sign::ZERO, {x,y}) });
+	EXPECT_EQ(carl::cad::Answer::True, cad.check(cons3, r, this->bounds));
+	this->cad.pop();
+	EXPECT_EQ(carl::cad::Answer::True, cad.check(cons, r, this->bounds));
+	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, cad.getVariables()));
+	this->cad.addPolynomial(this->p[2], {x, y});
+	cons.emplace_back(this->p[2], Sign::ZERO, std::vector<carl::Variable>({x,y}));
+	EXPECT_EQ(carl::cad::Answer::True, cad.check(cons, r, this->bounds));
+	for (auto c: cons) EXPECT_TRUE(c.satisfiedBy(r, cad.getVariables()));
+}
+
 TEST_F(CADTest, CheckInt)
 {
 	RealAlgebraicPoint<Rational> r;
@@ -9,6 +9,8 @@
 #include "carl/thom/ThomRootFinder.h"
 #include "carl/thom/ThomEvaluation.h"
 
+#include <thread>
+
 using namespace carl;
 
 TEST(Thom, SignDetermination) {
@@ -70,6 +72,52 @@ TEST(Thom, SignDetermination) {
 }
 
 
+TEST(Thom, MultiplicationTable) {
+        typedef MultivariatePolynomial<Rational> MPolynomial;
+        Variable x = freshRealVariable("x");
+        Variable y = freshRealVariable("y");
+        MPolynomial px({Rational(1)*x*x, Term<Rational>(Rational(-2))});                          // x² - 2
+        MPolynomial py({Rational(1)*y*y, Term<Rational>(Rational(-3))});                          // y² - 3
+        std::vector<MPolynomial> zeroSet = {px, py};
+        GroebnerBase<Rational> gb(zeroSet.begin(), zeroSet.end());
+        MultiplicationTable<Rational> table(gb);
+        ASSERT_EQ(table.getBase().size(), 4);
+
+        MPolynomial a({Rational(2)*x, Rational(1)*y, Term<Rational>(Rational(1))});
+        MPolynomial b({Rational(1)*x*y, Rational(-1)*x});
+        EXPECT_EQ(table.multiply(table.reduce(a), table.reduce(b)), table.reduce(a * b));
+        EXPECT_EQ(table.trace(table.reduce(MPolynomial(Rational(1)))), Rational(4));
+        EXPECT_EQ(table.trace(table.reduce(MPolynomial(x))), Rational(0));
+        EXPECT_EQ(table.trace(table.reduce(MPolynomial(x) * MPolynomial(x))), Rational(8));
+
+        // the roots are (±√2, ±√3)
+        EXPECT_EQ(multivariateTarskiQuery(MPolynomial(Rational(1)), table), 4);
+        EXPECT_EQ(multivariateTarskiQuery(MPolynomial(x), table), 0);
+        EXPECT_EQ(multivariateTarskiQuery(MPolynomial({Rational(1)*x*x, Term<Rational>(Rational(-3))}), table), -4);
+        EXPECT_EQ(multivariateTarskiQuery(MPolynomial({Rational(1)*x*y, Term<Rational>(Rational(3))}), table), 4);
+        EXPECT_EQ(multivariateTarskiQuery(MPolynomial({Rational(1)*x, Rational(1)*y, Term<Rational>(Rational(-1))}), table), -2);
+        EXPECT_EQ(multivariateTarskiQuery(px, table), 0);
+
+        // signatures agree with the sign variations of the characteristic polynomial
+        CoeffMatrix<Rational> m(3, 3);
+        m << 0, 1, 0,
+             1, 0, 0,
+             0, 0, -5;
+        EXPECT_EQ(signature(m), -1);
+        m << 0, 0, 0,
+             0, 0, 0,
+             0, 0, 0;
+        EXPECT_EQ(signature(m), 0);
+        for(const auto& q : {a, b, a * b, px + py}) {
+                CoeffMatrix<Rational> h = table.hermiteMatrix(table.reduce(q));
+                std::vector<Rational> cp = charPol(h);
+                int v1 = int(sign_variations(cp.begin(), cp.end(), sgn<Rational>));
+                for(std::size_t i = 1; i < cp.size(); i += 2) cp[i] = -cp[i];
+                int v2 = int(sign_variations(cp.begin(), cp.end(), sgn<Rational>));
+                EXPECT_EQ(signature(h), v1 - v2);
+        }
+}
+
 TEST(Thom, RootFinder) {
         typedef MultivariatePolynomial<Rational> Polynomial;
         typedef ThomEncoding<Rational> TE;
@@ -185,6 +233,77 @@ TEST(Thom, Comparison) {
         
 }
 
+TEST(Thom, Cache) {
+        typedef MultivariatePolynomial<Rational> Polynomial;
+        typedef ThomEncoding<Rational> TE;
+        Variable x = freshRealVariable("x");
+        Variable y = freshRealVariable("y");
+        std::size_t caches = ThomCache<Rational>::size();
+        {
+                Polynomial poly1({Rational(1)*x*x*x, Rational(-2)*x});                           // x³ - 2x
+                Polynomial poly2({Rational(1)*y*y, Rational(-1)*x});                             // y² - x
+                Polynomial square({Rational(1)*x*x, Term<Rational>(Rational(-1))});              // x² - 1
+
+                std::list<TE> roots = realRootsThom(poly1, x);
+                std::list<TE> rootsAgain = realRootsThom(poly1, x);
+                EXPECT_EQ(roots.size(), 3);
+                // all encodings of roots of the same polynomial share the cache
+                for(const auto& r : roots) EXPECT_EQ(&roots.front().cache(), &r.cache());
+                EXPECT_EQ(&roots.front().cache(), &rootsAgain.back().cache());
+                EXPECT_EQ(ThomCache<Rational>::size(), caches + 1);
+                EXPECT_EQ(roots.front().cache().derivative(2), Polynomial(Rational(6)*x));
+                EXPECT_EQ(roots.front().relevantDerivatives().size(), roots.front().cache().relevant());
+                EXPECT_EQ(roots.front().relevantDerivatives().back(), Polynomial(Rational(6)));
+
+                // the signs are memoised
+                for(int i = 0; i < 2; i++) {
+                        EXPECT_EQ(roots.front().sgn(square), Sign::POSITIVE);
+                        EXPECT_EQ(std::next(roots.begin())->sgn(square), Sign::NEGATIVE);
+                        EXPECT_EQ(roots.back().sgn(square), Sign::POSITIVE);
+                }
+                EXPECT_TRUE(roots.front() < *std::next(roots.begin()));
+                EXPECT_TRUE(rootsAgain.back() == roots.back());
+
+                std::map<Variable, TE> m = {std::make_pair(x, roots.back())};
+                std::list<TE> lifted = realRootsThom(poly2, y, m);
+                std::list<TE> liftedAgain = realRootsThom(poly2, y, m);
+                EXPECT_EQ(lifted.size(), 2);
+                EXPECT_EQ(&lifted.front().cache(), &liftedAgain.back().cache());
+                EXPECT_TRUE(lifted.front() < liftedAgain.back());
+                EXPECT_EQ(ThomCache<Rational>::size(), caches + 2);
+        }
+        // caches are released with the encodings
+        EXPECT_EQ(ThomCache<Rational>::size(), caches);
+}
+
+#ifdef THREAD_SAFE
+TEST(Thom, CacheConcurrentSigns) {
+        typedef MultivariatePolynomial<Rational> Polynomial;
+        typedef ThomEncoding<Rational> TE;
+        Variable x = freshRealVariable("x");
+        Polynomial poly({Rational(1)*x*x*x, Rational(-2)*x});                                    // x³ - 2x
+        std::list<TE> roots = realRootsThom(poly, x);
+        ASSERT_EQ(roots.size(), 3);
+        // all threads query the sign determination shared by the roots
+        std::vector<std::thread> workers;
+        std::vector<Sign> signs(4 * 8);
+        for(std::size_t t = 0; t < 4; t++) {
+                workers.emplace_back([&roots, &signs, x, t]() {
+                        for(std::size_t i = 0; i < 8; i++) {
+                                Polynomial q({Rational(1)*x*x, Term<Rational>(Rational(-1) - Rational(int(i)) / Rational(4))});
+                                signs[t * 8 + i] = roots.back().sgn(q);
+                        }
+                });
+        }
+        for(auto& w : workers) w.join();
+        for(std::size_t i = 0; i < 8; i++) {
+                // the largest root is sqrt(2)
+                Sign expected = i < 4 ? Sign::POSITIVE : (i == 4 ? Sign::ZERO : Sign::NEGATIVE);
+                for(std::size_t t = 0; t < 4; t++) EXPECT_EQ(signs[t * 8 + i], expected);
+        }
+}
+#endif
+
 TEST(Thom, Samples) {
         typedef MultivariatePolynomial<Rational> Polynomial;
         typedef ThomEncoding<Rational> TE;
@@ -0,0 +1,130 @@
+#include "gtest/gtest.h"
+#include "carl/core/CompiledRationalFunction.h"
+#include "carl/core/RationalFunction.h"
+#include "carl/util/stringparser.h"
+
+#include "../Common.h"
+
+#include <algorithm>
+
+using namespace carl;
+
+typedef MultivariatePolynomial<Rational> Pol;
+typedef RationalFunction<Pol> RFunc;
+typedef CompiledRationalFunction<Pol> CFunc;
+
+namespace {
+	/// Points on a small grid in three variables, as rationals.
+	std::vector<std::vector<Rational>> gridPoints() {
+		std::vector<std::vector<Rational>> res;
+		for (int x = -3; x <= 3; ++x) {
+			for (int y = -2; y <= 2; ++y) {
+				for (int z = 1; z <= 3; ++z) {
+					res.push_back({Rational(x, 2), Rational(y, 3), Rational(z)});
+				}
+			}
+		}
+		return res;
+	}
+}
+
+class CompiledRationalFunctionTest : public ::testing::Test {
+protected:
+	CompiledRationalFunctionTest() {
+		sp.setVariables({"x", "y", "z"});
+		x = sp.variables().at("x");
+		y = sp.variables().at("y");
+		z = sp.variables().at("z");
+	}
+	RFunc parse(const std::string& nom, const std::string& denom) {
+		return RFunc(sp.parseMultivariatePolynomial<Rational>(nom), sp.parseMultivariatePolynomial<Rational>(denom));
+	}
+	Rational evaluate(const RFunc& f, const std::vector<Rational>& point) {
+		return f.evaluate({{x, point[0]}, {y, point[1]}, {z, point[2]}});
+	}
+	StringParser sp;
+	Variable x, y, z;
+};
+
+TEST_F(CompiledRationalFunctionTest, Rational)
+{
+	RFunc f = parse("3*x^3*y + x*y*z + 2*x^2*z^2 + 1/7*y^2 + x + 5", "z^2 + 3*x*y*z + 1/2*z + 4");
+	CFunc cf(f, {x, y, z});
+	for (const auto& point: gridPoints()) {
+		EXPECT_EQ(evaluate(f, point), cf.evaluate(point));
+	}
+}
+
+TEST_F(CompiledRationalFunctionTest, Double)
+{
+	RFunc f = parse("3*x^3*y + x*y*z + 2*x^2*z^2 + 1/7*y^2 + x + 5", "z^2 + 1/2*z + 4");
+	CFunc cf(f, {x, y, z});
+	std::vector<double> registers;
+	for (const auto& point: gridPoints()) {
+		std::vector<double> p({toDouble(point[0]), toDouble(point[1]), toDouble(point[2])});
+		EXPECT_NEAR(toDouble(evaluate(f, point)), cf.evaluate(p, registers), 1e-9);
+	}
+}
+
+TEST_F(CompiledRationalFunctionTest, Interval)
+{
+	RFunc f = parse("3*x^3*y + x*y*z + 2*x^2*z^2 + 1/7*y^2 + x + 5", "z^2 + 1/3*z + 4");
+	CFunc cf(f, {x, y, z});
+	for (const auto& point: gridPoints()) {
+		std::vector<Interval<double>> p({Interval<double>(point[0]), Interval<double>(point[1]), Interval<double>(point[2])});
+		Interval<double> res = cf.evaluate(p);
+		EXPECT_TRUE(res.contains(toDouble(evaluate(f, point))));
+		EXPECT_LT(res.diameter(), 1e-9);
+	}
+	// x^2 is evaluated as a power, hence the result is nonnegative.
+	CFunc square(RFunc(Pol(x) * Pol(x)));
+	Interval<double> res = square.evaluate(std::vector<Interval<double>>({Interval<double>(-1.0, 2.0)}));
+	EXPECT_EQ(Interval<double>(0.0, 4.0), res);
+	// The denominator may be zero.
+	CFunc inverse(parse("1", "x"), {x, y, z});
+	res = inverse.evaluate(std::vector<Interval<double>>({Interval<double>(-1.0, 1.0), Interval<double>(0.0), Interval<double>(0.0)}));
+	EXPECT_TRUE(res.isInfinite());
+}
+
+TEST_F(CompiledRationalFunctionTest, Batch)
+{
+	RFunc f = parse("3*x^3*y + x*y*z + 2*x^2*z^2 + 1/7*y^2 + x + 5", "z^2 + 3*x*y*z + 1/2*z + 4");
+	CFunc cf(f, {x, y, z});
+	auto points = gridPoints();
+	std::vector<std::vector<Rational>> columns(3);
+	std::vector<std::vector<double>> doubleColumns(3);
+	for (const auto& point: points) {
+		for (std::size_t i = 0; i < 3; ++i) {
+			columns[i].push_back(point[i]);
+			doubleColumns[i].push_back(toDouble(point[i]));
+		}
+	}
+	std::vector<Rational> res = cf.evaluateBatch(columns);
+	std::vector<double> doubleRes = cf.evaluateBatch(doubleColumns);
+	ASSERT_EQ(points.size(), res.size());
+	ASSERT_EQ(points.size(), doubleRes.size());
+	for (std::size_t i = 0; i < points.size(); ++i) {
+		EXPECT_EQ(evaluate(f, points[i]), res[i]);
+		std::vector<double> p({doubleColumns[0][i], doubleColumns[1][i], doubleColumns[2][i]});
+		EXPECT_EQ(cf.evaluate(p), doubleRes[i]);
+	}
+}
+
+TEST_F(CompiledRationalFunctionTest, Sharing)
+{
+	RFunc f = parse("x^2*y + x^2*z + 3", "x^2*y + x^2*z + x + 1");
+	CFunc cf(f);
+	EXPECT_EQ(std::vector<Variable>({x, y, z}), cf.variables());
+	// Every variable is only loaded once, and the common subexpression y+z is shared between nominator and denominator.
+	const auto& program = cf.program();
+	EXPECT_EQ(3, std::count_if(program.begin(), program.end(), [](const auto& in){ return in.op == CFunc::Opcode::VARIABLE; }));
+	for (std::size_t i = 0; i < program.size(); ++i) {
+		for (std::size_t j = 0; j < i; ++j) {
+			EXPECT_FALSE(program[i].op == program[j].op && program[i].lhs == program[j].lhs && program[i].rhs == program[j].rhs);
+		}
+	}
+
+	CFunc constant(RFunc(Rational(3, 4)));
+	EXPECT_EQ(Rational(3, 4), constant.evaluate(std::vector<Rational>()));
+	EXPECT_EQ(std::vector<double>({0.75}), constant.evaluateBatch(std::vector<std::vector<double>>()));
+}
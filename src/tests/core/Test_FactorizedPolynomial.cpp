@@ -8,6 +8,8 @@
 
 #include "../Common.h"
 
+#include <thread>
+
 using namespace carl;
 
 typedef mpq_class Rational;
@@ -653,3 +655,103 @@ TEST(FactorizedPolynomial, Derivation)
     FPol fp4( p3, pCache );
     EXPECT_EQ( fp4, derivation );
 }
+
+TEST(FactorizedPolynomial, CacheMemoryLimit)
+{
+    carl::VariablePool::getInstance().clear();
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+
+    // The memory limit only suffices for a few entries.
+    std::shared_ptr<CachePol> pCache( new CachePol( 10000, 0.2, 0.98, 4096 ) );
+    std::vector<FPol> products;
+    std::vector<Pol> expected;
+    for( int i = 1; i <= 50; ++i )
+    {
+        Pol a = Pol(x) + Pol(Rational(i));
+        Pol b = Pol(y) * Pol(y) + Pol(Rational(i));
+        FPol fa( a, pCache );
+        FPol fb( b, pCache );
+        FPol fa2( a, pCache );
+        FPol product = fa * fb * fa2;
+        EXPECT_EQ( a * b * a, product.polynomial() );
+        if( i % 5 == 0 )
+        {
+            products.push_back( product );
+            expected.push_back( a * b * a );
+        }
+    }
+    auto statistics = pCache->statistics();
+    EXPECT_GT( statistics.hits, 0u );
+    EXPECT_GT( statistics.misses, 0u );
+    // Unused entries are evicted, the polynomials of entries still in use are released.
+    EXPECT_GT( statistics.evictions, 0u );
+    EXPECT_GT( statistics.releases, 0u );
+    EXPECT_LE( pCache->memoryUsage(), 4096u + products.size() * 1024u );
+    // Released polynomials are recomputed.
+    for( std::size_t i = 0; i < products.size(); ++i )
+    {
+        EXPECT_EQ( expected[i], products[i].polynomial() );
+        EXPECT_EQ( expected[i], computePolynomial( products[i] ) );
+    }
+}
+
+TEST(FactorizedPolynomial, CacheEvictionKeepsPolynomial)
+{
+    carl::VariablePool::getInstance().clear();
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+
+    std::shared_ptr<CachePol> pCache( new CachePol( 10000, 0.2, 0.98, 4096 ) );
+    FPol fa( Pol(x) + Pol(Rational(1)), pCache );
+    FPol fb( Pol(y) + Pol(Rational(2)), pCache );
+    FPol product = fa * fb;
+    // The expanded polynomial of the product is computed lazily.
+    const Pol& polynomial = product.polynomial();
+    Pol expected = (Pol(x) + Pol(Rational(1))) * (Pol(y) + Pol(Rational(2)));
+    EXPECT_EQ( expected, polynomial );
+    auto evictions = pCache->statistics().evictions;
+    for( int i = 3; i <= 60; ++i )
+    {
+        FPol f( Pol(x) * Pol(y) + Pol(Rational(i)), pCache );
+        FPol g = f * fa;
+        EXPECT_EQ( (Pol(x) * Pol(y) + Pol(Rational(i))) * (Pol(x) + Pol(Rational(1))), g.polynomial() );
+    }
+    EXPECT_GT( pCache->statistics().evictions, evictions );
+    // The reference obtained before the eviction still refers to the polynomial of the product.
+    EXPECT_EQ( &polynomial, &product.polynomial() );
+    EXPECT_EQ( expected, polynomial );
+}
+
+#ifdef THREAD_SAFE
+TEST(FactorizedPolynomial, CacheConcurrentUsage)
+{
+    carl::VariablePool::getInstance().clear();
+    Variable x = freshRealVariable("x");
+
+    std::shared_ptr<CachePol> pCache( new CachePol );
+    std::vector<FPol> fpolys;
+    for( int i = 1; i <= 8; ++i )
+    {
+        fpolys.emplace_back( Pol(x) + Pol(Rational(i)), pCache );
+    }
+    // Copying registers and destroying deregisters the entries concurrently.
+    std::vector<std::thread> workers;
+    for( std::size_t t = 0; t < 4; ++t )
+    {
+        workers.emplace_back( [&fpolys,t]() {
+            for( std::size_t n = 0; n < 1000; ++n )
+            {
+                std::vector<FPol> copies( 16, fpolys[(t + n) % fpolys.size()] );
+                copies.emplace_back( fpolys[n % fpolys.size()] );
+            }
+        } );
+    }
+    for( auto& w: workers ) w.join();
+    for( int i = 1; i <= 8; ++i )
+    {
+        EXPECT_EQ( Pol(x) + Pol(Rational(i)), computePolynomial( fpolys[std::size_t(i-1)] ) );
+    }
+    EXPECT_EQ( 0u, pCache->statistics().evictions );
+}
+#endif
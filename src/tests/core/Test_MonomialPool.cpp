@@ -2,6 +2,11 @@
 
 #include "carl/core/MonomialPool.h"
 
+#include <set>
+#ifdef THREAD_SAFE
+#include <thread>
+#endif
+
 using namespace carl;
 
 TEST(MonomialPool, singleton)
@@ -29,3 +34,52 @@ TEST(MonomialPool, clear)
 	auto m = createMonomial(x, 3);
 	EXPECT_EQ(pool.size(), 1);
 }
+
+TEST(MonomialPool, ids)
+{
+	MonomialPool& pool = MonomialPool::getInstance();
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	std::vector<Monomial::Arg> monomials;
+	for (exponent e = 1; e < 50; ++e) {
+		monomials.push_back(MonomialPool::getInstance().create({std::make_pair(x, e), std::make_pair(y, e)}));
+	}
+	std::set<std::size_t> ids;
+	for (const auto& m: monomials) {
+		EXPECT_EQ(m, MonomialPool::getInstance().create({std::make_pair(x, m->tdeg() / 2), std::make_pair(y, m->tdeg() / 2)}));
+		EXPECT_NE(m->id(), 0);
+		EXPECT_LE(m->id(), pool.largestID());
+		ids.insert(m->id());
+	}
+	EXPECT_EQ(ids.size(), monomials.size());
+}
+
+#ifdef THREAD_SAFE
+TEST(MonomialPool, concurrent)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	const std::size_t threads = 8;
+	std::vector<std::vector<Monomial::Arg>> results(threads);
+	std::vector<std::thread> workers;
+	for (std::size_t t = 0; t < threads; ++t) {
+		workers.emplace_back([&results,t,x,y](){
+			for (std::size_t i = 0; i < 200; ++i) {
+				exponent e = exponent(i % 40 + 1);
+				results[t].push_back(MonomialPool::getInstance().create({std::make_pair(x, e), std::make_pair(y, exponent(t % 2 + 1))}));
+				// Create and immediately free some monomials.
+				MonomialPool::getInstance().create({std::make_pair(y, e + 100)});
+			}
+		});
+	}
+	for (auto& w: workers) w.join();
+	for (std::size_t t = 0; t < threads; ++t) {
+		for (std::size_t i = 0; i < results[t].size(); ++i) {
+			const auto& m = results[t][i];
+			const auto& ref = results[t % 2][i];
+			EXPECT_EQ(m, ref);
+			EXPECT_EQ(m->id(), ref->id());
+		}
+	}
+}
+#endif
@@ -53,3 +53,70 @@ TEST(MultivariateGCD, test1)
     P h2({(Rational)1*y});
     EXPECT_EQ( carl::gcd( h1, h2 ), h2 );
 }
+
+template<typename T>
+class ModularGCDTest: public testing::Test {};
+
+using GMPTypes = testing::Types<mpz_class, mpq_class>;
+TYPED_TEST_CASE(ModularGCDTest, GMPTypes);
+
+template<typename P>
+P positive(const P& p) {
+	return carl::isNegative(p.lcoeff()) ? -p : p;
+}
+
+TYPED_TEST(ModularGCDTest, Brown)
+{
+	using P = MultivariatePolynomial<TypeParam>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	P px(x), py(y), pz(z);
+	P g = px * py - TypeParam(3) * pz * pz + TypeParam(2);
+	P f1 = px * px + py * pz - TypeParam(1);
+	P f2 = TypeParam(5) * px * pz + py * py * py + TypeParam(7);
+	EXPECT_EQ(positive(g), positive(carl::modular_gcd(g * f1, g * f2)));
+	// Over the rationals, the integer content is a unit.
+	TypeParam content = carl::is_field<TypeParam>::value ? TypeParam(1) : TypeParam(2);
+	EXPECT_EQ(content * positive(g), positive(carl::modular_gcd(TypeParam(6) * g * f1, TypeParam(-4) * g * g * f2)));
+	EXPECT_EQ(content * positive(g), positive(carl::modular_gcd(TypeParam(6) * g * f1, TypeParam(4) * g * f2)));
+	EXPECT_EQ(P(1), carl::modular_gcd(f1, f2));
+	// Different variables in the inputs and nontrivial contents in z.
+	EXPECT_EQ(positive((pz + TypeParam(1)) * py), positive(carl::modular_gcd(px * py * (pz + TypeParam(1)), py * py * (pz * pz - TypeParam(1)))));
+	EXPECT_EQ(P(1), carl::modular_gcd(px * py + TypeParam(1), pz));
+	// The leading coefficient is positive.
+	EXPECT_EQ(py, carl::modular_gcd(px * py, -py));
+	EXPECT_EQ(py, carl::modular_gcd(-px * py, -py));
+	EXPECT_EQ(py, carl::gcd(-px * py, -py));
+	EXPECT_EQ(P(1), carl::modular_gcd(-px * py, -pz));
+	EXPECT_EQ(P(1), carl::modular_gcd(-px * px, py - px));
+}
+
+TYPED_TEST(ModularGCDTest, Zippel)
+{
+	using P = MultivariatePolynomial<TypeParam>;
+	std::vector<P> vars;
+	for (std::size_t i = 0; i < 4; ++i) vars.emplace_back(freshRealVariable());
+	P g(TypeParam(1));
+	P f1(TypeParam(3));
+	P f2(TypeParam(-5));
+	for (std::size_t i = 0; i < vars.size(); ++i) {
+		const P& v = vars[i];
+		const P& w = vars[(i + 1) % vars.size()];
+		g += TypeParam(int(2 * i) - 5) * v * v * v * w + TypeParam(123456789) * v;
+		f1 += TypeParam(int(i) + 1) * v * w * w;
+		f2 += TypeParam(7) * v * v * w * w - v;
+	}
+	EXPECT_EQ(positive(g), positive(carl::modular_gcd(g * f1, g * f2)));
+	EXPECT_EQ(positive(g * g), positive(carl::modular_gcd(g * g * f1 * f1, g * g * g * f2)));
+}
+
+TEST(ModularGCD, Rational)
+{
+	using P = MultivariatePolynomial<Rational>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	P px(x), py(y);
+	P g = px * py + Rational(1,2);
+	EXPECT_EQ(Rational(2) * px * py + Rational(1), carl::modular_gcd(Rational(1,3) * g * (px + py), g * (px - py)));
+}
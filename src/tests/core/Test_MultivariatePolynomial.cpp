@@ -185,6 +185,71 @@ TYPED_TEST(MultivariatePolynomialTest, Multiplication)
     //std::cout << p0 << std::endl;
 }
 
+template<MultiplicationStrategy S>
+struct MultiplicationPolicy: public StdMultivariatePolynomialPolicies<> {
+	static const MultiplicationStrategy multiplication = S;
+	static const std::size_t heapMultiplicationThreshold = 16;
+};
+
+template<typename C, typename O>
+void checkHeapMultiplication(const std::vector<MultivariatePolynomial<C,O>>& polys) {
+	using HeapPoly = MultivariatePolynomial<C, O, MultiplicationPolicy<MultiplicationStrategy::Heap>>;
+	using TAPoly = MultivariatePolynomial<C, O, MultiplicationPolicy<MultiplicationStrategy::TermAddition>>;
+	using Poly = MultivariatePolynomial<C, O>;
+	for (const auto& p: polys) {
+		for (const auto& q: polys) {
+			HeapPoly h = HeapPoly(p) * HeapPoly(q);
+			TAPoly t = TAPoly(p) * TAPoly(q);
+			if (O::degreeOrder) EXPECT_TRUE(h.isOrdered());
+			EXPECT_EQ(Poly(t), Poly(h));
+		}
+	}
+}
+
+TYPED_TEST(MultivariatePolynomialTest, HeapMultiplication)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	MultivariatePolynomial<TypeParam> px(x);
+	MultivariatePolynomial<TypeParam> py(y);
+	MultivariatePolynomial<TypeParam> pz(z);
+	MultivariatePolynomial<TypeParam> dense = (px + py + pz + TypeParam(1)) * (px - py + TypeParam(2)) * (px * pz - TypeParam(3));
+	std::vector<MultivariatePolynomial<TypeParam>> polys = {
+		px + py,
+		px - py,
+		px * px * py - TypeParam(7),
+		dense,
+		dense * px * pz - py * py * py,
+		px * px * px * px * px * py + py * py * py * py * pz * pz + TypeParam(2) * pz * pz * pz * pz * pz * pz * pz
+	};
+	checkHeapMultiplication(polys);
+	std::vector<MultivariatePolynomial<TypeParam, LexOrdering>> lexPolys;
+	for (const auto& p: polys) {
+		lexPolys.emplace_back(std::vector<Term<TypeParam>>(p.begin(), p.end()));
+	}
+	checkHeapMultiplication(lexPolys);
+}
+
+TYPED_TEST(MultivariatePolynomialTest, AutoMultiplication)
+{
+	using AutoPoly = MultivariatePolynomial<TypeParam, GrLexOrdering, MultiplicationPolicy<MultiplicationStrategy::Auto>>;
+	using TAPoly = MultivariatePolynomial<TypeParam, GrLexOrdering, MultiplicationPolicy<MultiplicationStrategy::TermAddition>>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	MultivariatePolynomial<TypeParam> p = MultivariatePolynomial<TypeParam>(x) + y + z + TypeParam(1);
+	MultivariatePolynomial<TypeParam> q = MultivariatePolynomial<TypeParam>(x) - y + TypeParam(2);
+	// 4 * 3 term products are below the threshold of 16, hence the terms are added.
+	AutoPoly small = AutoPoly(p) * AutoPoly(q);
+	EXPECT_FALSE(small.isOrdered());
+	EXPECT_EQ(MultivariatePolynomial<TypeParam>(TAPoly(p) * TAPoly(q)), MultivariatePolynomial<TypeParam>(small));
+	// 4 * 4 term products reach the threshold, hence the heap is used.
+	AutoPoly large = AutoPoly(p) * AutoPoly(p);
+	EXPECT_TRUE(large.isOrdered());
+	EXPECT_EQ(MultivariatePolynomial<TypeParam>(TAPoly(p) * TAPoly(p)), MultivariatePolynomial<TypeParam>(large));
+}
+
 TEST(MultivariatePolynomial, toString)
 {
 
@@ -67,3 +67,63 @@ TEST(RealAlgebraicNumber, Evaluation2)
 	auto res = RealAlgebraicNumberEvaluation::evaluate(MultivariatePolynomial<Rational>(mp), point, vars);
 	std::cerr << res << std::endl;
 }
+
+TEST(RealAlgebraicNumber, Sign)
+{
+	Variable x = freshRealVariable("x");
+	UnivariatePolynomial<Rational> p(x, std::initializer_list<Rational>{-2, 0, 1});
+	RealAlgebraicNumber<Rational> sqrt2(p, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+
+	EXPECT_EQ(Sign::ZERO, sqrt2.sgn(p));
+	EXPECT_EQ(Sign::ZERO, sqrt2.sgn(p * UnivariatePolynomial<Rational>(x, std::initializer_list<Rational>{-3, 1})));
+	EXPECT_EQ(Sign::POSITIVE, sqrt2.sgn(UnivariatePolynomial<Rational>(x, std::initializer_list<Rational>{Rational(-1414213)/1000000, 1})));
+	EXPECT_EQ(Sign::NEGATIVE, sqrt2.sgn(UnivariatePolynomial<Rational>(x, std::initializer_list<Rational>{Rational(-1414214)/1000000, 1})));
+	// x^2 + 2x - 1 has the roots -1 - sqrt(2) and -1 + sqrt(2).
+	EXPECT_EQ(Sign::POSITIVE, sqrt2.sgn(UnivariatePolynomial<Rational>(x, std::initializer_list<Rational>{-1, 2, 1})));
+	EXPECT_TRUE(sqrt2.isRootOf(p * UnivariatePolynomial<Rational>(x, std::initializer_list<Rational>{-5, 0, 1})));
+	EXPECT_FALSE(sqrt2.isRootOf(UnivariatePolynomial<Rational>(x, std::initializer_list<Rational>{-3, 0, 1})));
+	EXPECT_TRUE(sqrt2 < RealAlgebraicNumber<Rational>(Rational(1415)/1000));
+	EXPECT_TRUE(RealAlgebraicNumber<Rational>(Rational(1414)/1000) < sqrt2);
+}
+
+TEST(RealAlgebraicNumber, SignEvaluation)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	MultivariatePolynomial<Rational> mpx(x);
+	MultivariatePolynomial<Rational> mpy(y);
+	MultivariatePolynomial<Rational> mpz(z);
+	UnivariatePolynomial<Rational> p2(x, std::initializer_list<Rational>{-2, 0, 1});
+	UnivariatePolynomial<Rational> p3(y, std::initializer_list<Rational>{-3, 0, 1});
+	RealAlgebraicNumberEvaluation::RANMap<Rational> m;
+	m.emplace(x, RealAlgebraicNumber<Rational>(p2, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT)));
+	m.emplace(y, RealAlgebraicNumber<Rational>(p3, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT)));
+	m.emplace(z, RealAlgebraicNumber<Rational>(Rational(1, 2)));
+
+	auto& stats = RealAlgebraicNumberEvaluation::signStatistics();
+	stats = RealAlgebraicNumberEvaluation::SignStatistics();
+	// x + y is positive on (1,2) x (1,2).
+	EXPECT_EQ(Sign::POSITIVE, RealAlgebraicNumberEvaluation::sgn(mpx + mpy, m));
+	EXPECT_EQ(1, stats.floatingPoint);
+	// sqrt(2) - 7/5 and sqrt(2)*sqrt(3) - 5/2 need a few refinements.
+	EXPECT_EQ(Sign::POSITIVE, RealAlgebraicNumberEvaluation::sgn(mpx - Rational(7, 5), m));
+	EXPECT_EQ(Sign::NEGATIVE, RealAlgebraicNumberEvaluation::sgn(mpx * mpy - Rational(5, 2), m));
+	EXPECT_EQ(2, stats.refinement);
+	// Zero can only be decided by the fallback.
+	EXPECT_EQ(Sign::ZERO, RealAlgebraicNumberEvaluation::sgn(mpx * mpx * mpz - Rational(1), m));
+	EXPECT_EQ(Sign::ZERO, RealAlgebraicNumberEvaluation::sgn(mpx * mpx * mpy * mpy - Rational(6), m));
+	EXPECT_EQ(2, stats.fallback);
+	EXPECT_EQ(Sign::NEGATIVE, RealAlgebraicNumberEvaluation::sgn(mpz - Rational(1), m));
+	EXPECT_EQ(1, stats.numeric);
+
+	std::vector<MultivariatePolynomial<Rational>> polys({
+		mpx * mpy - mpz * Rational(5),
+		mpx * mpx - mpy * mpy + Rational(1),
+		mpx * mpx * mpx - mpy * Rational(2),
+		mpx * mpy * mpz - Rational(1)
+	});
+	for (const auto& p: polys) {
+		EXPECT_EQ(RealAlgebraicNumberEvaluation::evaluate(p, m).sgn(), RealAlgebraicNumberEvaluation::sgn(p, m));
+	}
+}
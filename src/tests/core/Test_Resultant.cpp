@@ -42,3 +42,55 @@ TEST(Resultant, det)
     //EXPECT_EQ(r3, r1);
     //EXPECT_EQ(r3, r2);
 }
+
+TEST(Resultant, Modular)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	using MP = MultivariatePolynomial<Rational>;
+	using UP = UnivariatePolynomial<MP>;
+	MP X(x), Y(y), Z(z);
+	std::vector<MP> polys = {
+		X*X + Y*Y - MP(1),
+		X - Y + MP(1),
+		X*X + Y*Y + Z*Z - MP(1),
+		X*Y - X - Y + MP(1),
+		X*X*X + Y*Y*Y + Z*Z*Z - MP(1),
+		MP(Rational(1, 2)) * X*X*X*Y*Z - MP(Rational(7, 3)) * X*Y + Z*Z*Y - MP(5),
+		(X*Y - Z) * (X*X + Y*Z + MP(1)),
+		(X*Y - Z) * (X*Z - Y),
+	};
+	for (const auto& p: polys) {
+		UP up = p.toUnivariatePolynomial(x);
+		if (up.degree() > 1) {
+			EXPECT_EQ(discriminant(up, SubresultantStrategy::Lazard), discriminant(up, SubresultantStrategy::Modular));
+		}
+		for (const auto& q: polys) {
+			UP uq = q.toUnivariatePolynomial(x);
+			EXPECT_EQ(resultant(up, uq, SubresultantStrategy::Lazard), resultant(up, uq, SubresultantStrategy::Modular));
+			EXPECT_EQ(principalSubresultantsCoefficients(up, uq, SubresultantStrategy::Lazard), principalSubresultantsCoefficients(up, uq, SubresultantStrategy::Modular));
+		}
+	}
+
+	UP p = polys[6].toUnivariatePolynomial(x);
+	UP q = polys[7].toUnivariatePolynomial(x);
+	EXPECT_TRUE(carl::isZero(resultant(p, q, SubresultantStrategy::Modular)));
+	EXPECT_EQ(resultant(p, polys[4].toUnivariatePolynomial(x), SubresultantStrategy::Lazard), resultant(p, polys[4].toUnivariatePolynomial(x), SubresultantStrategy::Modular));
+}
+
+TEST(Resultant, ModularUnluckyPrime)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	using MP = MultivariatePolynomial<Rational>;
+	using UP = UnivariatePolynomial<MP>;
+	MP X(x), Y(y);
+	// The first prime that is used: modulo this prime, p and q have the common factor x - y.
+	MP prime(Rational(4294967291u));
+	UP p = (X*X - Y*Y).toUnivariatePolynomial(x);
+	UP q = (X - Y - prime).toUnivariatePolynomial(x);
+	EXPECT_FALSE(carl::isZero(resultant(p, q, SubresultantStrategy::Lazard)));
+	EXPECT_EQ(resultant(p, q, SubresultantStrategy::Lazard), resultant(p, q, SubresultantStrategy::Modular));
+	EXPECT_EQ(principalSubresultantsCoefficients(p, q, SubresultantStrategy::Lazard), principalSubresultantsCoefficients(p, q, SubresultantStrategy::Modular));
+}
@@ -103,3 +103,39 @@ TEST(RootFinder, Chebyshev)
 		EXPECT_TRUE(mone <= r && r <= pone);
 	}
 }
+
+TEST(RootFinder, Descartes)
+{
+	carl::Variable x = freshRealVariable("x");
+	for (auto strategy: {rootfinder::SplittingStrategy::DESCARTES, rootfinder::SplittingStrategy::BITSTREAM}) {
+		{
+			// Integral roots, some of them are hit exactly by bisection.
+			UPolynomial p(x, Rational(1));
+			for (int i = -5; i <= 5; ++i) p *= UPolynomial(x, {Rational(-i), Rational(1)});
+			auto roots = rootfinder::realRoots(p, strategy);
+			EXPECT_TRUE(roots.size() == 11);
+			std::sort(roots.begin(), roots.end());
+			for (std::size_t i = 0; i < roots.size(); ++i) {
+				EXPECT_TRUE(represents(roots[i], Rational(int(i) - 5)));
+			}
+		}
+		{
+			// Two close irrational roots and a multiple root.
+			UPolynomial p = UPolynomial(x, {Rational(-2), Rational(0), Rational(1)}) * UPolynomial(x, {Rational(-1000001), Rational(0), Rational(1000000)}) * UPolynomial(x, {Rational(-3), Rational(1)}).pow(2);
+			auto roots = rootfinder::realRoots(p, strategy);
+			EXPECT_TRUE(roots.size() == 5);
+			std::sort(roots.begin(), roots.end());
+			EXPECT_TRUE(roots[2] < RealAlgebraicNumber<Rational>(Rational(1000001, 1000000)));
+			EXPECT_TRUE(represents(roots[4], Rational(3)));
+		}
+		{
+			carl::Chebyshev<Rational> chebyshev(x);
+			auto roots = rootfinder::realRoots(chebyshev(30), strategy);
+			EXPECT_TRUE(roots.size() == 30);
+		}
+		{
+			UPolynomial p(x, {Rational(1), Rational(0), Rational(1)});
+			EXPECT_TRUE(rootfinder::realRoots(p, strategy).empty());
+		}
+	}
+}
@@ -499,3 +499,88 @@ TEST(UnivariatePolynomial, coprimeFactor)
 
 	ASSERT_EQ(carl::getDenom(pol.coprimeFactor()), 1);
 }
+
+TEST(UnivariatePolynomial, DenseArithmetic)
+{
+	Variable x = freshRealVariable("x");
+	std::mt19937 rng(42);
+	std::uniform_int_distribution<int> dist(-1000, 1000);
+	auto randomPolynomial = [&](std::size_t degree){
+		std::vector<Rational> coeffs;
+		for (std::size_t i = 0; i <= degree; i++) {
+			coeffs.emplace_back(Rational(dist(rng)) / Rational(1 + std::abs(dist(rng)) % 10));
+		}
+		coeffs.back() += 1001;
+		return UnivariatePolynomial<Rational>(x, coeffs);
+	};
+	auto karatsuba = DenseArithmeticSettings::karatsubaThreshold;
+	auto taylorShift = DenseArithmeticSettings::taylorShiftThreshold;
+	auto newtonDivision = DenseArithmeticSettings::newtonDivisionThreshold;
+	for (std::size_t degree: {3, 17, 64, 100}) {
+		UnivariatePolynomial<Rational> p = randomPolynomial(2 * degree + 5);
+		UnivariatePolynomial<Rational> q = randomPolynomial(degree);
+
+		DenseArithmeticSettings::karatsubaThreshold = std::numeric_limits<std::size_t>::max();
+		DenseArithmeticSettings::taylorShiftThreshold = std::numeric_limits<std::size_t>::max();
+		DenseArithmeticSettings::newtonDivisionThreshold = std::numeric_limits<std::size_t>::max();
+		UnivariatePolynomial<Rational> product = p * q;
+		UnivariatePolynomial<Rational> shifted(p);
+		shifted.shift(Rational(-7) / Rational(3));
+		auto division = p.divideBy(q);
+		UnivariatePolynomial<Rational> remainder = p.remainder(q);
+
+		DenseArithmeticSettings::karatsubaThreshold = 4;
+		DenseArithmeticSettings::taylorShiftThreshold = 4;
+		DenseArithmeticSettings::newtonDivisionThreshold = 4;
+		EXPECT_EQ(product, p * q);
+		UnivariatePolynomial<Rational> fastShifted(p);
+		fastShifted.shift(Rational(-7) / Rational(3));
+		EXPECT_EQ(shifted, fastShifted);
+		auto fastDivision = p.divideBy(q);
+		EXPECT_EQ(division.quotient, fastDivision.quotient);
+		EXPECT_EQ(division.remainder, fastDivision.remainder);
+		EXPECT_EQ(remainder, p.remainder(q));
+	}
+	DenseArithmeticSettings::karatsubaThreshold = karatsuba;
+	DenseArithmeticSettings::taylorShiftThreshold = taylorShift;
+	DenseArithmeticSettings::newtonDivisionThreshold = newtonDivision;
+}
+
+TEST(UnivariatePolynomial, WordGaloisField)
+{
+	using WordPoly = UnivariatePolynomial<GFNumber<carl::uint>>;
+	Variable x = freshRealVariable("x");
+	std::mt19937_64 rng(42);
+	for (carl::uint p: {carl::uint(2147483629), carl::uint(9223372036854775783u)}) {
+		const auto* gf = GaloisFieldManager<carl::uint>::getInstance().getField(p);
+		auto randomPolynomial = [&](std::size_t degree){
+			std::vector<mpz_class> coeffs;
+			for (std::size_t i = 0; i <= degree; i++) {
+				coeffs.emplace_back(static_cast<unsigned long>(rng() % p));
+			}
+			if (coeffs.back() == 0) coeffs.back() = 1;
+			return UnivariatePolynomial<mpz_class>(x, coeffs);
+		};
+		for (std::size_t degree: {1, 5, 30}) {
+			UnivariatePolynomial<mpz_class> a = randomPolynomial(2 * degree + 3);
+			UnivariatePolynomial<mpz_class> b = randomPolynomial(degree);
+			UnivariatePolynomial<mpz_class> c = randomPolynomial(degree / 2 + 1);
+			WordPoly aw = a.toFiniteDomain(gf);
+			WordPoly bw = b.toFiniteDomain(gf);
+			WordPoly cw = c.toFiniteDomain(gf);
+
+			EXPECT_EQ((a * b).toFiniteDomain(gf), aw * bw);
+			auto division = aw.divideBy(bw);
+			EXPECT_EQ(aw, bw * division.quotient + division.remainder);
+			EXPECT_TRUE(carl::isZero(division.remainder) || division.remainder.degree() < bw.degree());
+			EXPECT_EQ(division.remainder, aw.remainder(bw));
+			EXPECT_EQ(cw.normalized(), carl::gcd(aw * cw, bw * cw));
+		}
+	}
+	// Negative and rational coefficients are mapped to their residue classes.
+	const auto* gf5 = GaloisFieldManager<carl::uint>::getInstance().getField(5);
+	UnivariatePolynomial<mpz_class> negative(x, {mpz_class(-7), mpz_class(3), mpz_class(10)});
+	EXPECT_EQ(WordPoly(x, {GFNumber<carl::uint>(3, gf5), GFNumber<carl::uint>(3, gf5)}), negative.toFiniteDomain(gf5));
+	UnivariatePolynomial<Rational> rational(x, {Rational(-1), Rational(6)});
+	EXPECT_EQ(WordPoly(x, {GFNumber<carl::uint>(4, gf5), GFNumber<carl::uint>(1, gf5)}), rational.toFiniteDomain(gf5));
+}
@@ -3,6 +3,7 @@
 #include <carl/formula/bitvector/BVValue.h>
 
 #include <boost/dynamic_bitset.hpp>
+#include <random>
 
 #include "../Common.h"
 
@@ -218,3 +219,152 @@ TYPED_TEST(BVValueTest, Multiplication)
 	EXPECT_EQ(carl::BVValue(32, 1073741823), this->bv32_e30 * this->bv32_1);
 	EXPECT_EQ(carl::BVValue(32, 2147483649), this->bv32_e30 * this->bv32_e30);
 }
+
+namespace reference {
+	// The former bit-by-bit implementations of the arithmetic operations.
+	BDB add(const BDB& lhs, const BDB& rhs) {
+		bool carry = false;
+		BDB sum(lhs.size());
+		for (std::size_t i = 0; i < lhs.size(); ++i) {
+			sum[i] = (lhs[i] != rhs[i]) != carry;
+			carry = (lhs[i] && rhs[i]) || (carry && (lhs[i] || rhs[i]));
+		}
+		return sum;
+	}
+	BDB negate(const BDB& val) {
+		return add(~val, BDB(val.size(), 1));
+	}
+	BDB multiply(const BDB& lhs, const BDB& rhs) {
+		BDB product(lhs.size());
+		BDB summand(lhs);
+		for (std::size_t i = 0; i < lhs.size(); ++i) {
+			if (rhs[i]) product = add(product, summand);
+			summand <<= 1;
+		}
+		return product;
+	}
+	BDB divide(const BDB& lhs, const BDB& rhs, bool returnRemainder) {
+		BDB quotient(lhs.size());
+		std::size_t quotientIndex = 0;
+		BDB divisor(rhs);
+		BDB remainder(lhs);
+		while (!divisor[divisor.size() - 1] && remainder > divisor) {
+			++quotientIndex;
+			divisor <<= 1;
+		}
+		while (true) {
+			if (remainder >= divisor) {
+				quotient[quotientIndex] = true;
+				bool carry = false;
+				for (std::size_t i = divisor.find_first(); i < remainder.size(); ++i) {
+					bool newRemainderI = (remainder[i] != divisor[i]) != carry;
+					carry = (remainder[i] && carry && divisor[i]) || (!remainder[i] && (carry || divisor[i]));
+					remainder[i] = newRemainderI;
+				}
+			}
+			if (quotientIndex == 0) break;
+			divisor >>= 1;
+			--quotientIndex;
+		}
+		return returnRemainder ? remainder : quotient;
+	}
+	BDB divideSigned(const BDB& lhs, const BDB& rhs) {
+		bool ln = lhs[lhs.size() - 1];
+		bool rn = rhs[rhs.size() - 1];
+		BDB q = divide(ln ? negate(lhs) : lhs, rn ? negate(rhs) : rhs, false);
+		return ln != rn ? negate(q) : q;
+	}
+	BDB remSigned(const BDB& lhs, const BDB& rhs) {
+		bool ln = lhs[lhs.size() - 1];
+		bool rn = rhs[rhs.size() - 1];
+		if (!ln && !rn) return divide(lhs, rhs, true);
+		if (ln && !rn) return negate(divide(negate(lhs), rhs, true));
+		if (!ln && rn) return divide(lhs, negate(rhs), true);
+		return negate(divide(lhs, negate(rhs), true));
+	}
+	BDB modSigned(const BDB& lhs, const BDB& rhs) {
+		bool ln = lhs[lhs.size() - 1];
+		bool rn = rhs[rhs.size() - 1];
+		BDB u = divide(ln ? negate(lhs) : lhs, rn ? negate(rhs) : rhs, true);
+		if (u.none() || (!ln && !rn)) return u;
+		if (ln && !rn) return add(negate(u), rhs);
+		if (!ln && rn) return add(lhs, rhs);
+		return negate(u);
+	}
+	BDB shift(const BDB& value, const BDB& amount, bool left, bool arithmetic) {
+		std::size_t firstSize = value.size() - 1;
+		std::size_t highestRelevantPos = 0;
+		bool fillWithOnes = !left && arithmetic && value[value.size() - 1];
+		while ((firstSize >>= 1) != 0) ++highestRelevantPos;
+		for (std::size_t i = highestRelevantPos + 1; i < amount.size(); ++i) {
+			if (amount[i]) {
+				BDB allZero(value.size());
+				return fillWithOnes ? ~allZero : allZero;
+			}
+		}
+		BDB shifted(fillWithOnes ? ~value : value);
+		std::size_t shiftBy = 1;
+		for (std::size_t i = 0; i <= highestRelevantPos && i < amount.size(); ++i) {
+			if (amount[i]) {
+				if (left) shifted <<= shiftBy;
+				else shifted >>= shiftBy;
+			}
+			shiftBy *= 2;
+		}
+		return fillWithOnes ? ~shifted : shifted;
+	}
+}
+
+namespace {
+	void checkArithmetic(const carl::BVValue& a, const carl::BVValue& b) {
+		const BDB& x = a.base();
+		const BDB& y = b.base();
+		EXPECT_EQ(reference::add(x, y), (a + b).base()) << a << " + " << b;
+		EXPECT_EQ(reference::add(x, reference::negate(y)), (a - b).base()) << a << " - " << b;
+		EXPECT_EQ(reference::multiply(x, y), (a * b).base()) << a << " * " << b;
+		EXPECT_EQ(reference::shift(x, y, true, false), (a << b).base()) << a << " << " << b;
+		EXPECT_EQ(reference::shift(x, y, false, false), (a >> b).base()) << a << " >> " << b;
+		EXPECT_EQ(reference::shift(x, y, false, true), a.rightShiftArithmetic(b).base()) << a << " >>a " << b;
+		if (b.isZero()) return;
+		EXPECT_EQ(reference::divide(x, y, false), (a / b).base()) << a << " / " << b;
+		EXPECT_EQ(reference::divide(x, y, true), (a % b).base()) << a << " % " << b;
+		EXPECT_EQ(reference::divideSigned(x, y), a.divideSigned(b).base()) << a << " sdiv " << b;
+		EXPECT_EQ(reference::remSigned(x, y), a.remSigned(b).base()) << a << " srem " << b;
+		EXPECT_EQ(reference::modSigned(x, y), a.modSigned(b).base()) << a << " smod " << b;
+	}
+}
+
+TEST(BVValue, ArithmeticExhaustive)
+{
+	for (std::size_t width = 1; width <= 6; ++width) {
+		for (unsigned i = 0; i < (1u << width); ++i) {
+			for (unsigned j = 0; j < (1u << width); ++j) {
+				checkArithmetic(carl::BVValue(width, i), carl::BVValue(width, j));
+			}
+		}
+	}
+}
+
+TEST(BVValue, ArithmeticRandom)
+{
+	std::mt19937 rand(42);
+	for (std::size_t width: {31, 32, 33, 63, 64, 65, 100, 127, 128, 129, 192, 256, 300}) {
+		for (std::size_t k = 0; k < 100; ++k) {
+			std::vector<BDB::block_type> blocks;
+			for (std::size_t i = 0; i < 2 * ((width + BDB::bits_per_block - 1) / BDB::bits_per_block); ++i) {
+				blocks.push_back(BDB::block_type(rand()));
+			}
+			BDB x(blocks.begin(), blocks.begin() + long(blocks.size() / 2));
+			BDB y(blocks.begin() + long(blocks.size() / 2), blocks.end());
+			x.resize(width);
+			y.resize(width);
+			// Also test small values, large values and small shift amounts.
+			switch (k % 4) {
+				case 1: x >>= rand() % width; break;
+				case 2: y >>= rand() % width; break;
+				case 3: y >>= std::max(std::size_t(1), width - 8); break;
+			}
+			checkArithmetic(carl::BVValue(std::move(x)), carl::BVValue(std::move(y)));
+		}
+	}
+}
@@ -2,6 +2,7 @@
 
 #include <carl/formula/Formula.h>
 #include <carl/formula/model/Model.h>
+#include <carl/formula/model/evaluation/IncrementalModelEvaluator.h>
 #include <carl/formula/model/evaluation/ModelEvaluation.h>
 
 #include "../Common.h"
@@ -90,6 +91,69 @@ TEST(ModelEvaluation, EvaluateWithMVR)
 	EXPECT_EQ(res, std::decay<decltype(res)>::type({r1, r2}));
 }
 
+TEST(ModelEvaluation, IncrementalEvaluation)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Variable b = freshBooleanVariable("b");
+	Pol p = Pol(x) * y - Rational(2);
+	Pol q = Pol(y) * y + Pol(z) - Rational(3);
+	FormulaT f(FormulaType::AND, {
+		FormulaT(FormulaType::OR, FormulaT(ConstraintT(p, Relation::LESS)), FormulaT(b)),
+		FormulaT(FormulaType::IMPLIES, FormulaT(ConstraintT(q, Relation::GEQ)), FormulaT(ConstraintT(p, Relation::NEQ))),
+		FormulaT(FormulaType::ITE, FormulaT(b), FormulaT(ConstraintT(Pol(z), Relation::GREATER)), FormulaT(ConstraintT(q, Relation::LEQ)))
+	});
+	model::IncrementalModelEvaluator<Rational,Pol> eval(f);
+
+	auto check = [&f, &eval](const ModelT& m) {
+		auto expected = model::evaluate(f, m);
+		auto res = eval.evaluate(m);
+		ASSERT_EQ(expected.isBool(), res.isBool()) << m << ": " << expected << " vs. " << res;
+		if (expected.isBool()) {
+			EXPECT_EQ(expected.asBool(), res.asBool()) << m;
+		} else {
+			auto fe = static_cast<const ModelFormulaSubstitution<Rational,Pol>*>(expected.asSubstitution().get())->getFormula();
+			auto fr = static_cast<const ModelFormulaSubstitution<Rational,Pol>*>(res.asSubstitution().get())->getFormula();
+			EXPECT_EQ(fe, fr) << m;
+		}
+	};
+
+	ModelT m;
+	m.assign(x, Rational(1));
+	m.assign(b, false);
+	check(m);
+	m.assign(y, RANT(UnivariatePolynomial<Rational>(y, {Rational(-2), Rational(0), Rational(1)}), IntervalT(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT)));
+	eval.changed(y);
+	check(m);
+	m.assign(z, Rational(1));
+	eval.changed(z);
+	check(m);
+
+	// Only the polynomials in x are evaluated again.
+	std::size_t evaluations = eval.polynomialEvaluations();
+	for (int i = -3; i <= 3; ++i) {
+		m.assign(x, RANT(Rational(i) / 2));
+		eval.changed(x);
+		check(m);
+		EXPECT_EQ(evaluations + 1, eval.polynomialEvaluations());
+		evaluations = eval.polynomialEvaluations();
+	}
+	m.assign(b, true);
+	eval.changed(b);
+	check(m);
+	EXPECT_EQ(evaluations, eval.polynomialEvaluations());
+	m.erase(z);
+	eval.changed(z);
+	check(m);
+	m.assign(x, createSubstitution<Rational,Pol,ModelPolynomialSubstitution<Rational,Pol>>(Pol(z) * Rational(2)));
+	eval.changed(x);
+	check(m);
+	m.assign(z, Rational(-1));
+	eval.changed(z);
+	check(m);
+}
+
 TEST(ModelEvaluation, EvaluateBV)
 {
 	carl::SortManager& sm = carl::SortManager::getInstance();
@@ -0,0 +1,157 @@
+#include "gtest/gtest.h"
+#include "carl/groebner/GBProcedure.h"
+
+#include "carl/groebner/Ideal.h"
+#include "carl/groebner/groebner.h"
+#include "carl/groebner/benchmarks/cyclic.h"
+#include "carl/groebner/benchmarks/katsura.h"
+
+#include "../Common.h"
+
+#include <algorithm>
+
+using namespace carl;
+
+template<typename Coeff>
+using PolynomialWithReasonSet = MultivariatePolynomial<Coeff, GrLexOrdering, StdMultivariatePolynomialPolicies<BVReasons, NoAllocator>>;
+
+namespace {
+	/// Computes the (reduced) Groebner basis with the given procedure, sorted by the leading monomials.
+	template<template<typename, template<typename> class> class Procedure>
+	std::vector<MultivariatePolynomial<Rational>> groebnerBasis(const std::vector<MultivariatePolynomial<Rational>>& polys)
+	{
+		GBProcedure<MultivariatePolynomial<Rational>, Procedure, StdAdding> gb;
+		for (const auto& p: polys) gb.addPolynomial(p);
+		gb.reduceInput();
+		gb.calculate();
+		std::vector<MultivariatePolynomial<Rational>> res(gb.getIdeal().getGenerators());
+		std::sort(res.begin(), res.end(), [](const auto& lhs, const auto& rhs){ return GrLexOrdering::less(lhs.lmon(), rhs.lmon()); });
+		return res;
+	}
+}
+
+TEST(GB_F4, LargeCoefficients)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	using MP = MultivariatePolynomial<Rational>;
+	MP X(x), Y(y), Z(z);
+	// The coefficients of the basis need several primes.
+	Rational big = Rational(10000000008) / 7;
+	std::vector<MP> polys = {
+		X*X - MP(big) * Y + Z,
+		X*Y - MP(Rational(1234567891)) * Z*Z + MP(3),
+		Y*Z - MP(Rational(9876543210)) * X + MP(big),
+	};
+	EXPECT_EQ(groebnerBasis<Buchberger>(polys), groebnerBasis<F4>(polys));
+}
+
+TEST(GB_F4, ReasonSets)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	PolynomialWithReasonSet<Rational> f1({(Rational)1*x*x*x, (Rational)-2*x*y});
+	f1.setReasons(BitVector(0));
+	PolynomialWithReasonSet<Rational> f2({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x});
+	f2.setReasons(BitVector(1));
+	// Inconsistent with f1 and f2.
+	PolynomialWithReasonSet<Rational> f3({(Rational)1*y*y, (Rational)-1*(Rational)1/(Rational)2*x, Term<Rational>(1)});
+	f3.setReasons(BitVector(2));
+	GBProcedure<PolynomialWithReasonSet<Rational>, F4, StdAdding> gbobject;
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.addPolynomial(f3);
+	gbobject.calculate();
+	ASSERT_EQ(std::size_t(1), gbobject.getIdeal().getGenerators().size());
+	EXPECT_TRUE(gbobject.getIdeal().getGenerator(0).isConstant());
+	BitVector reasons = gbobject.getIdeal().getGenerator(0).getReasons();
+	// f3 is needed for the conflict.
+	EXPECT_TRUE(reasons.getBit(2));
+	EXPECT_FALSE(reasons.getBit(3));
+}
+
+TEST(GB_F4, Benchmarks)
+{
+	using Ordering = GrLexOrdering;
+	using Policies = StdMultivariatePolynomialPolicies<>;
+	for (unsigned i = 2; i <= 5; ++i) {
+		auto polys = benchmarks::katsura<Rational, Ordering, Policies>(i);
+		EXPECT_EQ(groebnerBasis<Buchberger>(polys), groebnerBasis<F4>(polys)) << "katsura" << i;
+	}
+	for (unsigned i = 2; i <= 5; ++i) {
+		auto polys = benchmarks::cyclic<Rational, Ordering, Policies>(i);
+		EXPECT_EQ(groebnerBasis<Buchberger>(polys), groebnerBasis<F4>(polys)) << "cyclic" << i;
+	}
+}
+
+TEST(GB_F4, RationalReconstruction)
+{
+	WordPrimeFactory<32> primes;
+	f4_detail::Field F1{primes.nextPrime()};
+	f4_detail::Field F2{primes.nextPrime()};
+	f4_detail::Field F3{primes.nextPrime()};
+	mpq_class q(-12345, 679);
+	mpz_class p1(static_cast<unsigned long>(F1.p()));
+	mpz_class a1(static_cast<unsigned long>(f4_detail::fromRational(F1, q.get_num(), q.get_den())));
+	mpz_class bound = 32767;
+	mpq_class res;
+	EXPECT_TRUE(rationalReconstruction(a1, p1, bound, res));
+	EXPECT_EQ(q, res);
+	// There is no n / d with |n|, d <= bound.
+	EXPECT_FALSE(rationalReconstruction(mpz_class(10000000008ul % F1.p()), p1, bound, res));
+
+	// Needs two primes.
+	q = mpq_class(1234567891, 7);
+	f4_detail::EchelonFormLifting lifting;
+	for (const auto& F: {F1, F2}) {
+		f4_detail::EchelonForm<f4_detail::Residue> image;
+		image.rows.push_back(f4_detail::SparseRow<f4_detail::Residue>{{3, 5}, {1, f4_detail::fromRational(F, q.get_num(), q.get_den())}});
+		EXPECT_TRUE(lifting.add(F, std::move(image)));
+	}
+	std::vector<f4_detail::SparseRow<mpq_class>> rows;
+	EXPECT_TRUE(lifting.reconstruct(rows));
+	ASSERT_EQ(std::size_t(1), rows.size());
+	EXPECT_EQ(q, rows[0].coeffs[1]);
+
+	// Needs three primes, the reconstruction fails before.
+	mpz_class n(10000000008ul);
+	lifting = f4_detail::EchelonFormLifting();
+	for (const auto& F: {F1, F2, F3}) {
+		f4_detail::EchelonForm<f4_detail::Residue> image;
+		image.rows.push_back(f4_detail::SparseRow<f4_detail::Residue>{{0, 2}, {1, F.fromInteger(n)}});
+		EXPECT_TRUE(lifting.add(F, std::move(image)));
+		EXPECT_EQ(F.p() == F3.p(), lifting.reconstruct(rows));
+	}
+	ASSERT_EQ(std::size_t(1), rows.size());
+	EXPECT_EQ(mpq_class(n), rows[0].coeffs[1]);
+}
+
+TEST(GB_F4, UnluckyPrimes)
+{
+	WordPrimeFactory<32> primes;
+	f4_detail::Field F1{primes.nextPrime()};
+	f4_detail::Field F2{primes.nextPrime()};
+	f4_detail::Field F3{primes.nextPrime()};
+	auto image = [](std::vector<f4_detail::Column> pivots) {
+		f4_detail::EchelonForm<f4_detail::Residue> res;
+		for (auto c: pivots) res.rows.push_back(f4_detail::SparseRow<f4_detail::Residue>{{c, 7}, {1, 2}});
+		return res;
+	};
+	f4_detail::EchelonFormLifting lifting;
+	EXPECT_TRUE(lifting.add(F1, image({1})));
+	// Fewer pivots: this prime is unlucky.
+	EXPECT_FALSE(lifting.add(F2, image({})));
+	// More pivots: the previous primes were unlucky.
+	EXPECT_TRUE(lifting.add(F2, image({1, 3})));
+	// Same number of pivots, but larger: this prime is unlucky.
+	EXPECT_FALSE(lifting.add(F3, image({2, 3})));
+	// Same number of pivots, but smaller: the previous primes were unlucky.
+	EXPECT_TRUE(lifting.add(F3, image({1, 2})));
+	std::vector<f4_detail::SparseRow<mpq_class>> rows;
+	EXPECT_TRUE(lifting.reconstruct(rows));
+	ASSERT_EQ(std::size_t(2), rows.size());
+	EXPECT_EQ(f4_detail::Column(1), rows[0].lead());
+	EXPECT_EQ(f4_detail::Column(2), rows[1].lead());
+}
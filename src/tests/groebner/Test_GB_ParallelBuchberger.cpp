@@ -0,0 +1,92 @@
+#include "gtest/gtest.h"
+#include "carl/groebner/GBProcedure.h"
+
+#include "carl/groebner/Ideal.h"
+#include "carl/groebner/groebner.h"
+#include "carl/groebner/benchmarks/cyclic.h"
+#include "carl/groebner/benchmarks/katsura.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+namespace {
+	/// Allows to set the number of threads, as GBProcedure does not expose the procedure.
+	template<std::size_t Threads>
+	struct WithThreads {
+		template<typename Polynomial, template<typename> class AddingPolicy>
+		struct Procedure : ParallelBuchberger<Polynomial, AddingPolicy> {
+			Procedure() {
+				this->setThreads(Threads);
+			}
+		};
+	};
+
+	template<template<typename, template<typename> class> class Procedure>
+	std::vector<MultivariatePolynomial<Rational>> groebnerBasis(const std::vector<MultivariatePolynomial<Rational>>& polys)
+	{
+		GBProcedure<MultivariatePolynomial<Rational>, Procedure, StdAdding> gb;
+		for (const auto& p: polys) gb.addPolynomial(p);
+		gb.reduceInput();
+		gb.calculate();
+		return gb.getIdeal().getGenerators();
+	}
+
+	/// Runs the procedure without GBProcedure, which would reduce the basis afterwards.
+	template<template<typename, template<typename> class> class Procedure>
+	std::vector<MultivariatePolynomial<Rational>> procedureBasis(const std::vector<MultivariatePolynomial<Rational>>& polys)
+	{
+		Procedure<MultivariatePolynomial<Rational>, StdAdding> procedure;
+		auto ideal = std::make_shared<Ideal<MultivariatePolynomial<Rational>>>();
+		procedure.setIdeal(ideal);
+		std::list<MultivariatePolynomial<Rational>> normalized;
+		for (const auto& p: polys) normalized.push_back(p.normalize());
+		procedure.calculate(normalized);
+		return ideal->getGenerators();
+	}
+}
+
+TEST(GB_ParallelBuchberger, Inconsistent)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	using MP = MultivariatePolynomial<Rational>;
+	MP X(x), Y(y), Z(z);
+	// x = y = z and x^2 = 2, but x*y*z = 1.
+	std::vector<MP> polys = { X - Y, Y - Z, X*X - MP(2), X*Y*Z - MP(1) };
+	for (const auto& basis: {groebnerBasis<WithThreads<1>::Procedure>(polys), groebnerBasis<WithThreads<4>::Procedure>(polys)}) {
+		ASSERT_EQ(std::size_t(1), basis.size());
+		EXPECT_TRUE(basis.front().isConstant());
+	}
+}
+
+TEST(GB_ParallelBuchberger, Deterministic)
+{
+	using Ordering = GrLexOrdering;
+	using Policies = StdMultivariatePolynomialPolicies<>;
+	std::vector<std::vector<MultivariatePolynomial<Rational>>> inputs;
+	for (unsigned i = 2; i <= 4; ++i) inputs.push_back(benchmarks::katsura<Rational, Ordering, Policies>(i));
+	for (unsigned i = 2; i <= 4; ++i) inputs.push_back(benchmarks::cyclic<Rational, Ordering, Policies>(i));
+	for (const auto& polys: inputs) {
+		auto expected = groebnerBasis<WithThreads<1>::Procedure>(polys);
+		std::set<MultivariatePolynomial<Rational>> sequential(expected.begin(), expected.end());
+		auto buchberger = groebnerBasis<Buchberger>(polys);
+		EXPECT_EQ(sequential, std::set<MultivariatePolynomial<Rational>>(buchberger.begin(), buchberger.end()));
+		EXPECT_EQ(expected, groebnerBasis<WithThreads<4>::Procedure>(polys));
+	}
+}
+
+TEST(GB_ParallelBuchberger, Reduced)
+{
+	using Ordering = GrLexOrdering;
+	using Policies = StdMultivariatePolynomialPolicies<>;
+	std::vector<std::vector<MultivariatePolynomial<Rational>>> inputs;
+	for (unsigned i = 2; i <= 4; ++i) inputs.push_back(benchmarks::katsura<Rational, Ordering, Policies>(i));
+	for (unsigned i = 2; i <= 4; ++i) inputs.push_back(benchmarks::cyclic<Rational, Ordering, Policies>(i));
+	for (const auto& polys: inputs) {
+		auto sequential = groebnerBasis<Buchberger>(polys);
+		EXPECT_EQ(sequential, procedureBasis<WithThreads<1>::Procedure>(polys));
+		EXPECT_EQ(sequential, procedureBasis<WithThreads<4>::Procedure>(polys));
+	}
+}
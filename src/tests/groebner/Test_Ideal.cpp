@@ -25,3 +25,50 @@ TEST(Ideal, Construction)
     ideal.addGenerator(p2);
     ideal.print();
 }
+
+TEST(Ideal, DivMask)
+{
+	std::vector<Variable> vars;
+	for (const char* name: {"a", "b", "c", "d", "e"}) vars.push_back(freshRealVariable(name));
+	// All monomials of total degree at most four
+	std::vector<Monomial::Arg> monomials({nullptr});
+	for (std::size_t d = 0; d < 4; ++d) {
+		std::vector<Monomial::Arg> next;
+		for (const auto& m: monomials) {
+			for (const auto& v: vars) next.push_back(m * v);
+		}
+		monomials.insert(monomials.end(), next.begin(), next.end());
+	}
+	std::sort(monomials.begin(), monomials.end());
+	monomials.erase(std::unique(monomials.begin(), monomials.end()), monomials.end());
+
+	Ideal<MultivariatePolynomial<Rational>> vectorIdeal;
+	Ideal<MultivariatePolynomial<Rational>, IdealDatastructureDivMask> divMaskIdeal;
+	for (std::size_t i = 0; i < monomials.size(); i += 3) {
+		if (!monomials[i]) continue;
+		MultivariatePolynomial<Rational> p(Term<Rational>(Rational(i), monomials[i]));
+		p += vars[i % vars.size()];
+		vectorIdeal.addGenerator(p);
+		divMaskIdeal.addGenerator(p);
+	}
+	EXPECT_GT(vectorIdeal.nrGenerators(), std::size_t(40));
+	auto check = [&](){
+		for (const auto& m: monomials) {
+			for (const auto& v: vars) {
+				Term<Rational> t(Rational(3), m * v * v);
+				auto expected = vectorIdeal.getDivisor(t);
+				auto actual = divMaskIdeal.getDivisor(t);
+				ASSERT_EQ(expected.success(), actual.success());
+				if (!expected.success()) continue;
+				EXPECT_EQ(expected.mDivisor - vectorIdeal.getGenerators().data(), actual.mDivisor - divMaskIdeal.getGenerators().data());
+				EXPECT_EQ(expected.mFactor, actual.mFactor);
+			}
+		}
+	};
+	check();
+	for (std::size_t i = 0; i < vectorIdeal.nrGenerators(); i += 3) {
+		vectorIdeal.eliminateGenerator(i);
+		divMaskIdeal.eliminateGenerator(i);
+	}
+	check();
+}
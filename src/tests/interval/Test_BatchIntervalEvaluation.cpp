@@ -0,0 +1,129 @@
+#include "gtest/gtest.h"
+#include "carl/interval/BatchIntervalEvaluation.h"
+#include "carl/util/stringparser.h"
+
+#include "../Common.h"
+
+#include <cfenv>
+#include <cmath>
+#include <limits>
+
+using namespace carl;
+
+typedef MultivariatePolynomial<Rational> Pol;
+
+namespace {
+	/// Boxes with small dyadic bounds, as columns of lower and upper bounds.
+	void boxes(std::size_t count, std::vector<std::vector<double>>& lower, std::vector<std::vector<double>>& upper) {
+		lower.assign(3, std::vector<double>());
+		upper.assign(3, std::vector<double>());
+		unsigned state = 42;
+		for (std::size_t i = 0; i < count; ++i) {
+			for (std::size_t v = 0; v < 3; ++v) {
+				state = state * 1103515245u + 12345u;
+				double l = double(int((state >> 16) % 17) - 8) / 4;
+				state = state * 1103515245u + 12345u;
+				double w = double((state >> 16) % 9) / 8;
+				lower[v].push_back(l);
+				upper[v].push_back(l + w);
+			}
+		}
+	}
+}
+
+TEST(BatchIntervalEvaluation, Evaluation)
+{
+	StringParser sp;
+	sp.setVariables({"x", "y", "z"});
+	std::vector<Variable> vars({sp.variables().at("x"), sp.variables().at("y"), sp.variables().at("z")});
+	Pol p = sp.parseMultivariatePolynomial<Rational>("3*x^3*y + x*y*z + 2*x^2*z^2 + 1/7*y^2 + (-1)*x*z^3 + 1/3*x + 5");
+	BatchIntervalEvaluation<Pol> eval(p, vars);
+	CompiledRationalFunction<Pol> compiled{RationalFunction<Pol>(p), vars};
+
+	std::vector<std::vector<double>> lower;
+	std::vector<std::vector<double>> upper;
+	// More than one block.
+	boxes(200, lower, upper);
+	std::vector<Interval<double>> res = eval.evaluate(lower, upper);
+	ASSERT_EQ(std::size_t(200), res.size());
+	EXPECT_EQ(FE_TONEAREST, std::fegetround());
+	for (std::size_t i = 0; i < res.size(); ++i) {
+		std::vector<Interval<double>> box;
+		for (std::size_t v = 0; v < 3; ++v) box.emplace_back(lower[v][i], upper[v][i]);
+		// Same program, same rounding.
+		EXPECT_EQ(compiled.evaluate(box), res[i]);
+		// The exact values at the corners are contained.
+		for (unsigned corner = 0; corner < 8; ++corner) {
+			std::map<Variable, Rational> point;
+			for (std::size_t v = 0; v < 3; ++v) {
+				point.emplace(vars[v], carl::rationalize<Rational>((corner & (1u << v)) ? upper[v][i] : lower[v][i]));
+			}
+			Rational value = p.evaluate(point);
+			EXPECT_LE(carl::rationalize<Rational>(res[i].lower()), value);
+			EXPECT_GE(carl::rationalize<Rational>(res[i].upper()), value);
+		}
+	}
+}
+
+TEST(BatchIntervalEvaluation, Bounds)
+{
+	Variable x = freshRealVariable("x");
+	const double inf = std::numeric_limits<double>::infinity();
+	BatchIntervalEvaluation<Pol> square(Pol(x) * Pol(x) + Pol(Rational(1, 3)), {x});
+	std::vector<double> resLower;
+	std::vector<double> resUpper;
+	square.evaluate({{-1.0, -inf, 2.0, 1.0}}, {{2.0, inf, 3.0, 1.0}}, resLower, resUpper);
+	// Even powers are tight.
+	EXPECT_LE(resLower[0], 1.0 / 3);
+	EXPECT_GT(resLower[0], 0.3);
+	EXPECT_LT(4.0, resUpper[0]);
+	EXPECT_GT(4.34, resUpper[0]);
+	// Unbounded.
+	EXPECT_GT(resLower[1], 0.3);
+	EXPECT_EQ(inf, resUpper[1]);
+	EXPECT_LT(4.0, resUpper[2]);
+	EXPECT_GT(4.34, resLower[2]);
+	// Constants that are not representable are enclosed.
+	EXPECT_LT(resLower[3], resUpper[3]);
+	EXPECT_TRUE(carl::rationalize<Rational>(resLower[3]) < Rational(4, 3));
+	EXPECT_TRUE(carl::rationalize<Rational>(resUpper[3]) > Rational(4, 3));
+
+	// Products of zero and infinite bounds.
+	BatchIntervalEvaluation<Pol> cube(Pol(x) * Pol(x) * Pol(x) * Pol(Rational(-2)), {x});
+	std::vector<Interval<double>> res = cube.evaluate({{-inf, 0.0, -1.0}}, {{0.0, 0.0, 2.0}});
+	EXPECT_EQ(Interval<double>(0.0, BoundType::WEAK, 0.0, BoundType::INFTY), res[0]);
+	EXPECT_EQ(Interval<double>(0.0), res[1]);
+	EXPECT_EQ(Interval<double>(-16.0, 2.0), res[2]);
+}
+
+TEST(BatchIntervalEvaluation, InexactProducts)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	const double inf = std::numeric_limits<double>::infinity();
+	BatchIntervalEvaluation<Pol> product(Pol(x) * Pol(y), {x, y});
+	BatchIntervalEvaluation<Pol> square(Pol(x) * Pol(x), {x});
+	BatchIntervalEvaluation<Pol> cube(Pol(x) * Pol(x) * Pol(x), {x});
+	// None of these products is representable, hence the bounds of point boxes must differ.
+	std::vector<double> points({0.1, -0.1, 1.0 / 3, -1.0 / 3, 1e-3, -7.3});
+	for (double p: points) {
+		std::vector<double> resLower;
+		std::vector<double> resUpper;
+		std::vector<double> column(points.size(), p);
+		product.evaluate({points, column}, {points, column}, resLower, resUpper);
+		for (std::size_t i = 0; i < points.size(); ++i) {
+			Rational exact = carl::rationalize<Rational>(points[i]) * carl::rationalize<Rational>(p);
+			// A single product is rounded to the neighbouring doubles.
+			EXPECT_EQ(std::nextafter(resLower[i], inf), resUpper[i]) << points[i] << " * " << p;
+			EXPECT_TRUE(carl::rationalize<Rational>(resLower[i]) < exact);
+			EXPECT_TRUE(carl::rationalize<Rational>(resUpper[i]) > exact);
+		}
+		Rational exact = carl::rationalize<Rational>(p);
+		square.evaluate({{p}}, {{p}}, resLower, resUpper);
+		EXPECT_TRUE(carl::rationalize<Rational>(resLower[0]) < exact * exact) << p;
+		EXPECT_TRUE(carl::rationalize<Rational>(resUpper[0]) > exact * exact) << p;
+		cube.evaluate({{p}}, {{p}}, resLower, resUpper);
+		EXPECT_TRUE(carl::rationalize<Rational>(resLower[0]) < exact * exact * exact) << p;
+		EXPECT_TRUE(carl::rationalize<Rational>(resUpper[0]) > exact * exact * exact) << p;
+	}
+}
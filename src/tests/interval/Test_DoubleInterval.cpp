@@ -11,9 +11,12 @@
 
 #include "gtest/gtest.h"
 #include "carl/interval/Interval.h"
+#include "carl/interval/power.h"
 #include "carl/interval/set_theory.h"
 #include "carl/core/VariablePool.h"
 #include <iostream>
+#include <cfenv>
+#include <random>
 #include "carl/util/platform.h"
 
 #include "../Common.h"
@@ -1321,3 +1324,66 @@ TEST(DoubleInterval, BloatShrink)
     i4.shrink_by(2);
     EXPECT_EQ(result4, i4);
 }
+
+TEST(DoubleInterval, EFTRounding)
+{
+    // The rounding based on error-free transformations yields the same bounds as directed rounding by the FPU.
+    // The operands are volatile, such that the compiler can not share operations across changes of the rounding mode.
+    auto directed = [](int mode, double x, double y, int op){
+        volatile double vx = x;
+        volatile double vy = y;
+        std::fesetround(mode);
+        volatile double res;
+        switch (op) {
+            case 0: res = vx + vy; break;
+            case 1: res = vx - vy; break;
+            case 2: res = vx * vy; break;
+            case 3: res = vx / vy; break;
+            default: res = std::sqrt(vx);
+        }
+        std::fesetround(FE_TONEAREST);
+        return double(res);
+    };
+    auto hardware = [&](double x, double y){
+        std::vector<double> res;
+        for (int op = 0; op < 4; ++op) {
+            res.push_back(directed(FE_DOWNWARD, x, y, op));
+            res.push_back(directed(FE_UPWARD, x, y, op));
+        }
+        res.push_back(directed(FE_DOWNWARD, std::abs(x), y, 4));
+        res.push_back(directed(FE_UPWARD, std::abs(x), y, 4));
+        return res;
+    };
+    carl::rounded_arith_eft eft;
+    std::mt19937_64 rand(42);
+    std::uniform_real_distribution<double> mantissa(-1, 1);
+    std::uniform_int_distribution<int> exponent(-60, 60);
+    auto random = [&](){ return std::ldexp(mantissa(rand), exponent(rand)); };
+    for (std::size_t i = 0; i < 10000; ++i) {
+        double x = random();
+        double y = i % 10 == 0 ? x : random();
+        std::vector<double> expected = hardware(x, y);
+        std::vector<double> result({
+            eft.add_down(x, y), eft.add_up(x, y), eft.sub_down(x, y), eft.sub_up(x, y),
+            eft.mul_down(x, y), eft.mul_up(x, y), eft.div_down(x, y), eft.div_up(x, y),
+            eft.sqrt_down(std::abs(x)), eft.sqrt_up(std::abs(x))
+        });
+        EXPECT_EQ(expected, result) << x << " " << y;
+    }
+    // Exact operations are not widened.
+    EXPECT_EQ(DoubleInterval(4, 6), DoubleInterval(1, 2) + DoubleInterval(3, 4));
+    EXPECT_EQ(DoubleInterval(3), carl::sqrt(DoubleInterval(9)));
+    EXPECT_EQ(DoubleInterval(-8, 27), carl::pow(DoubleInterval(-2, 3), 3));
+    // Overflow and underflow are handled soundly.
+    const double max = std::numeric_limits<double>::max();
+    const double min = std::numeric_limits<double>::denorm_min();
+    EXPECT_LE(eft.add_down(max, max), hardware(max, max)[0]);
+    EXPECT_EQ(std::numeric_limits<double>::infinity(), eft.add_up(max, max));
+    EXPECT_LE(eft.mul_down(1e-200, 1e-200), 0.0);
+    EXPECT_GE(eft.mul_up(1e-200, 1e-200), min);
+    EXPECT_LE(eft.mul_down(-1e-200, 1e-200), -min);
+    EXPECT_LE(eft.div_down(1e-300, 1e100), hardware(1e-300, 1e100)[6]);
+    EXPECT_GE(eft.div_up(1e-300, 1e100), hardware(1e-300, 1e100)[7]);
+    EXPECT_LE(eft.mul_down(1e200, 1e200), max);
+    EXPECT_EQ(std::numeric_limits<double>::infinity(), eft.mul_up(1e200, 1e200));
+}
@@ -0,0 +1,107 @@
+#include "gtest/gtest.h"
+#include "carl/interval/Interval.h"
+#include "carl/interval/Contractor.h"
+#include "carl/interval/NewtonContractor.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Pol = MultivariatePolynomial<Rational>;
+using Newton = contractor::NewtonContractor<Pol>;
+
+namespace {
+	/// The roots of x^2 + y^2 = 1 and x*y = 1/4 in the positive quadrant are (a, b) and (b, a).
+	const double a = (std::sqrt(1.5) + std::sqrt(0.5)) / 2;
+	const double b = (std::sqrt(1.5) - std::sqrt(0.5)) / 2;
+
+	double width(const Newton::Box& box) {
+		double res = 0;
+		for (const auto& i: box) res = std::max(res, i.second.diameter());
+		return res;
+	}
+}
+
+class NewtonContractorTest: public ::testing::Test {
+protected:
+	NewtonContractorTest():
+		x(freshRealVariable("x")),
+		y(freshRealVariable("y")),
+		circle(Pol(x) * Pol(x) + Pol(y) * Pol(y) - Rational(1)),
+		hyperbola(Pol(x) * Pol(y) - Rational(1, 4))
+	{}
+	Variable x;
+	Variable y;
+	Pol circle;
+	Pol hyperbola;
+};
+
+TEST_F(NewtonContractorTest, Jacobian)
+{
+	Newton newton({circle, hyperbola}, {x, y});
+	ASSERT_EQ(std::size_t(2), newton.jacobian().size());
+	EXPECT_EQ(Pol(x) * Rational(2), newton.jacobian()[0][0]);
+	EXPECT_EQ(Pol(y) * Rational(2), newton.jacobian()[0][1]);
+	EXPECT_EQ(Pol(y), newton.jacobian()[1][0]);
+	EXPECT_EQ(Pol(x), newton.jacobian()[1][1]);
+}
+
+TEST_F(NewtonContractorTest, Convergence)
+{
+	for (auto op: {Newton::Operator::KRAWCZYK, Newton::Operator::GAUSS_SEIDEL}) {
+		Newton newton({circle, hyperbola}, {x, y}, op);
+		Newton::Box box({{x, Interval<double>(0.8, 1.1)}, {y, Interval<double>(0.1, 0.4)}});
+		EXPECT_TRUE(newton.contract(box, 6));
+		EXPECT_LT(width(box), 1e-12);
+		EXPECT_TRUE(box[x].contains(a));
+		EXPECT_TRUE(box[y].contains(b));
+	}
+}
+
+TEST_F(NewtonContractorTest, CompareSingleConstraints)
+{
+	// Contracting with every constraint for every variable.
+	using Single = contractor::Contractor<int, Pol>;
+	std::vector<Single> singles;
+	for (const auto& p: {circle, hyperbola}) {
+		for (auto v: {x, y}) singles.emplace_back(0, Constraint<Pol>(p, Relation::EQ), v);
+	}
+	Newton::Box single({{x, Interval<double>(0.8, 1.1)}, {y, Interval<double>(0.1, 0.4)}});
+	Newton::Box newton = single;
+	for (std::size_t round = 0; round < 3; ++round) {
+		for (const auto& c: singles) {
+			auto res = c.contract(single);
+			ASSERT_EQ(std::size_t(1), res.size());
+			single[c.var()] = res.front();
+		}
+	}
+	EXPECT_TRUE(Newton({circle, hyperbola}, {x, y}).contract(newton, 3));
+	EXPECT_TRUE(single[x].contains(a));
+	EXPECT_TRUE(newton[x].contains(a));
+	EXPECT_LT(width(newton) * 100, width(single));
+}
+
+TEST_F(NewtonContractorTest, NoRoot)
+{
+	for (auto op: {Newton::Operator::KRAWCZYK, Newton::Operator::GAUSS_SEIDEL}) {
+		Newton newton({circle, hyperbola}, {x, y}, op);
+		// Both curves pass through the box, but they do not intersect within it.
+		Newton::Box box({{x, Interval<double>(0.85, 0.9)}, {y, Interval<double>(0.25, 0.45)}});
+		EXPECT_FALSE(newton.contract(box, 10));
+	}
+}
+
+TEST_F(NewtonContractorTest, MultipleRoots)
+{
+	// Both roots are kept, unbounded boxes are not contracted.
+	Newton newton({circle, hyperbola}, {x, y});
+	Newton::Box box({{x, Interval<double>(0, 1)}, {y, Interval<double>(0, 1)}});
+	EXPECT_TRUE(newton.contract(box, 10));
+	EXPECT_TRUE(box[x].contains(a) && box[x].contains(b));
+	EXPECT_TRUE(box[y].contains(a) && box[y].contains(b));
+
+	Newton::Box unbounded({{x, Interval<double>(0, BoundType::WEAK, 0, BoundType::INFTY)}, {y, Interval<double>(0.1, 0.4)}});
+	Newton::Box copy = unbounded;
+	EXPECT_TRUE(newton.contract(unbounded));
+	EXPECT_EQ(copy, unbounded);
+}
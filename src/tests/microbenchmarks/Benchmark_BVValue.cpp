@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/formula/bitvector/BVValue.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+	/// Pseudo-random bit vectors of the given width, the second one is never zero.
+	std::pair<carl::BVValue, carl::BVValue> operands(std::size_t width) {
+		std::mt19937 rand(width);
+		std::vector<carl::BVValue::Base::block_type> blocks;
+		for (std::size_t i = 0; i < width / carl::BVValue::Base::bits_per_block + 1; ++i) {
+			blocks.push_back(carl::BVValue::Base::block_type(rand()));
+		}
+		carl::BVValue::Base x(blocks.begin(), blocks.end());
+		carl::BVValue::Base y(blocks.rbegin(), blocks.rend());
+		x.resize(width);
+		y.resize(width);
+		y >>= width / 2;
+		y.set(0);
+		return std::make_pair(carl::BVValue(std::move(x)), carl::BVValue(std::move(y)));
+	}
+}
+
+static void BVValue_Add(benchmark::State& state) {
+	auto op = operands(std::size_t(state.range(0)));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(op.first + op.second);
+	}
+}
+BENCHMARK(BVValue_Add)->Arg(8)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
+
+static void BVValue_Multiply(benchmark::State& state) {
+	auto op = operands(std::size_t(state.range(0)));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(op.first * op.second);
+	}
+}
+BENCHMARK(BVValue_Multiply)->Arg(8)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
+
+static void BVValue_DivideUnsigned(benchmark::State& state) {
+	auto op = operands(std::size_t(state.range(0)));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(op.first / op.second);
+	}
+}
+BENCHMARK(BVValue_DivideUnsigned)->Arg(8)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
+
+static void BVValue_RemSigned(benchmark::State& state) {
+	auto op = operands(std::size_t(state.range(0)));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(op.first.remSigned(op.second));
+	}
+}
+BENCHMARK(BVValue_RemSigned)->Arg(8)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
+
+static void BVValue_Shift(benchmark::State& state) {
+	std::size_t width = std::size_t(state.range(0));
+	auto op = operands(width);
+	carl::BVValue amount(width, unsigned(width / 3));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(op.first.rightShiftArithmetic(amount));
+	}
+}
+BENCHMARK(BVValue_Shift)->Arg(8)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/FactorizedPolynomial.h>
+
+using Poly = carl::MultivariatePolynomial<mpq_class>;
+using FPoly = carl::FactorizedPolynomial<Poly>;
+using Cache = carl::Cache<carl::PolynomialFactorizationPair<Poly>>;
+
+namespace {
+	carl::Variable variable(const std::string& name) {
+		static std::map<std::string, carl::Variable> vars;
+		auto it = vars.find(name);
+		if (it == vars.end()) it = vars.emplace(name, carl::freshRealVariable(name)).first;
+		return it->second;
+	}
+
+	/// Multiplies and adds products of small factors, as in parametric model checking.
+	void arithmetic(const std::shared_ptr<Cache>& cache, std::size_t rounds) {
+		Poly p(variable("p"));
+		Poly q(variable("q"));
+		for (std::size_t i = 0; i < rounds; ++i) {
+			FPoly a(p + Poly(mpq_class(long(i % 13) + 1)), cache);
+			FPoly b(q * q + Poly(mpq_class(long(i % 7) + 1)), cache);
+			FPoly c(p * q + Poly(mpq_class(long(i % 5) + 1)), cache);
+			FPoly product = a * b * c * a;
+			FPoly quotient = product.quotient(a * c);
+			benchmark::DoNotOptimize(carl::lcm(quotient, b * c));
+			benchmark::DoNotOptimize(product + b);
+		}
+	}
+}
+
+static void FactorizedPolynomial_Arithmetic(benchmark::State& state) {
+	for (auto _ : state) {
+		auto cache = std::make_shared<Cache>(10000, 0.2, 0.98, std::size_t(state.range(0)));
+		arithmetic(cache, 200);
+	}
+	state.SetItemsProcessed(std::int64_t(state.iterations()) * 200);
+}
+// Without memory limit and with a limit of 64KB.
+BENCHMARK(FactorizedPolynomial_Arithmetic)->Arg(0)->Arg(65536);
+
+/**
+ * Copies a factorized polynomial, which registers and deregisters its cache entry.
+ * Only meaningful with THREAD_SAFE, otherwise we only run a single thread.
+ */
+static void FactorizedPolynomial_Copy(benchmark::State& state) {
+	static std::shared_ptr<Cache> cache = std::make_shared<Cache>();
+	static FPoly f(Poly(variable("p")) * Poly(variable("q")) + Poly(mpq_class(1)), cache);
+	for (auto _ : state) {
+		FPoly copy(f);
+		benchmark::DoNotOptimize(copy);
+	}
+	state.SetItemsProcessed(std::int64_t(state.iterations()));
+}
+#ifdef THREAD_SAFE
+BENCHMARK(FactorizedPolynomial_Copy)->ThreadRange(1, 8)->UseRealTime();
+#else
+BENCHMARK(FactorizedPolynomial_Copy);
+#endif
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/UnivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/GCD.h>
+
+#include <random>
+
+namespace {
+	carl::Variable variable() {
+		static carl::Variable x = carl::freshRealVariable("x");
+		return x;
+	}
+
+	/// Random polynomials over the field of the largest prime below 2^31, the modular algorithms use similar primes.
+	template<typename Integer>
+	std::vector<carl::UnivariatePolynomial<carl::GFNumber<Integer>>> polynomials(std::size_t degree) {
+		const auto* gf = carl::GaloisFieldManager<Integer>::getInstance().getField(2147483647);
+		std::mt19937_64 rng(degree);
+		std::vector<carl::UnivariatePolynomial<carl::GFNumber<Integer>>> res;
+		for (std::size_t i = 0; i < 3; ++i) {
+			std::vector<carl::GFNumber<Integer>> coeffs;
+			for (std::size_t d = 0; d <= degree; ++d) {
+				coeffs.emplace_back(Integer(long(rng() % 2147483647)), gf);
+			}
+			coeffs.back() = carl::GFNumber<Integer>(Integer(1), gf);
+			res.emplace_back(variable(), coeffs);
+		}
+		return res;
+	}
+
+	template<typename Integer>
+	void multiply(benchmark::State& state) {
+		auto p = polynomials<Integer>(std::size_t(state.range(0)));
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(p[0] * p[1]);
+		}
+	}
+
+	template<typename Integer>
+	void divide(benchmark::State& state) {
+		auto p = polynomials<Integer>(std::size_t(state.range(0)));
+		auto product = p[0] * p[1] + p[2];
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(product.divideBy(p[1]));
+		}
+	}
+
+	template<typename Integer>
+	void gcd(benchmark::State& state) {
+		auto p = polynomials<Integer>(std::size_t(state.range(0)));
+		auto a = p[0] * p[2];
+		auto b = p[1] * p[2];
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(carl::gcd(a, b));
+		}
+	}
+}
+
+static void GaloisField_MultiplyMpz(benchmark::State& state) {
+	multiply<mpz_class>(state);
+}
+BENCHMARK(GaloisField_MultiplyMpz)->Arg(16)->Arg(128);
+
+static void GaloisField_MultiplyWord(benchmark::State& state) {
+	multiply<carl::uint>(state);
+}
+BENCHMARK(GaloisField_MultiplyWord)->Arg(16)->Arg(128);
+
+static void GaloisField_DivideMpz(benchmark::State& state) {
+	divide<mpz_class>(state);
+}
+BENCHMARK(GaloisField_DivideMpz)->Arg(16)->Arg(128);
+
+static void GaloisField_DivideWord(benchmark::State& state) {
+	divide<carl::uint>(state);
+}
+BENCHMARK(GaloisField_DivideWord)->Arg(16)->Arg(128);
+
+static void GaloisField_GCDMpz(benchmark::State& state) {
+	gcd<mpz_class>(state);
+}
+BENCHMARK(GaloisField_GCDMpz)->Arg(16)->Arg(128);
+
+static void GaloisField_GCDWord(benchmark::State& state) {
+	gcd<carl::uint>(state);
+}
+BENCHMARK(GaloisField_GCDWord)->Arg(16)->Arg(128);
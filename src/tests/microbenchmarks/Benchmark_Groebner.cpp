@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/groebner/groebner.h>
+#include <carl/groebner/benchmarks/cyclic.h>
+#include <carl/groebner/benchmarks/katsura.h>
+
+#include <set>
+
+using Poly = carl::MultivariatePolynomial<mpq_class>;
+
+template<template<typename, template<typename> class> class Procedure>
+void computeGroebnerBasis(benchmark::State& state, const std::vector<Poly>& polys) {
+	std::size_t size = 0;
+	for (auto _ : state) {
+		carl::GBProcedure<Poly, Procedure, carl::StdAdding> gb;
+		for (const auto& p: polys) gb.addPolynomial(p);
+		gb.reduceInput();
+		gb.calculate();
+		size = gb.getIdeal().getGenerators().size();
+	}
+	state.counters["size"] = double(size);
+}
+
+template<template<typename, template<typename> class> class Procedure>
+static void Groebner_Katsura(benchmark::State& state) {
+	computeGroebnerBasis<Procedure>(state, carl::benchmarks::katsura<mpq_class, carl::GrLexOrdering, carl::StdMultivariatePolynomialPolicies<>>(unsigned(state.range(0))));
+}
+template<template<typename, template<typename> class> class Procedure>
+static void Groebner_Cyclic(benchmark::State& state) {
+	computeGroebnerBasis<Procedure>(state, carl::benchmarks::cyclic<mpq_class, carl::GrLexOrdering, carl::StdMultivariatePolynomialPolicies<>>(unsigned(state.range(0))));
+}
+
+/// Queries the divisors of all terms of m * g for all generators g and all monomials m of degree at most two.
+template<template<typename> class Datastructure>
+void lookupDivisors(benchmark::State& state, const std::vector<Poly>& generators) {
+	carl::Ideal<Poly, Datastructure> ideal;
+	std::set<carl::Variable> vars;
+	for (const auto& g: generators) {
+		ideal.addGenerator(g);
+		g.gatherVariables(vars);
+	}
+	std::vector<carl::Monomial::Arg> multipliers({nullptr});
+	for (const auto& v: vars) multipliers.push_back(carl::createMonomial(v, 1));
+	for (const auto& v: vars) {
+		for (const auto& w: vars) multipliers.push_back(carl::createMonomial(v, 1) * w);
+	}
+	std::vector<carl::Term<mpq_class>> queries;
+	for (const auto& g: generators) {
+		for (const auto& t: g) {
+			for (const auto& m: multipliers) queries.emplace_back(t.coeff(), m * t.monomial());
+		}
+	}
+	std::size_t found = 0;
+	for (auto _ : state) {
+		found = 0;
+		for (const auto& q: queries) {
+			if (ideal.getDivisor(q).success()) ++found;
+		}
+	}
+	state.counters["generators"] = double(generators.size());
+	state.counters["queries"] = double(queries.size());
+	state.counters["found"] = double(found);
+}
+
+template<typename Bench>
+std::vector<Poly> groebnerBasis(Bench bench) {
+	carl::GBProcedure<Poly, carl::F4, carl::StdAdding> gb;
+	for (const auto& p: bench) gb.addPolynomial(p);
+	gb.reduceInput();
+	gb.calculate();
+	return gb.getIdeal().getGenerators();
+}
+
+/// Generators with the leading monomials x_i^a * x_j^b for a + b = degree.
+std::vector<Poly> staircase(unsigned degree) {
+	std::vector<carl::Variable> vars;
+	for (const char* name: {"a", "b", "c", "d", "e", "f"}) vars.push_back(carl::freshRealVariable(name));
+	std::vector<Poly> res;
+	for (std::size_t i = 0; i < vars.size(); ++i) {
+		for (std::size_t j = i + 1; j < vars.size(); ++j) {
+			for (unsigned a = 1; a < degree; ++a) {
+				res.emplace_back(Poly(carl::createMonomial(vars[i], a) * carl::createMonomial(vars[j], degree - a)) + Poly(vars[i]));
+			}
+		}
+	}
+	return res;
+}
+
+template<template<typename> class Datastructure>
+static void Lookup_Katsura5(benchmark::State& state) {
+	static auto gb = groebnerBasis(carl::benchmarks::katsura<mpq_class, carl::GrLexOrdering, carl::StdMultivariatePolynomialPolicies<>>(5));
+	lookupDivisors<Datastructure>(state, gb);
+}
+template<template<typename> class Datastructure>
+static void Lookup_Cyclic5(benchmark::State& state) {
+	static auto gb = groebnerBasis(carl::benchmarks::cyclic<mpq_class, carl::GrLexOrdering, carl::StdMultivariatePolynomialPolicies<>>(5));
+	lookupDivisors<Datastructure>(state, gb);
+}
+template<template<typename> class Datastructure>
+static void Lookup_Staircase(benchmark::State& state) {
+	lookupDivisors<Datastructure>(state, staircase(unsigned(state.range(0))));
+}
+
+BENCHMARK_TEMPLATE(Lookup_Katsura5, carl::IdealDatastructureVector);
+BENCHMARK_TEMPLATE(Lookup_Katsura5, carl::IdealDatastructureDivMask);
+BENCHMARK_TEMPLATE(Lookup_Cyclic5, carl::IdealDatastructureVector);
+BENCHMARK_TEMPLATE(Lookup_Cyclic5, carl::IdealDatastructureDivMask);
+BENCHMARK_TEMPLATE(Lookup_Staircase, carl::IdealDatastructureVector)->Arg(4)->Arg(8)->Arg(16);
+BENCHMARK_TEMPLATE(Lookup_Staircase, carl::IdealDatastructureDivMask)->Arg(4)->Arg(8)->Arg(16);
+
+BENCHMARK_TEMPLATE(Groebner_Katsura, carl::Buchberger)->DenseRange(3, 5);
+BENCHMARK_TEMPLATE(Groebner_Katsura, carl::ParallelBuchberger)->DenseRange(3, 5);
+BENCHMARK_TEMPLATE(Groebner_Katsura, carl::F4)->DenseRange(3, 5);
+BENCHMARK_TEMPLATE(Groebner_Cyclic, carl::Buchberger)->DenseRange(3, 5);
+BENCHMARK_TEMPLATE(Groebner_Cyclic, carl::ParallelBuchberger)->DenseRange(3, 5);
+BENCHMARK_TEMPLATE(Groebner_Cyclic, carl::F4)->DenseRange(3, 5);
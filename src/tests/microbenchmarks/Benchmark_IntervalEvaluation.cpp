@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/interval/BatchIntervalEvaluation.h>
+#include <carl/interval/IntervalEvaluation.h>
+#include <carl/util/stringparser.h>
+
+using Poly = carl::MultivariatePolynomial<mpq_class>;
+
+/// A polynomial in three variables, together with its variables.
+const std::pair<Poly, std::vector<carl::Variable>>& polynomial() {
+	static std::pair<Poly, std::vector<carl::Variable>> res = [](){
+		carl::StringParser sp;
+		sp.setVariables({"x", "y", "z"});
+		Poly p = sp.parseMultivariatePolynomial<mpq_class>("x^3*y^2*z + 3*x^2*y*z^2 + (-2)*x*y^3 + 5*x^2*z + 7*y^2*z^2 + (-1)*x*y*z + 4*x^2 + y + 1/3");
+		return std::make_pair(p, std::vector<carl::Variable>({sp.variables().at("x"), sp.variables().at("y"), sp.variables().at("z")}));
+	}();
+	return res;
+}
+
+/// Boxes as columns of lower and upper bounds.
+void boxes(std::size_t count, std::vector<std::vector<double>>& lower, std::vector<std::vector<double>>& upper) {
+	lower.assign(3, std::vector<double>());
+	upper.assign(3, std::vector<double>());
+	for (std::size_t i = 0; i < count; ++i) {
+		for (std::size_t v = 0; v < 3; ++v) {
+			lower[v].push_back(double(long((i * (v + 3)) % 17) - 8) / 4);
+			upper[v].push_back(lower[v].back() + double((i + v) % 5) / 8);
+		}
+	}
+}
+
+static void IntervalEvaluation_Map(benchmark::State& state) {
+	const auto& p = polynomial();
+	std::vector<std::vector<double>> lower, upper;
+	boxes(std::size_t(state.range(0)), lower, upper);
+	for (auto _ : state) {
+		for (std::size_t i = 0; i < lower[0].size(); ++i) {
+			std::map<carl::Variable, carl::Interval<double>> map;
+			for (std::size_t v = 0; v < 3; ++v) map.emplace(p.second[v], carl::Interval<double>(lower[v][i], upper[v][i]));
+			benchmark::DoNotOptimize(carl::IntervalEvaluation::evaluate(p.first, map));
+		}
+	}
+	state.SetItemsProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+BENCHMARK(IntervalEvaluation_Map)->Arg(4096);
+
+static void IntervalEvaluation_Compiled(benchmark::State& state) {
+	const auto& p = polynomial();
+	carl::CompiledRationalFunction<Poly> cf(carl::RationalFunction<Poly>(p.first), p.second);
+	std::vector<std::vector<double>> lower, upper;
+	boxes(std::size_t(state.range(0)), lower, upper);
+	std::vector<carl::Interval<double>> box(3);
+	std::vector<carl::Interval<double>> registers;
+	for (auto _ : state) {
+		for (std::size_t i = 0; i < lower[0].size(); ++i) {
+			for (std::size_t v = 0; v < 3; ++v) box[v] = carl::Interval<double>(lower[v][i], upper[v][i]);
+			benchmark::DoNotOptimize(cf.evaluate(box, registers));
+		}
+	}
+	state.SetItemsProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+BENCHMARK(IntervalEvaluation_Compiled)->Arg(4096);
+
+static void IntervalEvaluation_Batch(benchmark::State& state) {
+	const auto& p = polynomial();
+	carl::BatchIntervalEvaluation<Poly> eval(p.first, p.second);
+	std::vector<std::vector<double>> lower, upper;
+	boxes(std::size_t(state.range(0)), lower, upper);
+	std::vector<double> resLower, resUpper;
+	for (auto _ : state) {
+		eval.evaluate(lower, upper, resLower, resUpper);
+		benchmark::DoNotOptimize(resLower.data());
+		benchmark::DoNotOptimize(resUpper.data());
+	}
+	state.SetItemsProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+BENCHMARK(IntervalEvaluation_Batch)->Arg(4096);
+
+namespace {
+	/// Boost intervals with the given rounding policy for double.
+	template<typename Rounding>
+	using BoostInterval = boost::numeric::interval<double, boost::numeric::interval_lib::policies<Rounding, boost::numeric::interval_lib::checking_no_nan<double>>>;
+
+	/// Evaluates a short mix of additions, multiplications and divisions for every box.
+	template<typename Rounding>
+	void arithmetic(benchmark::State& state) {
+		std::vector<std::vector<double>> lower, upper;
+		boxes(std::size_t(state.range(0)), lower, upper);
+		BoostInterval<Rounding> third(1.0 / 3 - 1e-16, 1.0 / 3 + 1e-16);
+		for (auto _ : state) {
+			for (std::size_t i = 0; i < lower[0].size(); ++i) {
+				BoostInterval<Rounding> x(lower[0][i], upper[0][i]);
+				BoostInterval<Rounding> y(lower[1][i], upper[1][i]);
+				BoostInterval<Rounding> res = x * y + third * x - y / (x * x + 1.0);
+				benchmark::DoNotOptimize(res);
+			}
+		}
+		state.SetItemsProcessed(std::int64_t(state.iterations()) * state.range(0));
+	}
+}
+
+static void IntervalArithmetic_SwitchRounding(benchmark::State& state) {
+	arithmetic<boost::numeric::interval_lib::save_state<boost::numeric::interval_lib::rounded_transc_std<double>>>(state);
+}
+BENCHMARK(IntervalArithmetic_SwitchRounding)->Arg(4096);
+
+static void IntervalArithmetic_ErrorFreeTransformation(benchmark::State& state) {
+	arithmetic<carl::rounded_arith_eft>(state);
+}
+BENCHMARK(IntervalArithmetic_ErrorFreeTransformation)->Arg(4096);
@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/formula/Formula.h>
+#include <carl/formula/model/evaluation/IncrementalModelEvaluator.h>
+#include <carl/formula/model/evaluation/ModelEvaluation.h>
+
+using Pol = carl::MultivariatePolynomial<mpq_class>;
+using FormulaT = carl::Formula<Pol>;
+using ModelT = carl::Model<mpq_class, Pol>;
+
+namespace {
+	/// A conjunction of disjunctions of constraints over a chain of variables, where only few constraints depend on the first variable.
+	struct Problem {
+		std::vector<carl::Variable> vars;
+		FormulaT formula;
+		ModelT model;
+		explicit Problem(std::size_t size) {
+			for (std::size_t i = 0; i < size; ++i) {
+				vars.push_back(carl::freshRealVariable("x" + std::to_string(i)));
+				model.assign(vars.back(), mpq_class(long(i % 5) - 2));
+			}
+			carl::Formulas<Pol> clauses;
+			for (std::size_t i = 1; i + 1 < size; ++i) {
+				Pol p = Pol(vars[i]) * vars[i + 1] - Pol(vars[i - 1]) * vars[i - 1] + mpq_class(long(i));
+				Pol q = Pol(vars[i + 1]) * vars[i + 1] * vars[i] - mpq_class(3);
+				clauses.emplace_back(carl::FormulaType::OR, FormulaT(p, carl::Relation::GEQ), FormulaT(q, carl::Relation::LESS));
+			}
+			formula = FormulaT(carl::FormulaType::AND, std::move(clauses));
+		}
+	};
+}
+
+static void ModelEvaluation_Full(benchmark::State& state) {
+	Problem problem(std::size_t(state.range(0)));
+	long i = 0;
+	for (auto _ : state) {
+		problem.model.assign(problem.vars[0], mpq_class(i++ % 7 - 3));
+		benchmark::DoNotOptimize(carl::model::evaluate(problem.formula, problem.model));
+	}
+}
+BENCHMARK(ModelEvaluation_Full)->Arg(16)->Arg(64);
+
+static void ModelEvaluation_Incremental(benchmark::State& state) {
+	Problem problem(std::size_t(state.range(0)));
+	carl::model::IncrementalModelEvaluator<mpq_class, Pol> eval(problem.formula);
+	eval.evaluate(problem.model);
+	long i = 0;
+	for (auto _ : state) {
+		problem.model.assign(problem.vars[0], mpq_class(i++ % 7 - 3));
+		eval.changed(problem.vars[0]);
+		benchmark::DoNotOptimize(eval.evaluate(problem.model));
+	}
+}
+BENCHMARK(ModelEvaluation_Incremental)->Arg(16)->Arg(64);
@@ -0,0 +1,46 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/MonomialPool.h>
+#include <carl/core/VariablePool.h>
+
+#include <vector>
+
+/**
+ * Creates monomials over a few variables from several threads.
+ * Half of the monomials are kept alive by the fixture, the others are freed immediately and thus repeatedly inserted into and removed from the pool.
+ * Only meaningful with THREAD_SAFE, otherwise we only run a single thread.
+ */
+class MonomialPool_Fixture: public benchmark::Fixture {
+public:
+	std::vector<carl::Variable> vars;
+	std::vector<carl::Monomial::Arg> alive;
+	void SetUp(const benchmark::State& state) override {
+		if (state.thread_index != 0) return;
+		for (std::size_t i = vars.size(); i < 4; ++i) {
+			vars.push_back(carl::freshRealVariable());
+		}
+		for (carl::exponent e = 1; e < 32; e += 2) {
+			alive.push_back(carl::MonomialPool::getInstance().create({std::make_pair(vars[0], e), std::make_pair(vars[1], e)}));
+		}
+	}
+	void TearDown(const benchmark::State& state) override {
+		if (state.thread_index != 0) return;
+		alive.clear();
+	}
+};
+
+BENCHMARK_DEFINE_F(MonomialPool_Fixture, create)(benchmark::State& state) {
+	carl::exponent offset = carl::exponent(state.thread_index);
+	for (auto _ : state) {
+		for (carl::exponent e = 1; e < 32; ++e) {
+			benchmark::DoNotOptimize(carl::MonomialPool::getInstance().create({std::make_pair(vars[0], e), std::make_pair(vars[1], e)}));
+			benchmark::DoNotOptimize(carl::MonomialPool::getInstance().create({std::make_pair(vars[2], e + offset), std::make_pair(vars[3], e)}));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * 62);
+}
+#ifdef THREAD_SAFE
+BENCHMARK_REGISTER_F(MonomialPool_Fixture, create)->ThreadRange(1, 16)->UseRealTime();
+#else
+BENCHMARK_REGISTER_F(MonomialPool_Fixture, create);
+#endif
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/polynomialfunctions/GCD.h>
+#include <carl/numbers/numbers.h>
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+
+/// gcd((1 + x + y + z)^n * (x - y + 2), (1 + x + y + z)^n * (y*z - 3))
+std::pair<MVP,MVP> denseGCDInput(std::size_t n) {
+    static carl::Variable x = carl::freshRealVariable("x");
+    static carl::Variable y = carl::freshRealVariable("y");
+    static carl::Variable z = carl::freshRealVariable("z");
+    MVP base = MVP(x) + MVP(y) + MVP(z) + MVP(1);
+    MVP g(1);
+    for (std::size_t i = 0; i < n; ++i) g *= base;
+    return std::make_pair(g * (MVP(x) - MVP(y) + MVP(2)), g * (MVP(y) * MVP(z) - MVP(3)));
+}
+
+/// gcd(g * f1, g * f2) for sparse polynomials in n variables.
+std::pair<MVP,MVP> sparseGCDInput(std::size_t n) {
+    std::vector<MVP> vars;
+    for (std::size_t i = 0; i < n; ++i) vars.emplace_back(carl::freshRealVariable());
+    MVP g(1);
+    MVP f1(3);
+    MVP f2(-5);
+    for (std::size_t i = 0; i < n; ++i) {
+        const MVP& v = vars[i];
+        const MVP& w = vars[(i + 1) % n];
+        g += mpq_class(long(2 * i) - 5) * v * v * v * w + mpq_class(12345) * v;
+        f1 += mpq_class(long(i) + 1) * v * w * w;
+        f2 += mpq_class(7) * v * v * w * w - v;
+    }
+    return std::make_pair(g * f1, g * f2);
+}
+
+static void MVP_GCD_Dense_Modular(benchmark::State& state) {
+    auto input = denseGCDInput(std::size_t(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(carl::modular_gcd(input.first, input.second));
+    }
+}
+BENCHMARK(MVP_GCD_Dense_Modular)->DenseRange(1, 4);
+
+static void MVP_GCD_Dense_Euclidean(benchmark::State& state) {
+    auto input = denseGCDInput(std::size_t(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(carl::gcd_detail::gcd_calculate(input.first, input.second));
+    }
+}
+BENCHMARK(MVP_GCD_Dense_Euclidean)->DenseRange(1, 4);
+
+static void MVP_GCD_Sparse_Modular(benchmark::State& state) {
+    auto input = sparseGCDInput(std::size_t(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(carl::modular_gcd(input.first, input.second));
+    }
+}
+BENCHMARK(MVP_GCD_Sparse_Modular)->DenseRange(2, 5);
+
+static void MVP_GCD_Sparse_Euclidean(benchmark::State& state) {
+    auto input = sparseGCDInput(std::size_t(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(carl::gcd_detail::gcd_calculate(input.first, input.second));
+    }
+}
+BENCHMARK(MVP_GCD_Sparse_Euclidean)->DenseRange(2, 5);
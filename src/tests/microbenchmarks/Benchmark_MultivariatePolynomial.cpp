@@ -26,3 +26,67 @@ BENCHMARK_F(MVP_Add_Fixture, MVP_Add_alt)(benchmark::State& state) {
         benchmark::DoNotOptimize(MVP(p) += (q));
     }
 }
+
+template<carl::MultiplicationStrategy S>
+struct MultiplicationPolicy: public carl::StdMultivariatePolynomialPolicies<> {
+    static const carl::MultiplicationStrategy multiplication = S;
+};
+using TermAdditionMVP = carl::MultivariatePolynomial<mpq_class, carl::GrLexOrdering, MultiplicationPolicy<carl::MultiplicationStrategy::TermAddition>>;
+using HeapMVP = carl::MultivariatePolynomial<mpq_class, carl::GrLexOrdering, MultiplicationPolicy<carl::MultiplicationStrategy::Heap>>;
+
+/// Dense: (1 + x + y + z)^n
+template<typename Poly>
+Poly denseFactor(std::size_t n) {
+    static carl::Variable x = carl::freshRealVariable("x");
+    static carl::Variable y = carl::freshRealVariable("y");
+    static carl::Variable z = carl::freshRealVariable("z");
+    Poly base = Poly(x) + Poly(y) + Poly(z) + Poly(1);
+    Poly res(1);
+    for (std::size_t i = 0; i < n; ++i) res *= base;
+    return res;
+}
+
+/// Sparse: n terms with pseudo-random exponents and coefficients.
+template<typename Poly>
+Poly sparseFactor(std::size_t n, std::size_t seed) {
+    static carl::Variable x = carl::freshRealVariable("x");
+    static carl::Variable y = carl::freshRealVariable("y");
+    static carl::Variable z = carl::freshRealVariable("z");
+    std::vector<carl::Term<mpq_class>> terms;
+    std::size_t r = seed;
+    for (std::size_t i = 0; i < n; ++i) {
+        r = (r * 1103515245 + 12345) % 2147483648;
+        auto ex = carl::exponent(r % 23 + 1);
+        auto ey = carl::exponent((r / 23) % 17);
+        auto ez = carl::exponent((r / 391) % 19);
+        carl::Monomial::Arg m = carl::createMonomial(x, ex);
+        if (ey > 0) m = m * carl::createMonomial(y, ey);
+        if (ez > 0) m = m * carl::createMonomial(z, ez);
+        terms.emplace_back(mpq_class(long(r % 1000) - 500), m);
+    }
+    return Poly(std::move(terms));
+}
+
+template<typename Poly>
+void MVP_Multiply_Dense(benchmark::State& state) {
+    Poly p = denseFactor<Poly>(std::size_t(state.range(0)));
+    Poly q = denseFactor<Poly>(std::size_t(state.range(0)) + 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(p * q);
+    }
+    state.counters["terms"] = double(p.nrTerms() * q.nrTerms());
+}
+BENCHMARK_TEMPLATE(MVP_Multiply_Dense, TermAdditionMVP)->DenseRange(2, 12, 2);
+BENCHMARK_TEMPLATE(MVP_Multiply_Dense, HeapMVP)->DenseRange(2, 12, 2);
+
+template<typename Poly>
+void MVP_Multiply_Sparse(benchmark::State& state) {
+    Poly p = sparseFactor<Poly>(std::size_t(state.range(0)), 1);
+    Poly q = sparseFactor<Poly>(std::size_t(state.range(0)), 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(p * q);
+    }
+    state.counters["terms"] = double(p.nrTerms() * q.nrTerms());
+}
+BENCHMARK_TEMPLATE(MVP_Multiply_Sparse, TermAdditionMVP)->RangeMultiplier(4)->Range(4, 1024);
+BENCHMARK_TEMPLATE(MVP_Multiply_Sparse, HeapMVP)->RangeMultiplier(4)->Range(4, 1024);
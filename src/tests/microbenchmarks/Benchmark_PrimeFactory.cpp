@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/numbers/PrimeFactory.h>
+
+/// Enumerates primes above 2^31 with GMP, as previously done by the modular gcd and resultant.
+static void Primes_MpzNextPrime(benchmark::State& state) {
+	for (auto _ : state) {
+		mpz_class prime = mpz_class(1) << 31;
+		for (std::int64_t i = 0; i < state.range(0); ++i) {
+			mpz_nextprime(prime.get_mpz_t(), prime.get_mpz_t());
+			benchmark::DoNotOptimize(prime.get_ui());
+		}
+	}
+	state.SetItemsProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+BENCHMARK(Primes_MpzNextPrime)->Arg(16)->Arg(256);
+
+/// Enumerates the primes cached by PrimeFactory, which are shared by all threads.
+static void Primes_PrimeFactory(benchmark::State& state) {
+	for (auto _ : state) {
+		carl::PrimeFactory<carl::uint> primes;
+		for (std::int64_t i = 0; i < state.range(0); ++i) {
+			benchmark::DoNotOptimize(primes.nextPrime());
+		}
+	}
+	state.SetItemsProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+template<std::size_t Bits>
+static void Primes_WordPrimeFactory(benchmark::State& state) {
+	for (auto _ : state) {
+		carl::WordPrimeFactory<Bits> primes;
+		for (std::int64_t i = 0; i < state.range(0); ++i) {
+			benchmark::DoNotOptimize(primes.nextPrime());
+		}
+	}
+	state.SetItemsProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+
+// Beyond the first 64 primes, the word primes are computed with isPrime().
+#ifdef THREAD_SAFE
+BENCHMARK(Primes_PrimeFactory)->Arg(256)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(Primes_WordPrimeFactory, 32)->Arg(16)->Arg(256)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(Primes_WordPrimeFactory, 64)->Arg(16)->Arg(256)->ThreadRange(1, 8)->UseRealTime();
+#else
+BENCHMARK(Primes_PrimeFactory)->Arg(256);
+BENCHMARK_TEMPLATE(Primes_WordPrimeFactory, 32)->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(Primes_WordPrimeFactory, 64)->Arg(16)->Arg(256);
+#endif
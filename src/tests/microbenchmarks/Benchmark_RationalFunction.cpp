@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/CompiledRationalFunction.h>
+#include <carl/core/RationalFunction.h>
+#include <carl/util/stringparser.h>
+
+using Poly = carl::MultivariatePolynomial<mpq_class>;
+using RFunc = carl::RationalFunction<Poly>;
+
+/// A rational function as it occurs in parametric model checking, together with its variables.
+const std::pair<RFunc, std::vector<carl::Variable>>& rationalFunction() {
+	static std::pair<RFunc, std::vector<carl::Variable>> res = [](){
+		carl::StringParser sp;
+		sp.setVariables({"p", "q", "r"});
+		Poly nom = sp.parseMultivariatePolynomial<mpq_class>("p^3*q^2*r + 3*p^2*q*r^2 + (-2)*p*q^3 + 5*p^2*r + 7*q^2*r^2 + (-1)*p*q*r + 4*p^2 + q + 1/3");
+		Poly denom = sp.parseMultivariatePolynomial<mpq_class>("p^2*q^2 + 2*p*q*r + r^2 + p^2*r + 3*q + 1");
+		return std::make_pair(RFunc(nom, denom), std::vector<carl::Variable>({sp.variables().at("p"), sp.variables().at("q"), sp.variables().at("r")}));
+	}();
+	return res;
+}
+
+template<typename T>
+T convert(const mpq_class& q) {
+	return T(q);
+}
+template<>
+double convert<double>(const mpq_class& q) {
+	return carl::toDouble(q);
+}
+
+/// Parameter values in the unit cube.
+template<typename T>
+std::vector<std::vector<T>> points(std::size_t count) {
+	std::vector<std::vector<T>> res;
+	for (std::size_t i = 0; i < count; ++i) {
+		res.push_back({convert<T>(mpq_class(long(i % 7) + 1, 10)), convert<T>(mpq_class(long(i % 11) + 1, 13)), convert<T>(mpq_class(long(i % 5) + 1, 6))});
+	}
+	return res;
+}
+
+static void RationalFunction_EvaluateMap(benchmark::State& state) {
+	const auto& f = rationalFunction();
+	auto pts = points<mpq_class>(std::size_t(state.range(0)));
+	for (auto _ : state) {
+		for (const auto& p: pts) {
+			std::map<carl::Variable, mpq_class> map({{f.second[0], p[0]}, {f.second[1], p[1]}, {f.second[2], p[2]}});
+			benchmark::DoNotOptimize(f.first.evaluate(map));
+		}
+	}
+	state.SetItemsProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+BENCHMARK(RationalFunction_EvaluateMap)->Arg(1024);
+
+template<typename T>
+static void RationalFunction_Compiled(benchmark::State& state) {
+	const auto& f = rationalFunction();
+	carl::CompiledRationalFunction<Poly> cf(f.first, f.second);
+	auto pts = points<T>(std::size_t(state.range(0)));
+	std::vector<T> registers;
+	for (auto _ : state) {
+		for (const auto& p: pts) {
+			benchmark::DoNotOptimize(cf.evaluate(p, registers));
+		}
+	}
+	state.SetItemsProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+BENCHMARK_TEMPLATE(RationalFunction_Compiled, mpq_class)->Arg(1024);
+BENCHMARK_TEMPLATE(RationalFunction_Compiled, double)->Arg(1024);
+BENCHMARK_TEMPLATE(RationalFunction_Compiled, carl::Interval<double>)->Arg(1024);
+
+template<typename T>
+static void RationalFunction_CompiledBatch(benchmark::State& state) {
+	const auto& f = rationalFunction();
+	carl::CompiledRationalFunction<Poly> cf(f.first, f.second);
+	std::vector<std::vector<T>> columns(3);
+	for (const auto& p: points<T>(std::size_t(state.range(0)))) {
+		for (std::size_t i = 0; i < 3; ++i) columns[i].push_back(p[i]);
+	}
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(cf.evaluateBatch(columns));
+	}
+	state.SetItemsProcessed(std::int64_t(state.iterations()) * state.range(0));
+}
+BENCHMARK_TEMPLATE(RationalFunction_CompiledBatch, double)->Arg(1024);
+BENCHMARK_TEMPLATE(RationalFunction_CompiledBatch, carl::Interval<double>)->Arg(1024);
@@ -2,6 +2,7 @@
 
 #include <carl/core/rootfinder/RootFinder.h>
 #include <carl/formula/model/ran/RealAlgebraicNumber.h>
+#include <carl/formula/model/ran/RealAlgebraicNumberEvaluation.h>
 
 using Poly = carl::UnivariatePolynomial<mpq_class>;
 
@@ -39,3 +40,51 @@ BENCHMARK_F(RAN_Fixture, RAN_CreateRefineNew)(benchmark::State& state) {
 		ran.refine(true);
 	}
 }
+
+BENCHMARK_F(RAN_Fixture, RAN_Sgn)(benchmark::State& state) {
+	auto rans = carl::rootfinder::realRoots(p);
+	auto p = rans[0].getIRPolynomial();
+	auto i = rans[0].getInterval();
+	Poly q = Poly(x, {-1, 0, 0, 1}) * Poly(x, {-3, 0, 1});
+	for (auto _ : state) {
+		auto ran = carl::RealAlgebraicNumber<mpq_class>(p, i);
+		benchmark::DoNotOptimize(ran.sgn(q));
+	}
+}
+
+namespace {
+	/// Assigns sqrt(2) and sqrt(3) to two variables, together with a polynomial in both.
+	struct RAN_Point {
+		carl::Variable x = carl::freshRealVariable("x");
+		carl::Variable y = carl::freshRealVariable("y");
+		carl::RealAlgebraicNumberEvaluation::RANMap<mpq_class> map() const {
+			carl::RealAlgebraicNumberEvaluation::RANMap<mpq_class> res;
+			res.emplace(x, carl::RealAlgebraicNumber<mpq_class>(Poly(x, {-2, 0, 1}), carl::Interval<mpq_class>(1, carl::BoundType::STRICT, 2, carl::BoundType::STRICT)));
+			res.emplace(y, carl::RealAlgebraicNumber<mpq_class>(Poly(y, {-3, 0, 1}), carl::Interval<mpq_class>(1, carl::BoundType::STRICT, 2, carl::BoundType::STRICT)));
+			return res;
+		}
+		carl::MultivariatePolynomial<mpq_class> polynomial() const {
+			carl::MultivariatePolynomial<mpq_class> px(x);
+			carl::MultivariatePolynomial<mpq_class> py(y);
+			return px * px * py - px * py * py + px * py - mpq_class(1, 3);
+		}
+	};
+}
+
+static void RAN_SgnAtPointEvaluate(benchmark::State& state) {
+	RAN_Point point;
+	auto p = point.polynomial();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::RealAlgebraicNumberEvaluation::evaluate(p, point.map()).sgn());
+	}
+}
+BENCHMARK(RAN_SgnAtPointEvaluate);
+
+static void RAN_SgnAtPointFiltered(benchmark::State& state) {
+	RAN_Point point;
+	auto p = point.polynomial();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::RealAlgebraicNumberEvaluation::sgn(p, point.map()));
+	}
+}
+BENCHMARK(RAN_SgnAtPointFiltered);
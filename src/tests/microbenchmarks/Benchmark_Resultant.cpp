@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/polynomialfunctions/Resultant.h>
+#include <carl/numbers/numbers.h>
+
+#include <random>
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+using UMVP = carl::UnivariatePolynomial<MVP>;
+
+/// The polynomials from the CAD tests, in the variables x, y, z and w.
+struct CADPolynomials {
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::Variable y = carl::freshRealVariable("y");
+	carl::Variable z = carl::freshRealVariable("z");
+	carl::Variable w = carl::freshRealVariable("w");
+	std::vector<MVP> p;
+	CADPolynomials() {
+		MVP X(x), Y(y), Z(z), W(w);
+		p.push_back(X*X + Y*Y - MVP(1));
+		p.push_back(X - Y + MVP(1));
+		p.push_back(X*X + Y*Y + Z*Z - MVP(1));
+		p.push_back(Z*Z*Z - MVP(mpq_class(1, 2)));
+		p.push_back(X*Y - X - Y + MVP(1));
+		p.push_back(X*X*X + Y*Y*Y + Z*Z*Z - MVP(1));
+		p.push_back(X*X + Y*Y + Z*Z + W*W - MVP(2));
+		p.push_back(X*Y*Z*W - MVP(mpq_class(1, 3)) * X + Z*W*W);
+	}
+	static const CADPolynomials& get() {
+		static CADPolynomials polys;
+		return polys;
+	}
+};
+
+/**
+ * Repeatedly eliminates the variables w, z and y from the CAD test polynomials using discriminants and pairwise resultants, as the projection does.
+ * The number of polynomials per level is limited to keep the running time reasonable.
+ */
+static void projectCADPolynomials(carl::SubresultantStrategy strategy) {
+	const auto& cp = CADPolynomials::get();
+	std::vector<MVP> level(cp.p);
+	for (auto v: {cp.w, cp.z, cp.y}) {
+		std::vector<UMVP> upolys;
+		std::vector<MVP> next;
+		for (const auto& p: level) {
+			if (p.has(v)) upolys.emplace_back(p.toUnivariatePolynomial(v));
+			else next.emplace_back(p);
+		}
+		for (std::size_t i = 0; i < upolys.size(); ++i) {
+			if (upolys[i].degree() > 1) next.emplace_back(MVP(carl::discriminant(upolys[i], strategy)));
+			for (std::size_t j = i + 1; j < upolys.size(); ++j) {
+				next.emplace_back(MVP(carl::resultant(upolys[i], upolys[j], strategy)));
+			}
+		}
+		level.clear();
+		for (auto& p: next) {
+			if (p.isConstant() || std::find(level.begin(), level.end(), p) != level.end()) continue;
+			if (level.size() < 8) level.emplace_back(std::move(p));
+		}
+	}
+	benchmark::DoNotOptimize(level);
+}
+
+static void Resultant_CADProjection(benchmark::State& state, carl::SubresultantStrategy strategy) {
+	for (auto _ : state) {
+		projectCADPolynomials(strategy);
+	}
+}
+BENCHMARK_CAPTURE(Resultant_CADProjection, Lazard, carl::SubresultantStrategy::Lazard);
+BENCHMARK_CAPTURE(Resultant_CADProjection, Modular, carl::SubresultantStrategy::Modular);
+
+/// Dense polynomial of the given degree in x whose coefficients are dense of the given degree in y and z.
+UMVP randomDensePolynomial(std::size_t degree, unsigned seed) {
+	const auto& cp = CADPolynomials::get();
+	std::mt19937 rng(seed);
+	std::uniform_int_distribution<long> dist(-1000, 1000);
+	std::vector<MVP> coeffs;
+	for (std::size_t i = 0; i <= degree; ++i) {
+		MVP c;
+		for (std::size_t ey = 0; ey <= degree; ++ey) {
+			for (std::size_t ez = 0; ez + ey <= degree; ++ez) {
+				c += MVP(mpq_class(dist(rng))) * MVP(cp.y).pow(ey) * MVP(cp.z).pow(ez);
+			}
+		}
+		coeffs.emplace_back(std::move(c));
+	}
+	return UMVP(cp.x, coeffs);
+}
+
+static void Resultant_Dense(benchmark::State& state, carl::SubresultantStrategy strategy) {
+	UMVP p = randomDensePolynomial(std::size_t(state.range(0)), 1);
+	UMVP q = randomDensePolynomial(std::size_t(state.range(0)), 2);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::resultant(p, q, strategy));
+	}
+}
+BENCHMARK_CAPTURE(Resultant_Dense, Lazard, carl::SubresultantStrategy::Lazard)->DenseRange(1, 4);
+BENCHMARK_CAPTURE(Resultant_Dense, Modular, carl::SubresultantStrategy::Modular)->DenseRange(1, 4);
@@ -0,0 +1,46 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/polynomialfunctions/Chebyshev.h>
+#include <carl/core/rootfinder/RootFinder.h>
+
+using Poly = carl::UnivariatePolynomial<mpq_class>;
+
+/// Chebyshev polynomial of degree n, which has n real roots in (-1,1).
+Poly chebyshevInput(std::size_t n) {
+	static carl::Chebyshev<mpq_class> chebyshev(carl::freshRealVariable("x"));
+	return chebyshev(n);
+}
+
+/// Product of n quadratics x^2 - (i + 1/3) with irrational roots.
+Poly quadraticsInput(std::size_t n) {
+	static carl::Variable x = carl::freshRealVariable("x");
+	Poly p(x, mpq_class(1));
+	for (std::size_t i = 1; i <= n; ++i) {
+		p *= Poly(x, {-mpq_class(3 * long(i) + 1, 3), mpq_class(0), mpq_class(1)});
+	}
+	return p;
+}
+
+template<carl::rootfinder::SplittingStrategy strategy>
+static void RootFinder_Chebyshev(benchmark::State& state) {
+	Poly p = chebyshevInput(std::size_t(state.range(0)));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::rootfinder::realRoots(p, strategy));
+	}
+}
+BENCHMARK_TEMPLATE(RootFinder_Chebyshev, carl::rootfinder::SplittingStrategy::DEFAULT)->Arg(10)->Arg(20)->Arg(40);
+BENCHMARK_TEMPLATE(RootFinder_Chebyshev, carl::rootfinder::SplittingStrategy::BINARYSAMPLE)->Arg(10)->Arg(20)->Arg(40);
+BENCHMARK_TEMPLATE(RootFinder_Chebyshev, carl::rootfinder::SplittingStrategy::DESCARTES)->Arg(10)->Arg(20)->Arg(40);
+BENCHMARK_TEMPLATE(RootFinder_Chebyshev, carl::rootfinder::SplittingStrategy::BITSTREAM)->Arg(10)->Arg(20)->Arg(40);
+
+template<carl::rootfinder::SplittingStrategy strategy>
+static void RootFinder_Quadratics(benchmark::State& state) {
+	Poly p = quadraticsInput(std::size_t(state.range(0)));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::rootfinder::realRoots(p, strategy));
+	}
+}
+BENCHMARK_TEMPLATE(RootFinder_Quadratics, carl::rootfinder::SplittingStrategy::DEFAULT)->Arg(4)->Arg(8)->Arg(16);
+BENCHMARK_TEMPLATE(RootFinder_Quadratics, carl::rootfinder::SplittingStrategy::BINARYSAMPLE)->Arg(4)->Arg(8)->Arg(16);
+BENCHMARK_TEMPLATE(RootFinder_Quadratics, carl::rootfinder::SplittingStrategy::DESCARTES)->Arg(4)->Arg(8)->Arg(16);
+BENCHMARK_TEMPLATE(RootFinder_Quadratics, carl::rootfinder::SplittingStrategy::BITSTREAM)->Arg(4)->Arg(8)->Arg(16);
@@ -0,0 +1,165 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/cad/CAD.h>
+#include <carl/cad/Constraint.h>
+#include <carl/util/carlCompactTree.h>
+#include <carl/util/carlTree.h>
+
+#include <type_traits>
+
+using RAN = carl::RealAlgebraicNumber<mpq_class>;
+using Tree = carl::tree<RAN>;
+using CompactTree = carl::compact_tree<RAN, carl::RealAlgebraicNumberRepresentationHash<mpq_class>>;
+
+/**
+ * Runs a complete CAD in four variables using the given type of CAD.
+ * The constraints are unsatisfiable, hence all cells are lifted.
+ */
+template<typename CAD>
+void checkCAD(CAD& cad) {
+	using MP = carl::MultivariatePolynomial<mpq_class>;
+	static carl::Variable x = carl::freshRealVariable("x");
+	static carl::Variable y = carl::freshRealVariable("y");
+	static carl::Variable z = carl::freshRealVariable("z");
+	static carl::Variable w = carl::freshRealVariable("w");
+	std::vector<carl::Variable> vars({x, y, z, w});
+	MP X(x), Y(y), Z(z), W(w);
+	MP sphere = X*X + Y*Y + Z*Z + W*W - MP(1);
+	cad.addPolynomial(sphere, vars);
+	for (const auto& p: {X*X - MP(2), Y*Y - MP(2), Z*Z - MP(3), W*W - MP(2)}) {
+		cad.addPolynomial(p, vars);
+	}
+	std::vector<carl::cad::Constraint<mpq_class>> constraints({
+		carl::cad::Constraint<mpq_class>(W*W - MP(2), carl::Sign::ZERO, vars),
+		carl::cad::Constraint<mpq_class>(sphere, carl::Sign::NEGATIVE, vars)
+	});
+	carl::RealAlgebraicPoint<mpq_class> r;
+	typename CAD::BoundMap bounds;
+	cad.check(constraints, r, bounds);
+}
+
+/**
+ * The sample tree of the CAD of checkCAD().
+ */
+const Tree& cadSampleTree() {
+	static Tree tree = [](){
+		carl::CAD<mpq_class> cad;
+		checkCAD(cad);
+		return cad.getSampleTree();
+	}();
+	return tree;
+}
+
+/**
+ * A synthetic sample tree of the given depth, where every node has three children.
+ * The samples are the root of x^2 - 2 and the rationals between the roots, as the samples of a CAD.
+ */
+const Tree& deepSampleTree(std::size_t depth) {
+	static std::map<std::size_t, Tree> trees;
+	auto it = trees.find(depth);
+	if (it != trees.end()) return it->second;
+	carl::Variable x = carl::freshRealVariable("x");
+	std::vector<RAN> samples({RAN(-2), carl::rootfinder::realRoots(carl::UnivariatePolynomial<mpq_class>(x, {-2, 0, 1}))[1], RAN(2)});
+	Tree& t = trees[depth];
+	t.setRoot(RAN(0));
+	std::vector<Tree::iterator> level({t.begin()});
+	for (std::size_t d = 0; d < depth; ++d) {
+		std::vector<Tree::iterator> next;
+		for (const auto& n: level) {
+			for (const auto& s: samples) next.push_back(t.append(n, s));
+		}
+		level = std::move(next);
+	}
+	return t;
+}
+
+template<typename T>
+T convert(const Tree& t) {
+	if constexpr (std::is_same<T, Tree>::value) return t;
+	else return CompactTree::from(t);
+}
+
+/// Memory of the tree without the memory owned by the samples.
+std::size_t memoryUsage(const Tree& t) {
+	return sizeof(t) + std::size_t(std::distance(t.begin(), t.end())) * sizeof(Tree::Node);
+}
+std::size_t memoryUsage(const CompactTree& t) {
+	return t.memory_usage();
+}
+
+template<typename T>
+void setCounters(benchmark::State& state, const T& t) {
+	std::size_t nodes = std::size_t(std::distance(t.begin(), t.end()));
+	state.counters["nodes"] = double(nodes);
+	state.counters["bytes"] = double(memoryUsage(t));
+	state.counters["bytes/node"] = double(memoryUsage(t)) / double(nodes);
+}
+
+/// Walks from every leaf to the root and collects the sample, as constructSampleAt() does.
+template<typename T>
+void walkPaths(benchmark::State& state, const T& t) {
+	std::vector<const RAN*> sample;
+	for (auto _ : state) {
+		for (auto leaf = t.begin_leaf(); leaf != t.end_leaf(); ++leaf) {
+			sample.clear();
+			for (auto it = t.begin_path(leaf); it != t.end_path(); ++it) sample.push_back(&*it);
+			benchmark::DoNotOptimize(sample.data());
+		}
+	}
+	setCounters(state, t);
+}
+
+/// Iterates over all levels and visits the siblings of every node, as the lifting does.
+template<typename T>
+void walkLevels(benchmark::State& state, const T& t) {
+	std::size_t maxDepth = t.max_depth();
+	for (auto _ : state) {
+		std::size_t numeric = 0;
+		for (std::size_t d = 0; d < maxDepth; ++d) {
+			for (auto node = t.begin_depth(d); node != t.end_depth(); ++node) {
+				for (auto child = t.begin_children(node); child != t.end_children(node); ++child) {
+					if (child->isNumeric()) ++numeric;
+				}
+			}
+		}
+		benchmark::DoNotOptimize(numeric);
+	}
+	setCounters(state, t);
+}
+
+template<typename T>
+static void SampleTree_CAD_Paths(benchmark::State& state) {
+	walkPaths(state, convert<T>(cadSampleTree()));
+}
+template<typename T>
+static void SampleTree_CAD_Levels(benchmark::State& state) {
+	walkLevels(state, convert<T>(cadSampleTree()));
+}
+/// Runs the CAD of checkCAD() with the given type of sample tree.
+template<typename T>
+static void SampleTree_CAD_Check(benchmark::State& state) {
+	for (auto _ : state) {
+		carl::CAD<mpq_class, T> cad;
+		checkCAD(cad);
+		benchmark::DoNotOptimize(cad.samples().size());
+	}
+}
+template<typename T>
+static void SampleTree_Deep_Paths(benchmark::State& state) {
+	walkPaths(state, convert<T>(deepSampleTree(std::size_t(state.range(0)))));
+}
+template<typename T>
+static void SampleTree_Deep_Levels(benchmark::State& state) {
+	walkLevels(state, convert<T>(deepSampleTree(std::size_t(state.range(0)))));
+}
+
+BENCHMARK_TEMPLATE(SampleTree_CAD_Paths, Tree);
+BENCHMARK_TEMPLATE(SampleTree_CAD_Paths, CompactTree);
+BENCHMARK_TEMPLATE(SampleTree_CAD_Levels, Tree);
+BENCHMARK_TEMPLATE(SampleTree_CAD_Levels, CompactTree);
+BENCHMARK_TEMPLATE(SampleTree_CAD_Check, Tree);
+BENCHMARK_TEMPLATE(SampleTree_CAD_Check, CompactTree);
+BENCHMARK_TEMPLATE(SampleTree_Deep_Paths, Tree)->DenseRange(6, 10, 2);
+BENCHMARK_TEMPLATE(SampleTree_Deep_Paths, CompactTree)->DenseRange(6, 10, 2);
+BENCHMARK_TEMPLATE(SampleTree_Deep_Levels, Tree)->DenseRange(6, 10, 2);
+BENCHMARK_TEMPLATE(SampleTree_Deep_Levels, CompactTree)->DenseRange(6, 10, 2);
@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/UnivariatePolynomial.h>
+#include <carl/numbers/numbers.h>
+
+#include <limits>
+#include <memory>
+#include <random>
+
+template<typename C>
+carl::UnivariatePolynomial<C> randomPolynomial(std::size_t degree, unsigned seed) {
+	static carl::Variable x = carl::freshRealVariable("x");
+	std::mt19937 rng(seed);
+	std::uniform_int_distribution<long> dist(-1000000, 1000000);
+	std::vector<C> coeffs;
+	for (std::size_t i = 0; i <= degree; ++i) {
+		if constexpr (carl::is_rational<C>::value) {
+			coeffs.emplace_back(C(dist(rng)) / C(1 + std::abs(dist(rng)) % 100));
+		} else {
+			coeffs.emplace_back(dist(rng));
+		}
+	}
+	if (carl::isZero(coeffs.back())) coeffs.back() = 1;
+	return carl::UnivariatePolynomial<C>(x, coeffs);
+}
+
+/// Disables the fast algorithms while in scope.
+struct ClassicalArithmetic {
+	std::size_t karatsuba = carl::DenseArithmeticSettings::karatsubaThreshold;
+	std::size_t taylorShift = carl::DenseArithmeticSettings::taylorShiftThreshold;
+	std::size_t newtonDivision = carl::DenseArithmeticSettings::newtonDivisionThreshold;
+	ClassicalArithmetic() {
+		carl::DenseArithmeticSettings::karatsubaThreshold = std::numeric_limits<std::size_t>::max();
+		carl::DenseArithmeticSettings::taylorShiftThreshold = std::numeric_limits<std::size_t>::max();
+		carl::DenseArithmeticSettings::newtonDivisionThreshold = std::numeric_limits<std::size_t>::max();
+	}
+	~ClassicalArithmetic() {
+		carl::DenseArithmeticSettings::karatsubaThreshold = karatsuba;
+		carl::DenseArithmeticSettings::taylorShiftThreshold = taylorShift;
+		carl::DenseArithmeticSettings::newtonDivisionThreshold = newtonDivision;
+	}
+};
+
+template<typename C, bool classical>
+static void UP_Multiplication(benchmark::State& state) {
+	auto p = randomPolynomial<C>(std::size_t(state.range(0)), 1);
+	auto q = randomPolynomial<C>(std::size_t(state.range(0)), 2);
+	std::unique_ptr<ClassicalArithmetic> guard(classical ? new ClassicalArithmetic() : nullptr);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(p * q);
+	}
+}
+BENCHMARK_TEMPLATE(UP_Multiplication, mpz_class, true)->RangeMultiplier(2)->Range(16, 1024);
+BENCHMARK_TEMPLATE(UP_Multiplication, mpz_class, false)->RangeMultiplier(2)->Range(16, 1024);
+BENCHMARK_TEMPLATE(UP_Multiplication, mpq_class, true)->RangeMultiplier(2)->Range(16, 1024);
+BENCHMARK_TEMPLATE(UP_Multiplication, mpq_class, false)->RangeMultiplier(2)->Range(16, 1024);
+
+template<typename C, bool classical>
+static void UP_TaylorShift(benchmark::State& state) {
+	auto p = randomPolynomial<C>(std::size_t(state.range(0)), 1);
+	C shift = carl::is_rational<C>::value ? C(7) / C(3) : C(7);
+	std::unique_ptr<ClassicalArithmetic> guard(classical ? new ClassicalArithmetic() : nullptr);
+	for (auto _ : state) {
+		auto tmp = p;
+		tmp.shift(shift);
+		benchmark::DoNotOptimize(tmp);
+	}
+}
+BENCHMARK_TEMPLATE(UP_TaylorShift, mpz_class, true)->RangeMultiplier(2)->Range(16, 1024);
+BENCHMARK_TEMPLATE(UP_TaylorShift, mpz_class, false)->RangeMultiplier(2)->Range(16, 1024);
+BENCHMARK_TEMPLATE(UP_TaylorShift, mpq_class, true)->RangeMultiplier(2)->Range(16, 1024);
+BENCHMARK_TEMPLATE(UP_TaylorShift, mpq_class, false)->RangeMultiplier(2)->Range(16, 1024);
+
+template<bool classical>
+static void UP_Remainder(benchmark::State& state) {
+	auto p = randomPolynomial<mpq_class>(std::size_t(2 * state.range(0)), 1);
+	auto q = randomPolynomial<mpq_class>(std::size_t(state.range(0)), 2);
+	std::unique_ptr<ClassicalArithmetic> guard(classical ? new ClassicalArithmetic() : nullptr);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(p.remainder(q));
+	}
+}
+BENCHMARK_TEMPLATE(UP_Remainder, true)->RangeMultiplier(2)->Range(16, 1024);
+BENCHMARK_TEMPLATE(UP_Remainder, false)->RangeMultiplier(2)->Range(16, 1024);
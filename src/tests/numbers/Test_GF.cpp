@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include "carl/numbers/numbers.h"
 
+#include <random>
 #include <type_traits>
 
 using namespace carl;
@@ -68,3 +69,98 @@ TEST(GaloisField, integers)
 
 
 
+
+TEST(GaloisField, compoundAssignment)
+{
+	const GaloisField<mpz_class>* gf5 = GaloisFieldManager<mpz_class>::getInstance().getField(5);
+	for (int i = -6; i < 6; ++i) {
+		for (int j = -6; j < 6; ++j) {
+			GFNumber<mpz_class> a(i, gf5);
+			GFNumber<mpz_class> b(j, gf5);
+			GFNumber<mpz_class> sum = a;
+			sum += b;
+			GFNumber<mpz_class> difference = a;
+			difference -= b;
+			EXPECT_EQ((a + b).representingInteger(), sum.representingInteger());
+			EXPECT_EQ((a - b).representingInteger(), difference.representingInteger());
+		}
+	}
+	// Repeated updates are reduced instead of growing the representing integer.
+	GFNumber<mpz_class> a2(2, gf5);
+	GFNumber<mpz_class> acc(0, gf5);
+	for (int i = 0; i < 1000; ++i) {
+		acc += a2;
+		EXPECT_LT(abs(acc.representingInteger()), mpz_class(5));
+	}
+	EXPECT_TRUE(acc.isZero());
+	for (int i = 0; i < 1001; ++i) {
+		acc -= a2;
+		EXPECT_LT(abs(acc.representingInteger()), mpz_class(5));
+	}
+	EXPECT_EQ(GFNumber<mpz_class>(3, gf5), acc);
+}
+
+
+TEST(GaloisField, words)
+{
+	std::mt19937_64 rng(7);
+	for (carl::uint m: {carl::uint(2), carl::uint(3), carl::uint(1024), carl::uint(4294967291u), carl::uint(9223372036854775783u), carl::uint(6442450941u)}) {
+		GaloisField<carl::uint> gf(m);
+		mpz_class mm(static_cast<unsigned long>(m));
+		for (std::size_t i = 0; i < 1000; ++i) {
+			carl::uint a = rng() % m;
+			carl::uint b = rng() % m;
+			mpz_class product = mpz_class(static_cast<unsigned long>(a)) * mpz_class(static_cast<unsigned long>(b));
+			mpz_class expected = product % mm;
+			EXPECT_EQ(expected.get_ui(), gf.mul(a, b)) << a << " * " << b << " mod " << m;
+			EXPECT_EQ(expected.get_ui(), gf.mulShoup(a, b, gf.shoup(b))) << a << " * " << b << " mod " << m;
+			EXPECT_EQ(mpz_class((mpz_class(static_cast<unsigned long>(a)) + static_cast<unsigned long>(b)) % mm).get_ui(), gf.add(a, b));
+			EXPECT_EQ(a, gf.add(gf.sub(a, b), b));
+			EXPECT_EQ(0u, gf.add(a, gf.neg(a)));
+		}
+	}
+	GaloisField<carl::uint> gf(9223372036854775783u);
+	for (std::size_t i = 0; i < 100; ++i) {
+		carl::uint a = rng() % gf.size();
+		if (a == 0) continue;
+		EXPECT_EQ(1u, gf.mul(a, gf.inverse(a)));
+	}
+	EXPECT_EQ(gf.size() - 3, gf.fromInteger(-3));
+	EXPECT_EQ(0u, gf.fromInteger(-carl::sint(gf.size())));
+
+	// Z_{3^4} is not a field, but all numbers coprime to 3 are invertible.
+	GaloisField<carl::uint> gf81(3, 4);
+	EXPECT_EQ(81u, gf81.size());
+	for (carl::uint a = 1; a < 81; ++a) {
+		if (a % 3 == 0) continue;
+		EXPECT_EQ(1u, gf81.mul(a, gf81.inverse(a))) << a;
+	}
+}
+
+TEST(GaloisField, wordNumbers)
+{
+	GaloisFieldManager<carl::uint>& gfm = GaloisFieldManager<carl::uint>::getInstance();
+	const GaloisField<carl::uint>* gf5 = gfm.getField(5);
+	const GaloisField<mpz_class>* gf5z = GaloisFieldManager<mpz_class>::getInstance().getField(5);
+	for (int i = -6; i < 6; ++i) {
+		for (int j = -6; j < 6; ++j) {
+			GFNumber<carl::uint> a(i, gf5);
+			GFNumber<carl::uint> b(j, gf5);
+			GFNumber<mpz_class> az(i, gf5z);
+			GFNumber<mpz_class> bz(j, gf5z);
+			EXPECT_EQ(gf5->fromInteger((az + bz).representingInteger().get_si()), (a + b).representingInteger());
+			EXPECT_EQ(gf5->fromInteger((az - bz).representingInteger().get_si()), (a - b).representingInteger());
+			EXPECT_EQ(gf5->fromInteger((az * bz).representingInteger().get_si()), (a * b).representingInteger());
+			EXPECT_EQ(gf5->fromInteger((-az).representingInteger().get_si()), (-a).representingInteger());
+			if (!b.isZero()) {
+				EXPECT_EQ(a, (a / b) * b);
+			}
+		}
+	}
+	// Numbers without field are reduced when combined with numbers from a field.
+	GFNumber<carl::uint> seven(7);
+	EXPECT_EQ(GFNumber<carl::uint>(2, gf5), seven + GFNumber<carl::uint>(0, gf5));
+	EXPECT_EQ(GFNumber<carl::uint>(4, gf5), seven * GFNumber<carl::uint>(2, gf5));
+	EXPECT_EQ(GFNumber<carl::uint>(4, gf5), GFNumber<carl::uint>(mpz_class("-123456789012345678901"), gf5));
+	EXPECT_TRUE(GFNumber<carl::uint>(4, gf5) == -1);
+}
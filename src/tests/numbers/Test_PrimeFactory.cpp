@@ -3,6 +3,8 @@
 #include <carl/numbers/PrimeFactory.h>
 #include <carl/numbers/numbers.h>
 
+#include <random>
+
 template<typename T>
 class PrimeFactory: public testing::Test {};
 
@@ -19,3 +21,54 @@ TYPED_TEST(PrimeFactory, integers)
 	EXPECT_EQ(TypeParam(13), primefact.nextPrime());
 	EXPECT_EQ(TypeParam(17), primefact.nextPrime());
 }
+
+TEST(PrimeFactory, isPrime)
+{
+	carl::PrimeFactory<carl::uint> primefact;
+	std::size_t next = 0;
+	for (carl::uint n = 0; n < 10000; ++n) {
+		bool prime = (n == primefact[next]);
+		if (prime) next++;
+		EXPECT_EQ(prime, carl::isPrime(n)) << n;
+	}
+	// Carmichael numbers and strong pseudoprimes to several bases.
+	for (carl::uint n: {561ull, 41041ull, 3215031751ull, 4759123141ull, 1122004669633ull, 3825123056546413051ull}) {
+		EXPECT_FALSE(carl::isPrime(n)) << n;
+	}
+	EXPECT_TRUE(carl::isPrime(4294967291ull));
+	EXPECT_FALSE(carl::isPrime(4294967297ull));
+	EXPECT_TRUE(carl::isPrime(18446744073709551557ull));
+	EXPECT_FALSE(carl::isPrime(18446744073709551615ull));
+
+	std::mt19937_64 rng(42);
+	for (std::size_t i = 0; i < 2000; ++i) {
+		carl::uint n = rng() | 1;
+		mpz_class m(static_cast<unsigned long>(n));
+		EXPECT_EQ(mpz_probab_prime_p(m.get_mpz_t(), 50) != 0, carl::isPrime(n)) << n;
+	}
+}
+
+template<std::size_t Bits>
+void checkWordPrimes(std::size_t count) {
+	carl::WordPrimeFactory<Bits> primes;
+	mpz_class bound = mpz_class(1) << Bits;
+	mpz_class last = 0;
+	for (std::size_t i = 0; i < count; ++i) {
+		mpz_class p(static_cast<unsigned long>(primes.nextPrime()));
+		mpz_class next;
+		mpz_nextprime(next.get_mpz_t(), p.get_mpz_t());
+		EXPECT_TRUE(mpz_probab_prime_p(p.get_mpz_t(), 50) != 0) << p;
+		if (i == 0) EXPECT_GT(next, bound) << "Prime missed above " << p;
+		else EXPECT_EQ(last, next) << "Prime missed between " << p << " and " << last;
+		last = p;
+	}
+	EXPECT_EQ(count, primes.size());
+}
+
+TEST(PrimeFactory, WordPrimeFactory)
+{
+	checkWordPrimes<32>(200);
+	checkWordPrimes<63>(100);
+	checkWordPrimes<64>(100);
+	checkWordPrimes<20>(100);
+}
@@ -0,0 +1,126 @@
+#include "gtest/gtest.h"
+
+#include "carl/util/carlCompactTree.h"
+#include "carl/util/carlTree.h"
+
+#include <sstream>
+
+using namespace carl;
+
+namespace {
+	/// Builds a tree of the given depth where every inner node has (depth + 2) children with values 0, 1, ...
+	template<typename Tree>
+	Tree buildTree(std::size_t depth) {
+		Tree t;
+		t.setRoot(0);
+		std::vector<typename Tree::iterator> level({t.begin()});
+		for (std::size_t d = 0; d < depth; ++d) {
+			std::vector<typename Tree::iterator> next;
+			for (const auto& n: level) {
+				for (int i = 0; i < int(d) + 2; ++i) next.push_back(t.append(n, i));
+			}
+			level = next;
+		}
+		return t;
+	}
+	template<typename Iterator>
+	std::vector<int> values(Iterator begin, Iterator end) {
+		return std::vector<int>(begin, end);
+	}
+}
+
+TEST(CompactTree, Traversal)
+{
+	auto t = buildTree<carl::tree<int>>(4);
+	auto ct = compact_tree<int>::from(t);
+	EXPECT_EQ(std::size_t(1 + 2 + 6 + 24 + 120), ct.size());
+	EXPECT_EQ(std::size_t(5), ct.store().size());
+	EXPECT_TRUE(ct.isConsistent());
+	EXPECT_EQ(t.max_depth(), ct.max_depth());
+	EXPECT_EQ(t.max_depth(t.begin_children(t.begin())), ct.max_depth(ct.begin_children(ct.begin())));
+
+	EXPECT_EQ(values(t.begin_preorder(), t.end_preorder()), values(ct.begin_preorder(), ct.end_preorder()));
+	EXPECT_EQ(values(t.begin_leaf(), t.end_leaf()), values(ct.begin_leaf(), ct.end_leaf()));
+	for (std::uint32_t d = 0; d <= 5; ++d) {
+		EXPECT_EQ(values(t.begin_depth(d), t.end_depth()), values(ct.begin_depth(d), ct.end_depth()));
+	}
+	auto leaf = t.begin_leaf();
+	auto cleaf = ct.begin_leaf();
+	for (; leaf != t.end_leaf(); ++leaf, ++cleaf) {
+		EXPECT_EQ(leaf.depth(), cleaf.depth());
+		EXPECT_EQ(values(t.begin_path(leaf), t.end_path()), values(ct.begin_path(cleaf), ct.end_path()));
+		auto parent = t.get_parent(leaf);
+		auto cparent = ct.get_parent(cleaf);
+		EXPECT_EQ(values(t.begin_children(parent), t.end_children(parent)), values(ct.begin_children(cparent), ct.end_children(cparent)));
+	}
+	EXPECT_EQ(ct.end_leaf(), cleaf);
+}
+
+TEST(CompactTree, Modification)
+{
+	compact_tree<int> t;
+	EXPECT_TRUE(t.empty());
+	EXPECT_EQ(t.end_preorder(), t.begin_preorder());
+	auto root = t.setRoot(0);
+	auto i1 = t.append(root, 1);
+	auto i2 = t.append(root, 2);
+	auto i3 = t.append(root, 3);
+	t.insert(i1, 4);
+	t.insert(i2, 5);
+	t.append(i2, 6);
+	t.append(i2, 7);
+	EXPECT_EQ(std::vector<int>({0, 4, 1, 5, 2, 6, 7, 3}), values(t.begin(), t.end()));
+	EXPECT_TRUE(t.isConsistent());
+	EXPECT_EQ(std::size_t(8), t.store().size());
+
+	auto next = t.erase(i2);
+	EXPECT_EQ(i3, next);
+	EXPECT_EQ(std::size_t(5), t.size());
+	EXPECT_EQ(std::vector<int>({0, 4, 1, 5, 3}), values(t.begin(), t.end()));
+	EXPECT_FALSE(t.is_valid(i2));
+	// the values of the erased nodes are removed from the store
+	EXPECT_EQ(std::size_t(5), t.store().size());
+	// erased nodes are reused
+	auto i8 = t.append(i3, 8);
+	EXPECT_LT(i8.id(), std::size_t(8));
+	t.replace(i1, 9);
+	EXPECT_EQ(std::vector<int>({0, 4, 9, 5, 3, 8}), values(t.begin(), t.end()));
+	EXPECT_EQ(std::vector<int>({4, 9, 5, 8}), values(t.begin_leaf(), t.end_leaf()));
+	EXPECT_TRUE(t.isConsistent());
+	EXPECT_EQ(std::size_t(6), t.store().size());
+	// handles of removed values are reused
+	EXPECT_EQ(std::size_t(8), t.store().handle_bound());
+	t.replace(i3, 4);
+	EXPECT_EQ(std::size_t(5), t.store().size());
+	EXPECT_EQ(4, *i3);
+
+	t.eraseChildren(root);
+	EXPECT_EQ(std::size_t(1), t.size());
+	EXPECT_TRUE(t.is_leaf(root));
+	t.clear();
+	EXPECT_TRUE(t.empty());
+	EXPECT_EQ(std::size_t(0), t.store().size());
+}
+
+TEST(CompactTree, Serialization)
+{
+	auto t = compact_tree<int>::from(buildTree<carl::tree<int>>(3));
+	auto leaf = t.begin_leaf();
+	t.replace(leaf, 1000);
+	t.erase(t.get_parent(t.get_parent(leaf)));
+
+	std::stringstream ss;
+	t.serialize(ss, [](std::ostream& os, int i){ compact_tree_detail::writeVarint(os, std::uint64_t(i)); });
+	// two bytes per node plus the values
+	EXPECT_GT(ss.str().size(), 2 * t.size());
+	EXPECT_LT(ss.str().size(), 2 * t.size() + 16);
+
+	auto r = compact_tree<int>::deserialize(ss, [](std::istream& is){ return int(compact_tree_detail::readVarint(is)); });
+	EXPECT_TRUE(r.isConsistent());
+	EXPECT_EQ(t.size(), r.size());
+	EXPECT_EQ(std::size_t(4), r.store().size());
+	EXPECT_EQ(values(t.begin(), t.end()), values(r.begin(), r.end()));
+	for (auto it = t.begin(), rit = r.begin(); it != t.end(); ++it, ++rit) {
+		EXPECT_EQ(it.depth(), rit.depth());
+	}
+}
@@ -0,0 +1,68 @@
+#include "gtest/gtest.h"
+
+#include "carl/util/WorkStealingPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace carl;
+
+TEST(WorkStealingPool, ParallelFor)
+{
+	WorkStealingPool pool(3);
+	EXPECT_EQ(std::size_t(3), pool.size());
+	std::vector<std::size_t> results(1000, 0);
+	pool.parallelFor(results.size(), [&](std::size_t i){ results[i] = i * i; });
+	for (std::size_t i = 0; i < results.size(); ++i) EXPECT_EQ(i * i, results[i]);
+
+	// nested calls are executed by the calling threads if all workers are busy
+	std::atomic<std::size_t> sum(0);
+	pool.parallelFor(10, [&](std::size_t i){
+		pool.parallelFor(10, [&](std::size_t j){ sum += i * 10 + j; }, 2);
+	});
+	EXPECT_EQ(std::size_t(99 * 100 / 2), sum.load());
+}
+
+TEST(WorkStealingPool, Threads)
+{
+	WorkStealingPool pool(3);
+	for (std::size_t threads: {1, 2, 4, 8}) {
+		std::atomic<std::size_t> active(0);
+		std::atomic<std::size_t> maxActive(0);
+		std::atomic<std::size_t> calls(0);
+		pool.parallelFor(200, [&](std::size_t){
+			std::size_t cur = ++active;
+			std::size_t max = maxActive.load();
+			while (cur > max && !maxActive.compare_exchange_weak(max, cur));
+			std::this_thread::yield();
+			++calls;
+			--active;
+		}, threads);
+		EXPECT_EQ(std::size_t(200), calls.load());
+		EXPECT_LE(maxActive.load(), std::min<std::size_t>(threads, pool.size() + 1));
+	}
+}
+
+TEST(WorkStealingPool, Exception)
+{
+	WorkStealingPool pool(2);
+	std::atomic<std::size_t> calls(0);
+	EXPECT_THROW(pool.parallelFor(50, [&](std::size_t i){
+		++calls;
+		if (i == 17) throw std::runtime_error("failure");
+	}), std::runtime_error);
+	// all calls are finished before the exception is rethrown
+	EXPECT_EQ(std::size_t(50), calls.load());
+}
+
+TEST(WorkStealingPool, Shared)
+{
+	WorkStealingPool& pool = WorkStealingPool::shared();
+	EXPECT_EQ(&pool, &WorkStealingPool::shared());
+	std::atomic<std::size_t> calls(0);
+	pool.parallelFor(100, [&](std::size_t){ ++calls; }, 2);
+	EXPECT_EQ(std::size_t(100), calls.load());
+}